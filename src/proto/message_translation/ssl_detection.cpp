@@ -139,7 +139,8 @@ std::vector<RobotDetection> createTeamDetection(
                                   ssl_robot_detection.y() * METERS_PER_MILLIMETER),
                 .orientation = Angle::fromRadians(ssl_robot_detection.orientation()),
                 .confidence  = ssl_robot_detection.confidence(),
-                .timestamp   = Timestamp::fromSeconds(detection.t_capture())};
+                .timestamp   = Timestamp::fromSeconds(detection.t_capture()),
+                .camera_id   = detection.camera_id()};
 
             bool ignore_robot = ignore_invalid_camera_data &&
                                 (min_valid_x > robot_detection.position.x() ||
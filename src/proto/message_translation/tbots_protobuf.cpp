@@ -439,11 +439,10 @@ std::optional<TrajectoryPath> createTrajectoryPathFromParams(
         initial_destination = createPoint(params.sub_destinations(0).sub_destination());
     }
 
-    auto trajectory = std::make_shared<BangBangTrajectory2D>(
-        createPoint(params.start_position()), initial_destination, initial_velocity,
-        constraints);
+    BangBangTrajectory2D trajectory(createPoint(params.start_position()),
+                                    initial_destination, initial_velocity, constraints);
 
-    TrajectoryPath trajectory_path(trajectory, BangBangTrajectory2D::generator);
+    TrajectoryPath trajectory_path(trajectory);
 
     // Append the rest of the sub-trajectories
     for (int i = 1; i < params.sub_destinations_size(); ++i)
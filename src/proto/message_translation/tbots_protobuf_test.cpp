@@ -79,29 +79,29 @@ class TbotsProtobufTest : public ::testing::Test
 
         for (int i = 0; i < traj_path_nodes_1.size(); i++)
         {
-            EXPECT_EQ(traj_path_nodes_1[i].getTrajectory()->getPosition(0.0),
-                      traj_path_nodes_2[i].getTrajectory()->getPosition(0.0))
+            EXPECT_EQ(traj_path_nodes_1[i].getTrajectory().getPosition(0.0),
+                      traj_path_nodes_2[i].getTrajectory().getPosition(0.0))
                 << " Position at index " << i << " is not equal";
         }
 
         for (int i = 0; i < traj_path_nodes_1.size(); i++)
         {
-            EXPECT_EQ(traj_path_nodes_1[i].getTrajectory()->getVelocity(0.0),
-                      traj_path_nodes_2[i].getTrajectory()->getVelocity(0.0))
+            EXPECT_EQ(traj_path_nodes_1[i].getTrajectory().getVelocity(0.0),
+                      traj_path_nodes_2[i].getTrajectory().getVelocity(0.0))
                 << " Velocity at index " << i << " is not equal";
         }
 
         for (int i = 0; i < traj_path_nodes_1.size(); i++)
         {
-            EXPECT_EQ(traj_path_nodes_1[i].getTrajectory()->getAcceleration(0.0),
-                      traj_path_nodes_2[i].getTrajectory()->getAcceleration(0.0))
+            EXPECT_EQ(traj_path_nodes_1[i].getTrajectory().getAcceleration(0.0),
+                      traj_path_nodes_2[i].getTrajectory().getAcceleration(0.0))
                 << " Acceleration at index " << i << " is not equal";
         }
 
         for (int i = 0; i < traj_path_nodes_1.size(); i++)
         {
-            EXPECT_EQ(traj_path_nodes_1[i].getTrajectory()->getDestination(),
-                      traj_path_nodes_2[i].getTrajectory()->getDestination())
+            EXPECT_EQ(traj_path_nodes_1[i].getTrajectory().getDestination(),
+                      traj_path_nodes_2[i].getTrajectory().getDestination())
                 << " Destination at index " << i << " is not equal";
         }
     }
@@ -172,9 +172,9 @@ TEST_P(TrajectoryParamConversionTest, trajectory_params_msg_test)
         initial_destination = sub_destinations[0];
     }
 
-    auto trajectory = std::make_shared<BangBangTrajectory2D>(
-        start_position, initial_destination, initial_velocity, constraints);
-    TrajectoryPath trajectory_path(trajectory, BangBangTrajectory2D::generator);
+    BangBangTrajectory2D trajectory(start_position, initial_destination, initial_velocity,
+                                    constraints);
+    TrajectoryPath trajectory_path(trajectory);
 
     for (int i = 1; i < sub_destinations.size(); i++)
     {
@@ -1,5 +1,9 @@
 #include "software/ai/evaluation/calc_best_shot.h"
 
+#include <cmath>
+
+#include "software/geom/angular_sweep.h"
+
 std::optional<Shot> calcBestShotOnGoal(const Segment &goal_post, const Point &shot_origin,
                                        const std::vector<Robot> &robot_obstacles,
                                        TeamType goal, double radius)
@@ -11,89 +15,50 @@ std::optional<Shot> calcBestShotOnGoal(const Segment &goal_post, const Point &sh
         return std::nullopt;
     }
 
-    size_t max_num_obstacles = robot_obstacles.size();
-
-    Angle pos_post_angle = (goal_post.getStart() - shot_origin).orientation();
-    Angle neg_post_angle = (goal_post.getEnd() - shot_origin).orientation();
-
-    std::vector<AngleSegment> obstacles;
-    obstacles.reserve(max_num_obstacles);
-
-    if (goal == TeamType::FRIENDLY)
-    {
-        auto tmp       = pos_post_angle;
-        pos_post_angle = (neg_post_angle + Angle::half()).clamp();
-        neg_post_angle = (tmp + Angle::half()).clamp();
-    }
-    AngleMap angle_map(pos_post_angle, neg_post_angle, max_num_obstacles);
-
+    // Shots on the friendly goal are swept in a frame rotated by a half turn, so that
+    // the angles to the goal are always around 0 and never wrap around
+    const double frame_sign = goal == TeamType::FRIENDLY ? -1.0 : 1.0;
+    const Point &top_post =
+        goal == TeamType::FRIENDLY ? goal_post.getEnd() : goal_post.getStart();
+    const Point &bottom_post =
+        goal == TeamType::FRIENDLY ? goal_post.getStart() : goal_post.getEnd();
+    const double origin_x = frame_sign * shot_origin.x();
+    const double origin_y = frame_sign * shot_origin.y();
+
+    AngularSweep &sweep = AngularSweep::getThreadLocalSweep();
+    sweep.reset(std::atan2(frame_sign * top_post.y() - origin_y,
+                           frame_sign * top_post.x() - origin_x),
+                std::atan2(frame_sign * bottom_post.y() - origin_y,
+                           frame_sign * bottom_post.x() - origin_x));
     for (const Robot &robot_obstacle : robot_obstacles)
     {
-        Point enemy_robot_pos    = robot_obstacle.position();
-        Vector perpendicular_vec = (enemy_robot_pos - shot_origin).perpendicular();
-
-        Vector one_end_vec = perpendicular_vec.normalize(radius);
-
-        Point one_end   = enemy_robot_pos + one_end_vec;
-        Point other_end = enemy_robot_pos - one_end_vec;
-
-        Vector top_vec    = one_end - shot_origin;
-        Vector bottom_vec = other_end - shot_origin;
-
-        Angle top_angle    = top_vec.orientation();
-        Angle bottom_angle = bottom_vec.orientation();
-        if (goal == TeamType::FRIENDLY)
-        {
-            top_angle    = (top_vec.orientation() + Angle::half()).clamp();
-            bottom_angle = (bottom_vec.orientation() + Angle::half()).clamp();
-        }
-
-        if (bottom_angle > angle_map.getAngleSegment().getAngleTop() ||
-            top_angle < angle_map.getAngleSegment().getAngleBottom())
-        {
-            continue;
-        }
-
-        AngleSegment non_viable_angle_seg = AngleSegment(top_angle, bottom_angle);
-        obstacles.emplace_back(non_viable_angle_seg);
-    }
-
-    std::sort(obstacles.begin(), obstacles.end(),
-              [](AngleSegment &a, AngleSegment &b) -> bool { return a > b; });
-
-    for (AngleSegment &obstacle_angle_seg : obstacles)
-    {
-        angle_map.addNonViableAngleSegment(obstacle_angle_seg);
+        double top_angle    = 0.0;
+        double bottom_angle = 0.0;
+        AngularSweep::calculateObstacleEdges(
+            origin_x, origin_y, frame_sign * robot_obstacle.position().x(),
+            frame_sign * robot_obstacle.position().y(), radius, top_angle, bottom_angle);
+        sweep.addBlockedInterval(top_angle, bottom_angle);
     }
 
-    AngleSegment biggest_angle_seg = angle_map.getBiggestViableAngleSegment();
-    if (biggest_angle_seg.getDeltaInDegrees() == 0)
+    const OpenAngularInterval biggest_interval = sweep.getBiggestOpenInterval();
+    if (biggest_interval.size() == 0)
     {
         return std::nullopt;
     }
 
-    Angle top_angle    = biggest_angle_seg.getAngleTop();
-    Angle bottom_angle = biggest_angle_seg.getAngleBottom();
-
-    if (goal == TeamType::FRIENDLY)
-    {
-        top_angle    = (top_angle + Angle::half()).clamp();
-        bottom_angle = (bottom_angle + Angle::half()).clamp();
-    }
-
-    Point top_point    = Point(goal_post.getStart().x(),
-                            (top_angle.sin() / top_angle.cos()) *
-                                    (goal_post.getStart().x() - shot_origin.x()) +
-                                shot_origin.y());
-    Point bottom_point = Point(goal_post.getStart().x(),
-                               (bottom_angle.sin() / bottom_angle.cos()) *
-                                       (goal_post.getStart().x() - shot_origin.x()) +
-                                   shot_origin.y());
+    // Rotating the frame by a half turn does not change the slope of a direction, so
+    // the edges of the interval can be projected onto the goal line in either frame
+    const double goal_x           = goal_post.getStart().x();
+    const double distance_to_goal = goal_x - shot_origin.x();
+    const Point top_point(goal_x, std::tan(biggest_interval.top) * distance_to_goal +
+                                      shot_origin.y());
+    const Point bottom_point(
+        goal_x, std::tan(biggest_interval.bottom) * distance_to_goal + shot_origin.y());
 
-    Point shot_point = (top_point - bottom_point) / 2 + bottom_point;
+    const Point shot_point = (top_point - bottom_point) / 2 + bottom_point;
 
     return std::make_optional(
-        Shot(shot_point, Angle::fromDegrees(biggest_angle_seg.getDeltaInDegrees())));
+        Shot(shot_point, Angle::fromRadians(biggest_interval.size())));
 }
 
 std::optional<Shot> calcBestShotOnGoal(const Field &field, const Team &friendly_team,
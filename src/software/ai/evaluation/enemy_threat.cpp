@@ -1,10 +1,9 @@
 #include "software/ai/evaluation/enemy_threat.h"
 
-#include <deque>
-
 #include "shared/constants.h"
 #include "software/ai/evaluation/calc_best_shot.h"
 #include "software/ai/evaluation/intercept.h"
+#include "software/ai/evaluation/pass_visibility_graph.h"
 #include "software/ai/evaluation/possession.h"
 #include "software/geom/algorithms/intersects.h"
 #include "software/world/team.h"
@@ -23,23 +22,16 @@ std::map<Robot, std::vector<Robot>, Robot::cmpRobotByID> findAllReceiverPasserPa
     {
         for (const auto &receiver : possible_receivers)
         {
-            // Create a vector of obstacles that includes all robots except the
-            // current passer and receiver
-            std::vector<Robot> obstacles = all_robots;
-            obstacles.erase(std::remove(obstacles.begin(), obstacles.end(), passer),
-                            obstacles.end());
-            obstacles.erase(std::remove(obstacles.begin(), obstacles.end(), receiver),
-                            obstacles.end());
-
             // Check if the pass from the passer to the receiver would be blocked by any
-            // robots
-            bool pass_blocked =
-                std::any_of(obstacles.begin(), obstacles.end(),
-                            [passer, receiver](const Robot &obstacle) {
-                                return intersects(
-                                    Circle(obstacle.position(), ROBOT_MAX_RADIUS_METERS),
-                                    Segment(passer.position(), receiver.position()));
-                            });
+            // robots other than the passer and receiver
+            const Segment pass(passer.position(), receiver.position());
+            bool pass_blocked = std::any_of(
+                all_robots.begin(), all_robots.end(), [&](const Robot &obstacle) {
+                    return obstacle != passer && obstacle != receiver &&
+                           intersects(Circle(obstacle.position(),
+                                             ROBOT_MAX_RADIUS_METERS),
+                                      pass);
+                });
 
             if (!pass_blocked)
             {
@@ -75,89 +67,13 @@ std::optional<std::pair<int, std::optional<Robot>>> getNumPassesToRobot(
 
     // We calculate the minimum number of passes it would take for the initial_passer
     // robot to pass the ball to the final_receiver, assuming both robots are on the given
-    // team
+    // team, by searching the graph of passes between the robots on the team
     //
-    // This algorithm essentially treats the team of robots like a Directed Acyclic
-    // Graph and "traverses" the graph to find the shortest path to the robot
-
-    // The robots that could have the ball and make a pass at each iteration. They
-    // are on the "frontier" of the graph search
-    std::vector<Robot> current_passers{initial_passer};
-    // The remaining robots we haven't checked yet
-    std::vector<Robot> unvisited_robots = passing_team.getAllRobots();
-    // Remove the initial passer since we already start off visiting it, and don't need
-    // to again
-    unvisited_robots.erase(
-        std::remove(unvisited_robots.begin(), unvisited_robots.end(), initial_passer),
-        unvisited_robots.end());
-    std::vector<Robot> all_robots   = passing_team.getAllRobots();
-    std::vector<Robot> other_robots = other_team.getAllRobots();
     // TODO: possibly re-enable using friendly robots as obstacles if we can find a way to
     // stop defenders from oscillating between positions See
     // https://github.com/UBC-Thunderbots/Software/issues/642
-    // all_robots.insert(all_robots.end(), other_robots.begin(), other_robots.end());
-
-    // On each iteration, check what robots can be passed to. These receivers will
-    // become the passers on the next iteration. This is like expanding the frontier
-    // of the graph
-    //
-    // We continue to iterate and check greater numbers of passes until one of the
-    // following cases:
-    // * There are no more passers at the end of the iteration. This means no more
-    //   unvisited robots can be passed to
-    // * There are no more unvisited robots
-    // * We have iterated up to the size of the team. This is a fallback case to
-    //   prevent any infinite loops, just in case
-    //
-    // We already check the case where the passer and receiver are the same. If this was
-    // the case, 0 passes would be required. Since that case is already checked, when we
-    // start the loop we are checking for the possibility of the receiver getting the ball
-    // in 1 pass. This is why pass_num starts at 1.
-    for (unsigned pass_num = 1; pass_num < passing_team.numRobots() &&
-                                !current_passers.empty() && !unvisited_robots.empty();
-         pass_num++)
-    {
-        std::map<Robot, std::vector<Robot>, Robot::cmpRobotByID> receiver_passer_pairs =
-            findAllReceiverPasserPairs(current_passers, unvisited_robots, all_robots);
-
-        // If the robot we are looking for is a receiver, return the number of
-        // passes and the passer to this robot
-        if (receiver_passer_pairs.count(final_receiver) > 0)
-        {
-            // If there are multiple robots that can pass to the robot, we assume
-            // it will receive the ball from the closest one since this is more
-            // likely
-            auto closest_passer = Team::getNearestRobot(
-                receiver_passer_pairs.at(final_receiver), final_receiver.position());
-            return std::make_pair(pass_num, closest_passer);
-        }
-
-        // Create a list of all robots that could receive the ball this iteration
-        std::vector<Robot> all_receivers;
-        for (auto it = receiver_passer_pairs.begin(); it != receiver_passer_pairs.end();
-             it++)
-        {
-            all_receivers.emplace_back(it->first);
-        }
-
-        // All robots that could have received the ball now become passers
-        current_passers = all_receivers;
-
-        // Remove any receivers from the unvisited robots, since they have
-        // now been visited
-        unvisited_robots.erase(remove_if(unvisited_robots.begin(), unvisited_robots.end(),
-                                         [&](auto x) {
-                                             return find(all_receivers.begin(),
-                                                         all_receivers.end(),
-                                                         x) != all_receivers.end();
-                                         }),
-                               unvisited_robots.end());
-    }
-
-    // If we have checked all the robots we can and still haven't found the robot we
-    // are looking for, it must be blocked and unable to be passed to in the current
-    // state. Therefore, we return an std::nullopt
-    return std::nullopt;
+    return PassVisibilityGraph(passing_team.getAllRobots())
+        .getNumPassesToRobot(initial_passer, final_receiver);
 }
 
 void sortThreatsInDecreasingOrder(std::vector<EnemyThreat> &threats)
@@ -229,6 +145,12 @@ std::vector<EnemyThreat> getAllEnemyThreats(const Field &field, const Team &frie
 
     std::vector<EnemyThreat> threats;
 
+    // The robot with possession and the passes between the enemy robots are the
+    // same for every threat, so they are only found once
+    const auto robot_with_effective_possession =
+        getRobotWithEffectiveBallPossession(enemy_team, ball, field);
+    const PassVisibilityGraph pass_graph(enemy_team.getAllRobots());
+
     for (const auto &robot : enemy_team.getAllRobots())
     {
         bool has_ball = robot.isNearDribbler(ball.position());
@@ -257,12 +179,10 @@ std::vector<EnemyThreat> getAllEnemyThreats(const Field &field, const Team &frie
         // passer to be an empty optional
         int num_passes              = static_cast<int>(enemy_team.numRobots());
         std::optional<Robot> passer = std::nullopt;
-        auto robot_with_effective_possession =
-            getRobotWithEffectiveBallPossession(enemy_team, ball, field);
         if (robot_with_effective_possession)
         {
-            auto pass_data = getNumPassesToRobot(robot_with_effective_possession.value(),
-                                                 robot, enemy_team, friendly_team);
+            auto pass_data = pass_graph.getNumPassesToRobot(
+                robot_with_effective_possession.value(), robot);
             if (pass_data)
             {
                 num_passes = pass_data->first;
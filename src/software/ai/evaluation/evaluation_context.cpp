@@ -0,0 +1,182 @@
+#include "software/ai/evaluation/evaluation_context.h"
+
+#include <Tracy.hpp>
+
+#include "software/ai/evaluation/calc_best_shot.h"
+#include "software/ai/evaluation/find_open_areas.h"
+#include "software/logger/logger.h"
+
+namespace
+{
+    std::mutex contexts_mutex;
+
+    // The context for each world that is still alive, keyed by the world's control
+    // block so that a new world can never be mistaken for one that was destroyed
+    std::map<std::weak_ptr<const World>, std::shared_ptr<EvaluationContext>,
+             std::owner_less<std::weak_ptr<const World>>>
+        contexts;
+}  // namespace
+
+template <typename Key, typename Value>
+EvaluationContext::Memo<Key, Value>::Memo(const char *hit_rate_plot_name)
+    : hit_rate_plot_name(hit_rate_plot_name), hits(0), misses(0)
+{
+}
+
+template <typename Key, typename Value>
+template <typename Calculate>
+Value EvaluationContext::Memo<Key, Value>::getOrCalculate(
+    const Key &key, Calculate calculate, std::atomic<unsigned int> &total_hits,
+    std::atomic<unsigned int> &total_misses)
+{
+    {
+        std::scoped_lock lock(mutex);
+        auto it = values.find(key);
+        if (it != values.end())
+        {
+            hits++;
+            total_hits++;
+            TracyPlot(hit_rate_plot_name, static_cast<double>(hits) / (hits + misses));
+            return it->second;
+        }
+    }
+
+    // The evaluation is calculated without holding the lock, so that different
+    // evaluations can be calculated in parallel. If two threads calculate the same
+    // evaluation at once, the result of the first one is kept.
+    Value value = calculate();
+
+    std::scoped_lock lock(mutex);
+    misses++;
+    total_misses++;
+    TracyPlot(hit_rate_plot_name, static_cast<double>(hits) / (hits + misses));
+    return values.emplace(key, std::move(value)).first->second;
+}
+
+EvaluationContext::EvaluationContext(const WorldPtr &world_ptr)
+    : world(world_ptr),
+      world_timestamp(world_ptr->getMostRecentTimestamp()),
+      total_hits(0),
+      total_misses(0),
+      best_shots("EvaluationContext: calcBestShotOnGoal hit rate"),
+      shot_openness_maps("EvaluationContext: getShotOpennessMap hit rate"),
+      enemy_threats("EvaluationContext: getAllEnemyThreats hit rate"),
+      chip_targets("EvaluationContext: findGoodChipTargets hit rate")
+{
+}
+
+std::shared_ptr<EvaluationContext> EvaluationContext::get(const WorldPtr &world_ptr)
+{
+    std::scoped_lock lock(contexts_mutex);
+
+    // Drop the contexts of worlds that have been destroyed
+    for (auto it = contexts.begin(); it != contexts.end();)
+    {
+        it = it->first.expired() ? contexts.erase(it) : std::next(it);
+    }
+
+    // A world that was modified after it was evaluated gets a new context, since the
+    // cached results no longer apply to it
+    std::shared_ptr<EvaluationContext> &context = contexts[world_ptr];
+    if (!context || context->world_timestamp != world_ptr->getMostRecentTimestamp())
+    {
+        context = std::make_shared<EvaluationContext>(world_ptr);
+    }
+    return context;
+}
+
+std::optional<Shot> EvaluationContext::calcBestShotOnGoal(
+    const Point &shot_origin, TeamType goal, const std::vector<Robot> &robots_to_ignore,
+    double radius)
+{
+    std::vector<RobotKey> robots_to_ignore_keys;
+    for (const Robot &robot : robots_to_ignore)
+    {
+        robots_to_ignore_keys.emplace_back(robotKey(robot));
+    }
+
+    WorldPtr world_ptr = getWorld();
+    return best_shots.getOrCalculate(
+        {shot_origin.x(), shot_origin.y(), goal, robots_to_ignore_keys, radius},
+        [&]() {
+            return ::calcBestShotOnGoal(world_ptr->field(), world_ptr->friendlyTeam(),
+                                        world_ptr->enemyTeam(), shot_origin, goal,
+                                        robots_to_ignore, radius);
+        },
+        total_hits, total_misses);
+}
+
+std::shared_ptr<const ShotOpennessMap> EvaluationContext::getShotOpennessMap(
+    TeamType goal, double resolution)
+{
+    WorldPtr world_ptr = getWorld();
+    return shot_openness_maps.getOrCalculate(
+        {goal, resolution},
+        [&]() {
+            const Team &defending_team = goal == TeamType::ENEMY
+                                             ? world_ptr->enemyTeam()
+                                             : world_ptr->friendlyTeam();
+            return std::make_shared<const ShotOpennessMap>(
+                world_ptr->field(), defending_team.getAllRobots(), goal, resolution);
+        },
+        total_hits, total_misses);
+}
+
+std::vector<EnemyThreat> EvaluationContext::getAllEnemyThreats(bool include_goalie)
+{
+    WorldPtr world_ptr = getWorld();
+    return enemy_threats.getOrCalculate(
+        include_goalie,
+        [&]() {
+            return ::getAllEnemyThreats(world_ptr->field(), world_ptr->friendlyTeam(),
+                                        world_ptr->enemyTeam(), world_ptr->ball(),
+                                        include_goalie);
+        },
+        total_hits, total_misses);
+}
+
+std::vector<Circle> EvaluationContext::findGoodChipTargets(
+    const std::optional<Rectangle> &target_area)
+{
+    std::optional<std::tuple<double, double, double, double>> target_area_key;
+    if (target_area)
+    {
+        target_area_key = std::make_tuple(target_area->xMin(), target_area->yMin(),
+                                          target_area->xMax(), target_area->yMax());
+    }
+
+    WorldPtr world_ptr = getWorld();
+    return chip_targets.getOrCalculate(
+        target_area_key,
+        [&]() {
+            return target_area ? ::findGoodChipTargets(*world_ptr, *target_area)
+                               : ::findGoodChipTargets(*world_ptr);
+        },
+        total_hits, total_misses);
+}
+
+unsigned int EvaluationContext::numCacheHits() const
+{
+    return total_hits;
+}
+
+unsigned int EvaluationContext::numCacheMisses() const
+{
+    return total_misses;
+}
+
+WorldPtr EvaluationContext::getWorld() const
+{
+    WorldPtr world_ptr = world.lock();
+    CHECK(world_ptr != nullptr)
+        << "EvaluationContext was evaluated after its World was destroyed";
+    return world_ptr;
+}
+
+EvaluationContext::RobotKey EvaluationContext::robotKey(const Robot &robot)
+{
+    return std::make_tuple(robot.id(), robot.position().x(), robot.position().y(),
+                           robot.velocity().x(), robot.velocity().y(),
+                           robot.orientation().toRadians(),
+                           robot.angularVelocity().toRadians());
+}
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#include "shared/constants.h"
+#include "software/ai/evaluation/enemy_threat.h"
+#include "software/ai/evaluation/shot.h"
+#include "software/ai/evaluation/shot_openness_map.h"
+#include "software/geom/circle.h"
+#include "software/geom/rectangle.h"
+#include "software/world/world.h"
+
+/**
+ * Memoizes the evaluations that are used by several tactics and plays in the same
+ * tick, for a single World.
+ *
+ * Every evaluation is calculated the first time it is requested with a given set of
+ * arguments, after which the result is returned from the cache. The context for a
+ * World is shared through `get`, so that every tactic and play that is given the same
+ * WorldPtr shares the same results. The hit rate of each evaluation is plotted in
+ * Tracy.
+ *
+ * The cached results are only valid while the World stays the same, so a World must
+ * not be modified once it has been evaluated. `get` starts a new context for a World
+ * whose most recent timestamp has changed, but changes that keep the timestamp are
+ * not detected.
+ *
+ * This is thread-safe.
+ */
+class EvaluationContext
+{
+   public:
+    EvaluationContext() = delete;
+
+    /**
+     * Creates a context for the given world. The context only holds a weak reference
+     * to the world, so that registering the context does not keep the world alive.
+     * The world must not be destroyed while the context is still being evaluated.
+     *
+     * @param world_ptr The world to evaluate
+     */
+    explicit EvaluationContext(const WorldPtr &world_ptr);
+
+    /**
+     * Gets the context for the given world, creating it if this is the first time it
+     * is requested or if the world's most recent timestamp has changed since its
+     * context was created. A world's context is dropped once the world is destroyed.
+     *
+     * @param world_ptr The world to get the context for
+     *
+     * @return The context for the world
+     */
+    static std::shared_ptr<EvaluationContext> get(const WorldPtr &world_ptr);
+
+    /**
+     * Calculates the best shot on the given goal, treating every robot in the world
+     * except the robots_to_ignore as obstacles. See calcBestShotOnGoal.
+     *
+     * @param shot_origin The point that the shot will be taken from
+     * @param goal The goal to shoot at
+     * @param robots_to_ignore The robots to ignore
+     * @param radius The radius for the robot obstacles
+     *
+     * @return the best shot, or std::nullopt if there is no shot
+     */
+    std::optional<Shot> calcBestShotOnGoal(
+        const Point &shot_origin, TeamType goal,
+        const std::vector<Robot> &robots_to_ignore = {},
+        double radius = ROBOT_MAX_RADIUS_METERS);
+
+    /**
+     * Gets a map of the open angle to the given goal, with the robots of the team
+     * defending the goal as obstacles. See ShotOpennessMap.
+     *
+     * @param goal The goal to shoot at
+     * @param resolution The distance between neighbouring samples of the map, in
+     * meters
+     *
+     * @return The map
+     */
+    std::shared_ptr<const ShotOpennessMap> getShotOpennessMap(TeamType goal,
+                                                              double resolution);
+
+    /**
+     * Calculates the threat of each enemy robot. See getAllEnemyThreats.
+     *
+     * @param include_goalie Whether or not to include the enemy goalie
+     *
+     * @return A list of EnemyThreats in order of decreasing threat
+     */
+    std::vector<EnemyThreat> getAllEnemyThreats(bool include_goalie);
+
+    /**
+     * Finds good points to chip the ball to. See findGoodChipTargets.
+     *
+     * @param target_area The area on the field that chip targets are restrained to, or
+     * std::nullopt for the whole field
+     *
+     * @return circles centered on good points to chip to
+     */
+    std::vector<Circle> findGoodChipTargets(
+        const std::optional<Rectangle> &target_area = std::nullopt);
+
+    /**
+     * Gets the number of evaluations that were returned from the cache
+     *
+     * @return The number of cache hits over all evaluations
+     */
+    unsigned int numCacheHits() const;
+
+    /**
+     * Gets the number of evaluations that were calculated
+     *
+     * @return The number of cache misses over all evaluations
+     */
+    unsigned int numCacheMisses() const;
+
+   private:
+    // The parts of a robot that are compared by Robot::operator==, exactly, so that
+    // robots can be used in cache keys
+    using RobotKey = std::tuple<RobotId, double, double, double, double, double, double>;
+
+    /**
+     * The cached results of a single evaluation, keyed by its arguments
+     */
+    template <typename Key, typename Value>
+    class Memo
+    {
+       public:
+        /**
+         * Creates an empty cache
+         *
+         * @param hit_rate_plot_name The name of the Tracy plot for the hit rate, which
+         * must be a string literal
+         */
+        explicit Memo(const char *hit_rate_plot_name);
+
+        /**
+         * Gets the cached result for the given key, calculating and caching it first
+         * if it has not been calculated
+         *
+         * @param key The arguments of the evaluation
+         * @param calculate Calculates the result of the evaluation
+         * @param total_hits Counts the cache hits over all evaluations
+         * @param total_misses Counts the cache misses over all evaluations
+         *
+         * @return The result of the evaluation
+         */
+        template <typename Calculate>
+        Value getOrCalculate(const Key &key, Calculate calculate,
+                             std::atomic<unsigned int> &total_hits,
+                             std::atomic<unsigned int> &total_misses);
+
+       private:
+        const char *hit_rate_plot_name;
+        std::mutex mutex;
+        std::map<Key, Value> values;
+        unsigned int hits;
+        unsigned int misses;
+    };
+
+    /**
+     * Gets the key for the given robot
+     *
+     * @param robot The robot
+     *
+     * @return The key for the robot
+     */
+    static RobotKey robotKey(const Robot &robot);
+
+    /**
+     * Gets the world that this context evaluates, checking that it has not been
+     * destroyed
+     *
+     * @return The world
+     */
+    WorldPtr getWorld() const;
+
+    std::weak_ptr<const World> world;
+
+    // The most recent timestamp of the world when this context was created
+    const Timestamp world_timestamp;
+
+    std::atomic<unsigned int> total_hits;
+    std::atomic<unsigned int> total_misses;
+
+    Memo<std::tuple<double, double, TeamType, std::vector<RobotKey>, double>,
+         std::optional<Shot>>
+        best_shots;
+    Memo<std::tuple<TeamType, double>, std::shared_ptr<const ShotOpennessMap>>
+        shot_openness_maps;
+    Memo<bool, std::vector<EnemyThreat>> enemy_threats;
+    Memo<std::optional<std::tuple<double, double, double, double>>,
+         std::vector<Circle>>
+        chip_targets;
+};
@@ -0,0 +1,178 @@
+#include "software/ai/evaluation/evaluation_context.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "software/ai/evaluation/calc_best_shot.h"
+#include "software/ai/evaluation/find_open_areas.h"
+#include "software/test_util/test_util.h"
+
+class EvaluationContextTest : public testing::Test
+{
+   protected:
+    EvaluationContextTest() : world(::TestUtil::createBlankTestingWorld())
+    {
+        ::TestUtil::setFriendlyRobotPositions(
+            world, {Point(-4, 0), Point(-1, 1), Point(0.5, -1)},
+            Timestamp::fromSeconds(0));
+        ::TestUtil::setEnemyRobotPositions(
+            world, {Point(4, 0.2), Point(2, 1), Point(1, -0.5), Point(3, -2)},
+            Timestamp::fromSeconds(0));
+        ::TestUtil::setBallPosition(world, Point(0, 0), Timestamp::fromSeconds(0));
+    }
+
+    std::shared_ptr<World> world;
+};
+
+TEST_F(EvaluationContextTest, get_shares_context_for_same_world)
+{
+    WorldPtr world_ptr = world;
+    auto context       = EvaluationContext::get(world_ptr);
+
+    EXPECT_EQ(context, EvaluationContext::get(world_ptr));
+
+    WorldPtr other_world_ptr = std::make_shared<const World>(*world);
+    EXPECT_NE(context, EvaluationContext::get(other_world_ptr));
+}
+
+TEST_F(EvaluationContextTest, context_is_dropped_with_world)
+{
+    std::weak_ptr<EvaluationContext> context;
+    {
+        WorldPtr world_ptr = std::make_shared<const World>(*world);
+        context            = EvaluationContext::get(world_ptr);
+    }
+
+    // Contexts of destroyed worlds are dropped when the next context is requested
+    EvaluationContext::get(world);
+    EXPECT_TRUE(context.expired());
+}
+
+TEST_F(EvaluationContextTest, context_does_not_keep_world_alive)
+{
+    WorldPtr world_ptr                         = std::make_shared<const World>(*world);
+    std::weak_ptr<const World> weak_world_ptr  = world_ptr;
+    std::shared_ptr<EvaluationContext> context = EvaluationContext::get(world_ptr);
+
+    world_ptr.reset();
+    EXPECT_TRUE(weak_world_ptr.expired());
+}
+
+TEST_F(EvaluationContextTest, new_context_is_created_when_world_is_updated)
+{
+    auto context = EvaluationContext::get(world);
+    context->getAllEnemyThreats(false);
+
+    ::TestUtil::setBallPosition(world, Point(3, 1), Timestamp::fromSeconds(1));
+    auto updated_context = EvaluationContext::get(world);
+
+    EXPECT_NE(context, updated_context);
+    EXPECT_EQ(updated_context, EvaluationContext::get(world));
+    EXPECT_EQ(getAllEnemyThreats(world->field(), world->friendlyTeam(),
+                                 world->enemyTeam(), world->ball(), false),
+              updated_context->getAllEnemyThreats(false));
+    EXPECT_EQ(0u, updated_context->numCacheHits());
+}
+
+TEST_F(EvaluationContextTest, best_shot_is_calculated_once_per_arguments)
+{
+    EvaluationContext context(world);
+    Robot shooter = world->friendlyTeam().getAllRobots().at(2);
+
+    auto expected_shot =
+        calcBestShotOnGoal(world->field(), world->friendlyTeam(), world->enemyTeam(),
+                           shooter.position(), TeamType::ENEMY, {shooter});
+
+    auto shot =
+        context.calcBestShotOnGoal(shooter.position(), TeamType::ENEMY, {shooter});
+    ASSERT_TRUE(shot);
+    EXPECT_EQ(expected_shot->getPointToShootAt(), shot->getPointToShootAt());
+    EXPECT_EQ(expected_shot->getOpenAngle(), shot->getOpenAngle());
+    EXPECT_EQ(0u, context.numCacheHits());
+    EXPECT_EQ(1u, context.numCacheMisses());
+
+    shot = context.calcBestShotOnGoal(shooter.position(), TeamType::ENEMY, {shooter});
+    ASSERT_TRUE(shot);
+    EXPECT_EQ(expected_shot->getPointToShootAt(), shot->getPointToShootAt());
+    EXPECT_EQ(1u, context.numCacheHits());
+    EXPECT_EQ(1u, context.numCacheMisses());
+
+    // Not ignoring the shooter, which blocks its own shot, is a different evaluation
+    context.calcBestShotOnGoal(shooter.position(), TeamType::ENEMY);
+    EXPECT_EQ(1u, context.numCacheHits());
+    EXPECT_EQ(2u, context.numCacheMisses());
+}
+
+TEST_F(EvaluationContextTest, shot_openness_map_is_built_once_per_goal_and_resolution)
+{
+    EvaluationContext context(world);
+
+    auto enemy_goal_map = context.getShotOpennessMap(TeamType::ENEMY, 0.1);
+    EXPECT_EQ(enemy_goal_map, context.getShotOpennessMap(TeamType::ENEMY, 0.1));
+    EXPECT_NE(enemy_goal_map, context.getShotOpennessMap(TeamType::FRIENDLY, 0.1));
+    EXPECT_NE(enemy_goal_map, context.getShotOpennessMap(TeamType::ENEMY, 0.2));
+    EXPECT_EQ(1u, context.numCacheHits());
+    EXPECT_EQ(3u, context.numCacheMisses());
+
+    // The enemy robots are the obstacles for shots on the enemy goal
+    const ShotOpennessMap expected_map(world->field(), world->enemyTeam().getAllRobots(),
+                                       TeamType::ENEMY, 0.1);
+    for (const Point& point : {Point(0, 0), Point(2.5, 0.5), Point(-1, -2)})
+    {
+        EXPECT_EQ(expected_map.getOpenAngleDegrees(point.x(), point.y()),
+                  enemy_goal_map->getOpenAngleDegrees(point.x(), point.y()));
+    }
+}
+
+TEST_F(EvaluationContextTest, evaluations_match_uncached_evaluations)
+{
+    EvaluationContext context(world);
+
+    for (int i = 0; i < 2; i++)
+    {
+        EXPECT_EQ(getAllEnemyThreats(world->field(), world->friendlyTeam(),
+                                     world->enemyTeam(), world->ball(), false),
+                  context.getAllEnemyThreats(false));
+
+        Rectangle target_area(Point(0, -2), Point(4, 2));
+        auto chip_targets          = context.findGoodChipTargets(target_area);
+        auto expected_chip_targets = findGoodChipTargets(*world, target_area);
+        ASSERT_EQ(expected_chip_targets.size(), chip_targets.size());
+        for (size_t j = 0; j < chip_targets.size(); j++)
+        {
+            EXPECT_EQ(expected_chip_targets[j], chip_targets[j]);
+        }
+    }
+
+    EXPECT_EQ(2u, context.numCacheHits());
+    EXPECT_EQ(2u, context.numCacheMisses());
+}
+
+TEST_F(EvaluationContextTest, evaluations_are_shared_between_threads)
+{
+    EvaluationContext context(world);
+    Robot shooter = world->friendlyTeam().getAllRobots().at(2);
+
+    std::vector<std::optional<Shot>> shots(8);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < shots.size(); i++)
+    {
+        threads.emplace_back([&, i]() {
+            shots[i] = context.calcBestShotOnGoal(shooter.position(), TeamType::ENEMY,
+                                                  {shooter});
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (const std::optional<Shot> &shot : shots)
+    {
+        ASSERT_TRUE(shot);
+        EXPECT_EQ(shots[0]->getPointToShootAt(), shot->getPointToShootAt());
+    }
+    EXPECT_EQ(shots.size(), context.numCacheHits() + context.numCacheMisses());
+    EXPECT_LE(1u, context.numCacheMisses());
+}
@@ -1,88 +1,302 @@
 #include "software/ai/evaluation/intercept.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include "shared/constants.h"
 #include "software/ai/evaluation/time_to_travel.h"
 #include "software/geom/algorithms/contains.h"
-#include "software/optimization/gradient_descent_optimizer.hpp"
 
-std::optional<std::pair<Point, Duration>> findBestInterceptForBall(const Ball &ball,
-                                                                   const Field &field,
-                                                                   const Robot &robot)
+namespace
 {
-    static const double gradient_approx_step_size = 0.000001;
+    // The furthest the ball may travel between two of the samples that are used to
+    // bracket the earliest intercept time
+    constexpr double SAMPLE_DISTANCE_METERS = 0.1;
 
-    // We use this to take a smooth absolute value in our objective function
-    static const double smooth_abs_eps = 1000 * gradient_approx_step_size;
+    // The longest time between two samples, which bounds the number of samples for a
+    // ball that is moving very slowly
+    constexpr double MAX_SAMPLE_PERIOD_SECONDS = 0.5;
 
-    // This is the objective function that we want to minimize, finding the
-    // shortest duration in the future at which we can feasibly intercept the
-    // ball
-    auto objective_function = [&](std::array<double, 1> x) {
-        // We take the absolute value here because a negative time makes no sense
-        double duration = std::abs(x.at(0));
+    // How far into the future the ball is followed when it stays on the field
+    constexpr double MAX_INTERCEPT_TIME_SECONDS = 20.0;
 
-        // If the ball timestamp is less then the robot timestamp, add the difference
-        // here so that we're optimizing to a duration that is after the robot
-        // timestamp
-        if (ball.timestamp() < robot.timestamp())
+    // The intercept time is found to within this tolerance
+    constexpr double INTERCEPT_TIME_TOLERANCE_SECONDS = 1e-6;
+
+    /**
+     * The path of a ball, sampled from the ball's timestamp until it leaves the field,
+     * comes to rest, or MAX_INTERCEPT_TIME_SECONDS passes, whichever is first
+     *
+     * A ball that starts outside the field is followed until it enters the field, and
+     * only leaving the field after that ends the path.
+     *
+     * The ball is predicted with Ball::estimateFutureState, which is a polynomial in
+     * time for the ball's constant acceleration, until the ball comes to rest. If the
+     * acceleration opposes the velocity (ie. it is friction), the ball stays where it
+     * came to rest instead of accelerating backwards.
+     */
+    class BallTrajectory
+    {
+       public:
+        BallTrajectory(const Ball &ball, const Field &field) : ball(ball)
+        {
+            const Vector velocity     = ball.velocity();
+            const Vector acceleration = ball.acceleration();
+            const double speed        = velocity.length();
+
+            rest_time = std::numeric_limits<double>::infinity();
+            if (speed == 0)
+            {
+                rest_time = 0;
+            }
+            else if (velocity.dot(acceleration) < 0 &&
+                     std::abs(velocity.cross(acceleration)) <=
+                         1e-9 * speed * acceleration.length())
+            {
+                rest_time = speed / acceleration.length();
+            }
+
+            field_entry_time = std::numeric_limits<double>::infinity();
+            if (contains(field.fieldLines(), ball.position()))
+            {
+                field_entry_time = 0;
+            }
+
+            const double end_time = std::min(rest_time, MAX_INTERCEPT_TIME_SECONDS);
+            const double sample_period =
+                speed == 0 ? MAX_SAMPLE_PERIOD_SECONDS
+                           : std::min(SAMPLE_DISTANCE_METERS / speed,
+                                      MAX_SAMPLE_PERIOD_SECONDS);
+            for (size_t k = 1; k * sample_period < end_time; k++)
+            {
+                const double t = k * sample_period;
+                const Point p  = position(t);
+                sample_times.push_back(t);
+                sample_positions.push_back(p);
+
+                const bool on_field = contains(field.fieldLines(), p);
+                if (on_field && std::isinf(field_entry_time))
+                {
+                    field_entry_time =
+                        findFieldEntryTime(field, (k - 1) * sample_period, t);
+                }
+
+                // The ball leaving the field ends the search for an intercept, but the
+                // first sample outside the field still brackets the intercepts inside
+                // the field that come after the previous sample
+                if (!on_field && !std::isinf(field_entry_time))
+                {
+                    ends_outside_field = true;
+                    break;
+                }
+            }
+
+            // A ball that comes to rest between the last sample and the end time may
+            // still roll onto the field
+            if (std::isinf(field_entry_time) && !ends_outside_field &&
+                rest_time <= MAX_INTERCEPT_TIME_SECONDS &&
+                contains(field.fieldLines(), position(rest_time)))
+            {
+                const double last_sample_time =
+                    sample_times.empty() ? 0 : sample_times.back();
+                field_entry_time = findFieldEntryTime(field, last_sample_time, rest_time);
+            }
+        }
+
+        /**
+         * Gets the position of the ball at the given time after its timestamp
+         *
+         * @param t The time after the ball's timestamp, in seconds
+         *
+         * @return The position of the ball
+         */
+        Point position(double t) const
         {
-            duration += (robot.timestamp() - ball.timestamp()).toSeconds();
+            return ball.estimateFutureState(Duration::fromSeconds(std::min(t, rest_time)))
+                .position();
         }
 
-        // Estimate the ball position
-        Point new_ball_pos =
-            ball.estimateFutureState(Duration::fromSeconds(duration)).position();
+        // The time after the ball's timestamp at which it comes to rest, in seconds, or
+        // infinity if it never does
+        double rest_time;
 
-        // Figure out how long it will take the robot to get to the new ball position
-        Duration time_to_ball_pos = robot.getTimeToPosition(new_ball_pos);
+        // The positions of the ball at increasing times after its timestamp, in seconds,
+        // excluding the ball's timestamp itself
+        std::vector<double> sample_times;
+        std::vector<Point> sample_positions;
 
-        // Figure out when the robot will reach the new ball position relative to the
-        // time that the ball will get there (ie. will we get there in time?)
-        double ball_robot_time_diff = duration - time_to_ball_pos.toSeconds();
+        // The time after the ball's timestamp at which it is first on the field, in
+        // seconds, or infinity if it never is
+        double field_entry_time;
 
-        // We want to get to the ball at the earliest opportunity possible, so
-        // aim for a time diff of zero. We use a smooth approximation of
-        // the maximum here
-        return std::sqrt(std::pow(ball_robot_time_diff, 2) + smooth_abs_eps);
+        // Whether the last sample is outside the field, after the ball has been on the
+        // field, so that the ball can not be intercepted on the field after it
+        bool ends_outside_field = false;
+
+       private:
+        /**
+         * Finds the time at which the ball enters the field between a time at which it
+         * is outside the field and a later time at which it is on the field
+         *
+         * @param field The field
+         * @param outside_time A time at which the ball is outside the field, in seconds
+         * @param on_field_time A later time at which the ball is on the field, in
+         * seconds
+         *
+         * @return The earliest time, to within INTERCEPT_TIME_TOLERANCE_SECONDS, at
+         * which the ball is on the field
+         */
+        double findFieldEntryTime(const Field &field, double outside_time,
+                                  double on_field_time) const
+        {
+            while (on_field_time - outside_time > INTERCEPT_TIME_TOLERANCE_SECONDS)
+            {
+                const double mid = (outside_time + on_field_time) / 2;
+                if (contains(field.fieldLines(), position(mid)))
+                {
+                    on_field_time = mid;
+                }
+                else
+                {
+                    outside_time = mid;
+                }
+            }
+            return on_field_time;
+        }
+
+        Ball ball;
     };
 
-    // Figure out when/where to intercept the ball. We do this by optimizing over
-    // the ball position as a function of it's travel time
-    // We make the weight here an inverse of the ball speed, so that the gradient
-    // descent takes smaller steps when the ball is moving faster
-    double descent_weight = 1 / (std::exp(ball.currentState().velocity().length() * 0.5));
-    GradientDescentOptimizer<1> optimizer({descent_weight}, gradient_approx_step_size);
-    Duration best_ball_travel_duration = Duration::fromSeconds(
-        std::abs(optimizer.minimize(objective_function, {0}, 50).at(0)));
-
-    // In the objective function above, if the robot timestamp > ball timestamp, we
-    // add on the difference so we get a intercept time after the robot timestamp, so
-    // we need to do the same here to get the duration we actually optimized on
-    if (robot.timestamp() > ball.timestamp())
+    /**
+     * Finds the earliest time at which the given robot can be where the ball is, no
+     * later than the ball
+     *
+     * @param trajectory The path of the ball
+     * @param robot The robot to intercept the ball with
+     * @param time_offset The time the robot's timestamp is after the ball's, in
+     * seconds. Intercepts are only found after the robot's timestamp.
+     *
+     * @return The intercept time after the ball's timestamp, in seconds, if the robot
+     * can intercept the ball after it enters the field and before it leaves it
+     */
+    std::optional<double> findEarliestInterceptTime(const BallTrajectory &trajectory,
+                                                    const Robot &robot,
+                                                    double time_offset)
     {
-        best_ball_travel_duration =
-            best_ball_travel_duration + (robot.timestamp() - ball.timestamp());
-    }
+        // How much earlier the robot can be at the ball's position at time t than the
+        // ball. This increases through zero at an intercept time, which is bracketed
+        // between the samples of the ball trajectory and then found by bisection.
+        auto time_diff = [&](double t, const Point &ball_position) {
+            return (t - time_offset) - robot.getTimeToPosition(ball_position).toSeconds();
+        };
+        auto bisect = [&](double early, double late) {
+            while (late - early > INTERCEPT_TIME_TOLERANCE_SECONDS)
+            {
+                const double mid = (early + late) / 2;
+                if (time_diff(mid, trajectory.position(mid)) >= 0)
+                {
+                    late = mid;
+                }
+                else
+                {
+                    early = mid;
+                }
+            }
+            return late;
+        };
 
-    Point best_ball_intercept_pos =
-        ball.estimateFutureState(best_ball_travel_duration).position();
+        // Intercepts are only found once the ball is on the field
+        const double start_time = std::max(time_offset, trajectory.field_entry_time);
+        if (std::isinf(start_time))
+        {
+            return std::nullopt;
+        }
 
-    // Check that we can get to the best position in time
-    Duration time_to_ball_pos     = robot.getTimeToPosition(best_ball_intercept_pos);
-    Duration ball_robot_time_diff = time_to_ball_pos - best_ball_travel_duration;
-    // NOTE: if ball velocity is 0 then ball travel duration is infinite, so this
-    // check isn't relevant in that case
-    if (ball.currentState().velocity().length() != 0 &&
-        std::abs(ball_robot_time_diff.toSeconds()) > descent_weight)
-    {
-        return std::nullopt;
+        double latest_infeasible_time = start_time;
+        if (time_diff(start_time, trajectory.position(start_time)) >= 0)
+        {
+            return start_time;
+        }
+
+        const auto first_sample = std::upper_bound(
+            trajectory.sample_times.begin(), trajectory.sample_times.end(), start_time);
+        for (size_t k = first_sample - trajectory.sample_times.begin();
+             k < trajectory.sample_times.size(); k++)
+        {
+            const double t = trajectory.sample_times[k];
+            if (time_diff(t, trajectory.sample_positions[k]) >= 0)
+            {
+                return bisect(latest_infeasible_time, t);
+            }
+            latest_infeasible_time = t;
+        }
+
+        if (trajectory.ends_outside_field ||
+            trajectory.rest_time > MAX_INTERCEPT_TIME_SECONDS)
+        {
+            return std::nullopt;
+        }
+
+        // The ball comes to rest on the field, after which the time difference increases
+        // at the same rate as time, so the robot intercepts it where it came to rest
+        const Point rest_position = trajectory.position(trajectory.rest_time);
+        if (latest_infeasible_time < trajectory.rest_time &&
+            time_diff(trajectory.rest_time, rest_position) >= 0)
+        {
+            return bisect(latest_infeasible_time, trajectory.rest_time);
+        }
+        return time_offset + robot.getTimeToPosition(rest_position).toSeconds();
     }
 
-    // Check that the best intercept position is actually on the field
-    if (!contains(field.fieldLines(), best_ball_intercept_pos))
+    std::optional<std::pair<Point, Duration>> findBestInterceptForBall(
+        const BallTrajectory &trajectory, const Ball &ball, const Field &field,
+        const Robot &robot)
     {
-        return std::nullopt;
+        // If the ball timestamp is less then the robot timestamp, we only look for
+        // intercepts after the robot timestamp
+        double time_offset = 0;
+        if (ball.timestamp() < robot.timestamp())
+        {
+            time_offset = (robot.timestamp() - ball.timestamp()).toSeconds();
+        }
+
+        const std::optional<double> intercept_time =
+            findEarliestInterceptTime(trajectory, robot, time_offset);
+        if (!intercept_time)
+        {
+            return std::nullopt;
+        }
+
+        // Check that the best intercept position is actually on the field
+        const Point best_ball_intercept_pos = trajectory.position(*intercept_time);
+        if (!contains(field.fieldLines(), best_ball_intercept_pos))
+        {
+            return std::nullopt;
+        }
+
+        return std::make_pair(best_ball_intercept_pos,
+                              robot.getTimeToPosition(best_ball_intercept_pos));
     }
+}  // namespace
 
-    return std::make_pair(best_ball_intercept_pos, time_to_ball_pos);
+std::optional<std::pair<Point, Duration>> findBestInterceptForBall(const Ball &ball,
+                                                                   const Field &field,
+                                                                   const Robot &robot)
+{
+    return findBestInterceptForBall(BallTrajectory(ball, field), ball, field, robot);
+}
+
+std::vector<std::optional<std::pair<Point, Duration>>> findBestInterceptsForBall(
+    const Ball &ball, const Field &field, const std::vector<Robot> &robots)
+{
+    const BallTrajectory trajectory(ball, field);
+
+    std::vector<std::optional<std::pair<Point, Duration>>> intercepts;
+    intercepts.reserve(robots.size());
+    for (const Robot &robot : robots)
+    {
+        intercepts.push_back(findBestInterceptForBall(trajectory, ball, field, robot));
+    }
+    return intercepts;
 }
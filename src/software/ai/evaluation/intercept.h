@@ -1,6 +1,7 @@
 #pragma once
 
 #include <optional>
+#include <vector>
 
 #include "software/geom/point.h"
 #include "software/world/ball.h"
@@ -10,6 +11,11 @@
 /**
  * Finds the best place for the given robot to intercept the given ball
  *
+ * The best place is where the ball is at the earliest time that the robot can get to
+ * the ball's position no later than the ball does. The ball is assumed to follow its
+ * constant acceleration until it comes to rest, if its acceleration opposes its
+ * velocity.
+ *
  * @param ball The ball to intercept
  * @param field The field on which we want the intercept to occur
  * @param robot The robot that will hopefully intercept the ball
@@ -22,3 +28,19 @@
 std::optional<std::pair<Point, Duration>> findBestInterceptForBall(const Ball &ball,
                                                                    const Field &field,
                                                                    const Robot &robot);
+
+/**
+ * Finds the best place for each of the given robots to intercept the given ball
+ *
+ * This gives the same intercepts as calling findBestInterceptForBall for each robot,
+ * but only predicts the motion of the ball once for all of them.
+ *
+ * @param ball The ball to intercept
+ * @param field The field on which we want the intercepts to occur
+ * @param robots The robots that will hopefully intercept the ball
+ *
+ * @return The best intercept for each robot, in the same order as the robots, as
+ * returned by findBestInterceptForBall
+ */
+std::vector<std::optional<std::pair<Point, Duration>>> findBestInterceptsForBall(
+    const Ball &ball, const Field &field, const std::vector<Robot> &robots);
@@ -0,0 +1,169 @@
+#include "software/ai/evaluation/pass_visibility_graph.h"
+
+#include <algorithm>
+#include <deque>
+#include <numeric>
+
+#include "software/geom/algorithms/intersects.h"
+#include "software/geom/circle.h"
+#include "software/geom/segment.h"
+
+PassVisibilityGraph::PassVisibilityGraph(const std::vector<Robot> &robots,
+                                         double obstacle_radius)
+    : robots(robots),
+      can_pass(robots.size() * robots.size(), false),
+      num_passes(robots.size() * robots.size()),
+      last_passer(robots.size() * robots.size())
+{
+    const size_t num_robots = robots.size();
+    std::sort(this->robots.begin(), this->robots.end(), Robot::cmpRobotByID());
+
+    // Index the obstacles by their x coordinate, so that only the obstacles within
+    // the x extent of a pass are checked against it
+    std::vector<size_t> obstacles_by_x(num_robots);
+    std::iota(obstacles_by_x.begin(), obstacles_by_x.end(), 0);
+    std::sort(obstacles_by_x.begin(), obstacles_by_x.end(), [&](size_t a, size_t b) {
+        return this->robots[a].position().x() < this->robots[b].position().x();
+    });
+    std::vector<double> obstacle_xs(num_robots);
+    for (size_t k = 0; k < num_robots; k++)
+    {
+        obstacle_xs[k] = this->robots[obstacles_by_x[k]].position().x();
+    }
+
+    for (size_t passer = 0; passer < num_robots; passer++)
+    {
+        for (size_t receiver = passer + 1; receiver < num_robots; receiver++)
+        {
+            const Point passer_position   = this->robots[passer].position();
+            const Point receiver_position = this->robots[receiver].position();
+            const Segment pass(passer_position, receiver_position);
+
+            const double min_y =
+                std::min(passer_position.y(), receiver_position.y()) - obstacle_radius;
+            const double max_y =
+                std::max(passer_position.y(), receiver_position.y()) + obstacle_radius;
+            const auto first_obstacle = std::lower_bound(
+                obstacle_xs.begin(), obstacle_xs.end(),
+                std::min(passer_position.x(), receiver_position.x()) - obstacle_radius);
+            const double max_x =
+                std::max(passer_position.x(), receiver_position.x()) + obstacle_radius;
+
+            bool pass_blocked = false;
+            for (size_t k = first_obstacle - obstacle_xs.begin();
+                 k < num_robots && obstacle_xs[k] <= max_x && !pass_blocked; k++)
+            {
+                const size_t obstacle         = obstacles_by_x[k];
+                const Point obstacle_position = this->robots[obstacle].position();
+                pass_blocked =
+                    obstacle != passer && obstacle != receiver &&
+                    obstacle_position.y() >= min_y && obstacle_position.y() <= max_y &&
+                    intersects(Circle(obstacle_position, obstacle_radius), pass);
+            }
+
+            can_pass[passer * num_robots + receiver] = !pass_blocked;
+            can_pass[receiver * num_robots + passer] = !pass_blocked;
+        }
+    }
+
+    for (size_t initial_passer = 0; initial_passer < num_robots; initial_passer++)
+    {
+        findShortestPassesFrom(initial_passer);
+    }
+}
+
+std::optional<std::pair<int, std::optional<Robot>>>
+PassVisibilityGraph::getNumPassesToRobot(const Robot &initial_passer,
+                                         const Robot &final_receiver) const
+{
+    if (initial_passer == final_receiver)
+    {
+        return std::make_pair(0, std::nullopt);
+    }
+
+    const std::optional<size_t> passer   = findRobot(initial_passer);
+    const std::optional<size_t> receiver = findRobot(final_receiver);
+    if (!passer || !receiver)
+    {
+        return std::nullopt;
+    }
+
+    const size_t index = *passer * robots.size() + *receiver;
+    if (!num_passes[index])
+    {
+        return std::nullopt;
+    }
+    return std::make_pair(*num_passes[index], robots[*last_passer[index]]);
+}
+
+bool PassVisibilityGraph::canPass(const Robot &passer, const Robot &receiver) const
+{
+    const std::optional<size_t> passer_index   = findRobot(passer);
+    const std::optional<size_t> receiver_index = findRobot(receiver);
+    return passer_index && receiver_index &&
+           (*passer_index == *receiver_index ||
+            can_pass[*passer_index * robots.size() + *receiver_index]);
+}
+
+std::optional<size_t> PassVisibilityGraph::findRobot(const Robot &robot) const
+{
+    const auto it = std::find(robots.begin(), robots.end(), robot);
+    if (it == robots.end())
+    {
+        return std::nullopt;
+    }
+    return it - robots.begin();
+}
+
+void PassVisibilityGraph::findShortestPassesFrom(size_t initial_passer)
+{
+    const size_t num_robots = robots.size();
+    std::optional<int> *passes_to    = &num_passes[initial_passer * num_robots];
+    std::optional<size_t> *passer_to = &last_passer[initial_passer * num_robots];
+
+    passes_to[initial_passer] = 0;
+    std::deque<size_t> robots_to_pass_from{initial_passer};
+    while (!robots_to_pass_from.empty())
+    {
+        const size_t passer = robots_to_pass_from.front();
+        robots_to_pass_from.pop_front();
+        for (size_t receiver = 0; receiver < num_robots; receiver++)
+        {
+            if (!passes_to[receiver] && can_pass[passer * num_robots + receiver])
+            {
+                passes_to[receiver] = *passes_to[passer] + 1;
+                robots_to_pass_from.push_back(receiver);
+            }
+        }
+    }
+
+    // If there are multiple robots that can make the last pass to a robot, we assume
+    // it will receive the ball from the closest one since this is more likely. Ties
+    // go to the robot with the lowest ID.
+    for (size_t receiver = 0; receiver < num_robots; receiver++)
+    {
+        if (receiver == initial_passer || !passes_to[receiver])
+        {
+            continue;
+        }
+
+        const Point receiver_position = robots[receiver].position();
+        double closest_distance       = 0;
+        for (size_t passer = 0; passer < num_robots; passer++)
+        {
+            if (passes_to[passer] != *passes_to[receiver] - 1 ||
+                !can_pass[passer * num_robots + receiver])
+            {
+                continue;
+            }
+
+            const double distance =
+                (robots[passer].position() - receiver_position).length();
+            if (!passer_to[receiver] || distance < closest_distance)
+            {
+                passer_to[receiver] = passer;
+                closest_distance    = distance;
+            }
+        }
+    }
+}
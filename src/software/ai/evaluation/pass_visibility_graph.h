@@ -0,0 +1,89 @@
+#pragma once
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "shared/constants.h"
+#include "software/world/robot.h"
+
+/**
+ * A graph of which robots on a team can pass to each other, along with the fewest
+ * passes it takes to get the ball from any robot to any other.
+ *
+ * A pass can be made between two robots if no other robot in the graph is in the way.
+ * The graph is built once for the positions of the robots, after which the number of
+ * passes between any pair of robots is looked up instead of searched for.
+ */
+class PassVisibilityGraph
+{
+   public:
+    PassVisibilityGraph() = delete;
+
+    /**
+     * Builds the graph for the given robots, which are also the only obstacles that
+     * can block a pass
+     *
+     * @param robots The robots that can pass to each other
+     * @param obstacle_radius The radius of a robot when it is blocking a pass
+     */
+    explicit PassVisibilityGraph(const std::vector<Robot> &robots,
+                                 double obstacle_radius = ROBOT_MAX_RADIUS_METERS);
+
+    /**
+     * Returns how many passes it would take for the given passer to pass the ball to
+     * the receiver so the receiver gains possession of the ball, and returns the
+     * intermediate passer the receiver is most likely to receive the ball from.
+     *
+     * This gives the same result as the free function getNumPassesToRobot for a team
+     * made up of the robots in this graph.
+     *
+     * @param initial_passer The robot the passes start from
+     * @param final_receiver The robot trying to be passed to
+     *
+     * @return a pair containing the number of passes it will take for the passer robot
+     * to pass the ball to the receiver robot, and the intermediate robot the receiver
+     * will receive the pass from. If the receiver can not be passed to, or either
+     * robot is not in this graph, returns std::nullopt
+     */
+    std::optional<std::pair<int, std::optional<Robot>>> getNumPassesToRobot(
+        const Robot &initial_passer, const Robot &final_receiver) const;
+
+    /**
+     * Checks if a pass can be made directly between the given robots
+     *
+     * @param passer The robot passing the ball
+     * @param receiver The robot receiving the ball
+     *
+     * @return true if both robots are in this graph and no other robot blocks the pass
+     */
+    bool canPass(const Robot &passer, const Robot &receiver) const;
+
+   private:
+    /**
+     * Finds the index of the given robot in this graph
+     *
+     * @param robot The robot to find
+     *
+     * @return The index of the robot, if it is in this graph
+     */
+    std::optional<size_t> findRobot(const Robot &robot) const;
+
+    /**
+     * Fills in the fewest passes and most likely last passer from the given robot to
+     * every other robot, with a breadth first search over the passes
+     *
+     * @param initial_passer The index of the robot the passes start from
+     */
+    void findShortestPassesFrom(size_t initial_passer);
+
+    // The robots in the graph, sorted by ID
+    std::vector<Robot> robots;
+
+    // Whether a pass can be made between each pair of robots, and for each pair, the
+    // fewest passes from the first robot to the second and the robot that makes the
+    // last of those passes. These are indexed by passer * robots.size() + receiver.
+    std::vector<bool> can_pass;
+    std::vector<std::optional<int>> num_passes;
+    std::vector<std::optional<size_t>> last_passer;
+};
@@ -0,0 +1,149 @@
+#include "software/ai/evaluation/pass_visibility_graph.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "software/ai/evaluation/enemy_threat.h"
+#include "software/test_util/test_util.h"
+#include "software/world/team.h"
+
+class PassVisibilityGraphTest : public testing::Test
+{
+   protected:
+    static Robot createRobot(RobotId id, const Point &position)
+    {
+        return Robot(id, position, Vector(0, 0), Angle::zero(), AngularVelocity::zero(),
+                     Timestamp::fromSeconds(0));
+    }
+
+    /**
+     * Finds the number of passes between two robots by searching outwards from the
+     * passer one pass at a time, checking every pass with findAllReceiverPasserPairs
+     */
+    static std::optional<std::pair<int, std::optional<Robot>>> searchNumPassesToRobot(
+        const Robot &initial_passer, const Robot &final_receiver,
+        const std::vector<Robot> &robots)
+    {
+        if (initial_passer == final_receiver)
+        {
+            return std::make_pair(0, std::nullopt);
+        }
+
+        std::vector<Robot> current_passers{initial_passer};
+        std::vector<Robot> unvisited_robots = robots;
+        unvisited_robots.erase(
+            std::remove(unvisited_robots.begin(), unvisited_robots.end(), initial_passer),
+            unvisited_robots.end());
+        for (int pass_num = 1; !current_passers.empty() && !unvisited_robots.empty();
+             pass_num++)
+        {
+            auto receiver_passer_pairs =
+                findAllReceiverPasserPairs(current_passers, unvisited_robots, robots);
+            if (receiver_passer_pairs.count(final_receiver) > 0)
+            {
+                auto closest_passer =
+                    Team::getNearestRobot(receiver_passer_pairs.at(final_receiver),
+                                          final_receiver.position());
+                return std::make_pair(pass_num, closest_passer);
+            }
+
+            current_passers.clear();
+            for (const auto &[receiver, passers] : receiver_passer_pairs)
+            {
+                current_passers.emplace_back(receiver);
+                unvisited_robots.erase(std::remove(unvisited_robots.begin(),
+                                                   unvisited_robots.end(), receiver),
+                                       unvisited_robots.end());
+            }
+        }
+        return std::nullopt;
+    }
+};
+
+TEST_F(PassVisibilityGraphTest, robot_passing_to_itself)
+{
+    Robot robot = createRobot(0, Point(0, 0));
+    PassVisibilityGraph graph({robot});
+
+    auto result = graph.getNumPassesToRobot(robot, robot);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(0, result->first);
+    EXPECT_FALSE(result->second);
+}
+
+TEST_F(PassVisibilityGraphTest, blocked_pass_goes_through_blocking_robot)
+{
+    Robot robot_0 = createRobot(0, Point(0, 0));
+    Robot robot_1 = createRobot(1, Point(1, 0));
+    Robot robot_2 = createRobot(2, Point(2, 0));
+    PassVisibilityGraph graph({robot_2, robot_0, robot_1});
+
+    EXPECT_TRUE(graph.canPass(robot_0, robot_1));
+    EXPECT_TRUE(graph.canPass(robot_1, robot_2));
+    EXPECT_FALSE(graph.canPass(robot_0, robot_2));
+    EXPECT_FALSE(graph.canPass(robot_2, robot_0));
+
+    auto result = graph.getNumPassesToRobot(robot_0, robot_2);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(2, result->first);
+    EXPECT_EQ(robot_1, result->second);
+}
+
+TEST_F(PassVisibilityGraphTest, receives_from_closest_of_equally_short_routes)
+{
+    // Robot 1 blocks the direct pass from robot 0 to robot 3, which can be reached in
+    // two passes through robot 1, 2 or 4. Robot 4 is the closest to robot 3.
+    Robot robot_0 = createRobot(0, Point(0, 0));
+    Robot robot_1 = createRobot(1, Point(0.5, 0));
+    Robot robot_2 = createRobot(2, Point(2, 1));
+    Robot robot_3 = createRobot(3, Point(4, 0));
+    Robot robot_4 = createRobot(4, Point(2.5, -1.5));
+    PassVisibilityGraph graph({robot_0, robot_1, robot_2, robot_3, robot_4});
+
+    auto result = graph.getNumPassesToRobot(robot_0, robot_3);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(2, result->first);
+    EXPECT_EQ(robot_4, result->second);
+}
+
+TEST_F(PassVisibilityGraphTest, robot_not_in_graph_can_not_be_passed_to)
+{
+    Robot robot_0 = createRobot(0, Point(0, 0));
+    Robot robot_1 = createRobot(1, Point(1, 0));
+    PassVisibilityGraph graph({robot_0});
+
+    EXPECT_FALSE(graph.getNumPassesToRobot(robot_0, robot_1));
+    EXPECT_FALSE(graph.canPass(robot_0, robot_1));
+}
+
+TEST_F(PassVisibilityGraphTest, matches_searching_one_pass_at_a_time)
+{
+    std::mt19937 random_num_gen(42);
+    std::uniform_real_distribution<double> x_distribution(-4.5, 4.5);
+    std::uniform_real_distribution<double> y_distribution(-3, 3);
+
+    for (int trial = 0; trial < 50; trial++)
+    {
+        // Crowd the robots together so that many passes are blocked
+        std::vector<Robot> robots;
+        for (RobotId id = 0; id < 11; id++)
+        {
+            Point position(x_distribution(random_num_gen) / 3,
+                           y_distribution(random_num_gen) / 3);
+            robots.emplace_back(createRobot(id, position));
+        }
+        PassVisibilityGraph graph(robots);
+
+        for (const Robot &passer : robots)
+        {
+            for (const Robot &receiver : robots)
+            {
+                EXPECT_EQ(searchNumPassesToRobot(passer, receiver, robots),
+                          graph.getNumPassesToRobot(passer, receiver))
+                    << "trial " << trial << ", " << passer.id() << " to "
+                    << receiver.id();
+            }
+        }
+    }
+}
@@ -0,0 +1,96 @@
+#include "software/ai/evaluation/shot_openness_map.h"
+
+#include <cmath>
+
+#include "software/geom/angular_sweep.h"
+
+namespace
+{
+    /**
+     * Converts a coordinate to the frame the map is calculated in, which is rotated by
+     * a half turn for the friendly goal
+     */
+    double toShotFrame(double v, TeamType goal)
+    {
+        return goal == TeamType::FRIENDLY ? -v : v;
+    }
+}  // namespace
+
+ShotOpennessMap::ShotOpennessMap(const Field& field,
+                                 const std::vector<Robot>& robot_obstacles,
+                                 TeamType goal, double resolution, double radius)
+    : goal(goal),
+      radius(radius),
+      // Rotating the friendly goal by a half turn swaps which post is on the positive
+      // side, the same way calcBestShotOnGoal swaps the post angles
+      pos_post(goal == TeamType::FRIENDLY ? Point(-field.friendlyGoalpostNeg().x(),
+                                                  -field.friendlyGoalpostNeg().y())
+                                          : field.enemyGoalpostPos()),
+      neg_post(goal == TeamType::FRIENDLY ? Point(-field.friendlyGoalpostPos().x(),
+                                                  -field.friendlyGoalpostPos().y())
+                                          : field.enemyGoalpostNeg()),
+      grid(field.fieldBoundary(), resolution)
+{
+    obstacle_x.reserve(robot_obstacles.size());
+    obstacle_y.reserve(robot_obstacles.size());
+    for (const Robot& robot : robot_obstacles)
+    {
+        obstacle_x.push_back(toShotFrame(robot.position().x(), goal));
+        obstacle_y.push_back(toShotFrame(robot.position().y(), goal));
+    }
+
+    std::vector<double> xs(grid.numXSamples());
+    for (size_t i = 0; i < grid.numXSamples(); i++)
+    {
+        xs[i] = grid.sampleX(i);
+    }
+
+    std::vector<double> open_angles_deg;
+    for (size_t j = 0; j < grid.numYSamples(); j++)
+    {
+        calculateOpenAnglesDegrees(xs, grid.sampleY(j), open_angles_deg);
+        for (size_t i = 0; i < grid.numXSamples(); i++)
+        {
+            grid.setSample(i, j, open_angles_deg[i]);
+        }
+    }
+}
+
+bool ShotOpennessMap::contains(double x, double y) const
+{
+    return grid.contains(x, y);
+}
+
+double ShotOpennessMap::getOpenAngleDegrees(double x, double y) const
+{
+    return grid.interpolate(x, y);
+}
+
+double ShotOpennessMap::calculateOpenAngleDegrees(double x, double y) const
+{
+    std::vector<double> open_angles_deg;
+    calculateOpenAnglesDegrees({x}, y, open_angles_deg);
+    return open_angles_deg[0];
+}
+
+void ShotOpennessMap::calculateOpenAnglesDegrees(
+    const std::vector<double>& xs, double y, std::vector<double>& open_angles_deg) const
+{
+    std::vector<double> shot_xs(xs.size());
+    for (size_t i = 0; i < xs.size(); i++)
+    {
+        shot_xs[i] = toShotFrame(xs[i], goal);
+    }
+    const std::vector<double> shot_ys(xs.size(), toShotFrame(y, goal));
+
+    AngularSweep::getThreadLocalSweep().calculateBiggestOpenAngles(
+        shot_xs, shot_ys, pos_post.x(), pos_post.y(), neg_post.x(), neg_post.y(),
+        obstacle_x, obstacle_y, radius, open_angles_deg);
+
+    for (size_t i = 0; i < xs.size(); i++)
+    {
+        // There is no shot from behind the net
+        open_angles_deg[i] =
+            shot_xs[i] > pos_post.x() ? 0.0 : open_angles_deg[i] / M_PI * 180.0;
+    }
+}
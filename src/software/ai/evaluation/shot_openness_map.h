@@ -0,0 +1,127 @@
+#pragma once
+
+#include <vector>
+
+#include "shared/constants.h"
+#include "software/geom/point.h"
+#include "software/math/bilinear_grid.h"
+#include "software/optimization/dual_number.hpp"
+#include "software/world/field.h"
+#include "software/world/robot.h"
+#include "software/world/team.h"
+
+/**
+ * A raster of the open angle to a goal over the whole field, including the boundary
+ * around it.
+ *
+ * The open angle at a point is the largest open angle interval that
+ * calcBestShotOnGoal finds for a shot from that point, in degrees, or 0 if it finds
+ * no shot. This map samples it once per cell, so that ratings which only need the
+ * open angle, and not the best target to shoot at, can bilinearly interpolate between
+ * the four closest samples instead of sweeping over every obstacle.
+ *
+ * Building a map sweeps over the obstacles once per sample, so a map only pays off when
+ * it is shared by many ratings of the same world. Use
+ * EvaluationContext::getShotOpennessMap to build it once per world.
+ */
+class ShotOpennessMap
+{
+   public:
+    ShotOpennessMap() = delete;
+
+    /**
+     * Builds a map of the open angle to the given goal on the given field
+     *
+     * @param field The field to build the map for
+     * @param robot_obstacles The robots that may obstruct a shot, as passed to
+     * calcBestShotOnGoal
+     * @param goal The goal to shoot at
+     * @param resolution The distance between neighbouring samples, in meters
+     * @param radius The radius for the robot obstacles
+     */
+    explicit ShotOpennessMap(const Field& field,
+                             const std::vector<Robot>& robot_obstacles, TeamType goal,
+                             double resolution, double radius = ROBOT_MAX_RADIUS_METERS);
+
+    /**
+     * Checks if the given point is covered by this map
+     *
+     * @param x The x coordinate of the point
+     * @param y The y coordinate of the point
+     *
+     * @return true if the open angle at the point can be interpolated from this map
+     */
+    bool contains(double x, double y) const;
+
+    /**
+     * Interpolates the open angle at the given point, which must be covered by this
+     * map
+     *
+     * @param x The x coordinate of the point
+     * @param y The y coordinate of the point
+     *
+     * @return The interpolated open angle, in degrees
+     */
+    double getOpenAngleDegrees(double x, double y) const;
+
+    /**
+     * Interpolates the open angle at the given point, which must be covered by this
+     * map, along with its gradient
+     *
+     * @param x The x coordinate of the point
+     * @param y The y coordinate of the point
+     *
+     * @return The interpolated open angle in degrees, carrying the gradient of the
+     * interpolation
+     */
+    template <size_t NUM_PARAMS>
+    DualNumber<NUM_PARAMS> getOpenAngleDegrees(const DualNumber<NUM_PARAMS>& x,
+                                               const DualNumber<NUM_PARAMS>& y) const;
+
+    /**
+     * Calculates the open angle at the given point exactly, the same way that the
+     * samples of this map are calculated
+     *
+     * @param x The x coordinate of the point
+     * @param y The y coordinate of the point
+     *
+     * @return The open angle, in degrees
+     */
+    double calculateOpenAngleDegrees(double x, double y) const;
+
+   private:
+    /**
+     * Calculates the open angle at each of the given points, which must all have the
+     * same y coordinate
+     *
+     * @param xs The x coordinates of the points
+     * @param y The y coordinate of the points
+     * @param open_angles_deg Is set to the open angle at each point, in degrees
+     */
+    void calculateOpenAnglesDegrees(const std::vector<double>& xs, double y,
+                                    std::vector<double>& open_angles_deg) const;
+
+    TeamType goal;
+    double radius;
+
+    // The positions of the robot obstacles. If the goal is the friendly goal, the map
+    // is calculated in a frame rotated by a half turn, so that shots are always taken
+    // towards +x like they are at the enemy goal. These are the positions in that
+    // frame, stored as separate arrays in the layout that
+    // AngularSweep::calculateBiggestOpenAngles takes for a whole row of cells.
+    std::vector<double> obstacle_x;
+    std::vector<double> obstacle_y;
+
+    // The goalposts, in the same frame as the obstacles
+    Point pos_post;
+    Point neg_post;
+
+    BilinearGrid grid;
+};
+
+template <size_t NUM_PARAMS>
+DualNumber<NUM_PARAMS> ShotOpennessMap::getOpenAngleDegrees(
+    const DualNumber<NUM_PARAMS>& x, const DualNumber<NUM_PARAMS>& y) const
+{
+    return grid.interpolate(x, y);
+}
@@ -0,0 +1,157 @@
+#include "software/ai/evaluation/shot_openness_map.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+
+#include "software/ai/evaluation/calc_best_shot.h"
+#include "software/test_util/test_util.h"
+
+class ShotOpennessMapTest : public testing::Test
+{
+   protected:
+    ShotOpennessMapTest()
+        : field(Field::createSSLDivisionBField()),
+          robots({
+              createRobot(0, Point(4.0, 0.2)),
+              createRobot(1, Point(3.7, -0.3)),
+              createRobot(2, Point(2.0, 1.0)),
+              createRobot(3, Point(-3.9, 0.1)),
+              createRobot(4, Point(-2.5, -0.8)),
+              createRobot(5, Point(0.0, 0.0)),
+          })
+    {
+    }
+
+    static Robot createRobot(RobotId id, const Point& position)
+    {
+        return Robot(id, position, Vector(0, 0), Angle::zero(), AngularVelocity::zero(),
+                     Timestamp::fromSeconds(0));
+    }
+
+    /**
+     * Gets the open angle that calcBestShotOnGoal finds for a shot on the given goal
+     */
+    double getExactOpenAngleDegrees(const Point& shot_origin, TeamType goal) const
+    {
+        const Segment goal_post =
+            goal == TeamType::ENEMY
+                ? Segment(field.enemyGoalpostPos(), field.enemyGoalpostNeg())
+                : Segment(field.friendlyGoalpostPos(), field.friendlyGoalpostNeg());
+        const std::optional<Shot> shot =
+            calcBestShotOnGoal(goal_post, shot_origin, robots, goal);
+        return shot ? shot->getOpenAngle().toDegrees() : 0.0;
+    }
+
+    Field field;
+    std::vector<Robot> robots;
+};
+
+TEST_F(ShotOpennessMapTest, open_angle_matches_calc_best_shot_on_goal)
+{
+    for (TeamType goal : {TeamType::ENEMY, TeamType::FRIENDLY})
+    {
+        const ShotOpennessMap map(field, robots, goal, 0.1);
+        for (double x = -4.7; x <= 4.7; x += 0.113)
+        {
+            for (double y = -3.2; y <= 3.2; y += 0.097)
+            {
+                EXPECT_NEAR(map.calculateOpenAngleDegrees(x, y),
+                            getExactOpenAngleDegrees(Point(x, y), goal), 1e-9)
+                    << "(" << x << ", " << y << ")";
+            }
+        }
+    }
+}
+
+TEST_F(ShotOpennessMapTest, samples_match_calc_best_shot_on_goal)
+{
+    const double resolution = 0.1;
+    for (TeamType goal : {TeamType::ENEMY, TeamType::FRIENDLY})
+    {
+        const ShotOpennessMap map(field, robots, goal, resolution);
+        const Rectangle boundary = field.fieldBoundary();
+        for (double x = boundary.xMin(); x <= boundary.xMax(); x += 5 * resolution)
+        {
+            for (double y = boundary.yMin(); y <= boundary.yMax(); y += 5 * resolution)
+            {
+                ASSERT_TRUE(map.contains(x, y));
+
+                // Samples are stored as floats
+                EXPECT_NEAR(map.getOpenAngleDegrees(x, y),
+                            getExactOpenAngleDegrees(Point(x, y), goal), 1e-4)
+                    << "(" << x << ", " << y << ")";
+            }
+        }
+    }
+}
+
+TEST_F(ShotOpennessMapTest, interpolates_open_angle_without_obstacles_closely)
+{
+    robots.clear();
+    const ShotOpennessMap map(field, robots, TeamType::ENEMY, 0.05);
+
+    // Without obstacles the open angle is smooth away from the goal
+    for (double x = -4.0; x <= 3.5; x += 0.37)
+    {
+        for (double y = -2.5; y <= 2.5; y += 0.29)
+        {
+            EXPECT_NEAR(map.getOpenAngleDegrees(x, y),
+                        getExactOpenAngleDegrees(Point(x, y), TeamType::ENEMY), 0.05)
+                << "(" << x << ", " << y << ")";
+        }
+    }
+}
+
+TEST_F(ShotOpennessMapTest, no_open_angle_behind_the_net)
+{
+    const ShotOpennessMap enemy_goal_map(field, robots, TeamType::ENEMY, 0.1);
+    const ShotOpennessMap friendly_goal_map(field, robots, TeamType::FRIENDLY, 0.1);
+
+    EXPECT_EQ(enemy_goal_map.calculateOpenAngleDegrees(4.6, 0.0), 0.0);
+    EXPECT_EQ(friendly_goal_map.calculateOpenAngleDegrees(-4.6, 0.0), 0.0);
+    EXPECT_GT(enemy_goal_map.calculateOpenAngleDegrees(3.0, 0.0), 0.0);
+    EXPECT_GT(friendly_goal_map.calculateOpenAngleDegrees(-3.0, 0.5), 0.0);
+}
+
+TEST_F(ShotOpennessMapTest, interpolates_open_angle_with_obstacles_closely_on_average)
+{
+    const ShotOpennessMap map(field, robots, TeamType::ENEMY, 0.1);
+
+    // The open angle jumps where a robot starts or stops splitting the biggest open
+    // interval, so the interpolation can be a few degrees off right next to the edges
+    // of the robots, but it should be close almost everywhere else. Points in the
+    // enemy defense area are skipped, since the open angle also jumps at the goal line.
+    std::vector<double> errors_deg;
+    for (double x = -4.5; x <= 3.5; x += 0.0713)
+    {
+        for (double y = -3.0; y <= 3.0; y += 0.0617)
+        {
+            errors_deg.push_back(
+                std::abs(map.getOpenAngleDegrees(x, y) -
+                         getExactOpenAngleDegrees(Point(x, y), TeamType::ENEMY)));
+        }
+    }
+
+    std::sort(errors_deg.begin(), errors_deg.end());
+    const double mean_error_deg =
+        std::accumulate(errors_deg.begin(), errors_deg.end(), 0.0) / errors_deg.size();
+    EXPECT_LT(mean_error_deg, 0.1);
+    EXPECT_LT(errors_deg[errors_deg.size() * 95 / 100], 0.5);
+}
+
+TEST_F(ShotOpennessMapTest, DISABLED_build_speed_test)
+{
+    const auto start_time = std::chrono::system_clock::now();
+
+    const int num_maps = 20;
+    for (int i = 0; i < num_maps; i++)
+    {
+        robots[0] = createRobot(0, Point(4.0, 0.2 + i * 0.01));
+        ShotOpennessMap(field, robots, TeamType::ENEMY, 0.1);
+    }
+
+    const double duration_ms = ::TestUtil::millisecondsSince(start_time);
+    std::cout << "Took " << duration_ms / num_maps << "ms to build a map" << std::endl;
+}
@@ -38,6 +38,7 @@ std::unique_ptr<TbotsProto::PrimitiveSet> AssignedTacticsPlay::get(
 {
     obstacle_list.Clear();
     path_visualization.Clear();
+    obstacle_factory.clearObstacleCache();
 
     auto primitives_to_run = std::make_unique<TbotsProto::PrimitiveSet>();
     for (const auto &robot : world_ptr->friendlyTeam().getAllRobots())
@@ -52,16 +53,17 @@ std::unique_ptr<TbotsProto::PrimitiveSet> AssignedTacticsPlay::get(
             {
                 motion_constraints = override_motion_constraints.at(robot.id());
             }
-            auto primitives = tactic->get(world_ptr);
-            CHECK(primitives.contains(robot.id()))
-                << "Couldn't find a primitive for robot id " << robot.id();
+            auto primitive = tactic->get(world_ptr, robot);
             auto [traj_path, primitive_proto] =
-                primitives[robot.id()]->generatePrimitiveProtoMessage(
+                primitive->generatePrimitiveProtoMessage(
                     *world_ptr, motion_constraints, robot_trajectories, obstacle_factory);
 
             if (traj_path.has_value())
             {
-                robot_trajectories.insert_or_assign(robot.id(), traj_path.value());
+                robot_trajectories.insert_or_assign(
+                    robot.id(),
+                    PlannedTrajectoryPath{traj_path.value(),
+                                          world_ptr->getMostRecentTimestamp()});
             }
             else
             {
@@ -72,8 +74,7 @@ std::unique_ptr<TbotsProto::PrimitiveSet> AssignedTacticsPlay::get(
                 {robot.id(), *primitive_proto});
             tactic->setLastExecutionRobot(robot.id());
 
-            primitives[robot.id()]->getVisualizationProtos(obstacle_list,
-                                                           path_visualization);
+            primitive->getVisualizationProtos(obstacle_list, path_visualization);
         }
     }
     primitives_to_run->mutable_time_sent()->set_epoch_timestamp_seconds(
@@ -2,6 +2,7 @@
 
 #include "software/ai/evaluation/defender_assignment.h"
 #include "software/ai/evaluation/enemy_threat.h"
+#include "software/ai/evaluation/evaluation_context.h"
 
 DefensePlayFSM::DefensePlayFSM(TbotsProto::AiConfig ai_config)
     : DefensePlayFSMBase::DefensePlayFSMBase(ai_config)
@@ -10,9 +11,8 @@ DefensePlayFSM::DefensePlayFSM(TbotsProto::AiConfig ai_config)
 
 void DefensePlayFSM::defendAgainstThreats(const Update& event)
 {
-    auto enemy_threats = getAllEnemyThreats(
-        event.common.world_ptr->field(), event.common.world_ptr->friendlyTeam(),
-        event.common.world_ptr->enemyTeam(), event.common.world_ptr->ball(), false);
+    auto enemy_threats =
+        EvaluationContext::get(event.common.world_ptr)->getAllEnemyThreats(false);
 
     auto assignments = getAllDefenderAssignments(
         enemy_threats, event.common.world_ptr->field(), event.common.world_ptr->ball(),
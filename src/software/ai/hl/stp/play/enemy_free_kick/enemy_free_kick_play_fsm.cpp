@@ -4,6 +4,7 @@
 #include "shared/constants.h"
 #include "software/ai/evaluation/defender_assignment.h"
 #include "software/ai/evaluation/enemy_threat.h"
+#include "software/ai/evaluation/evaluation_context.h"
 #include "software/ai/hl/stp/tactic/crease_defender/crease_defender_tactic.h"
 #include "software/ai/hl/stp/tactic/move/move_tactic.h"
 #include "software/ai/hl/stp/tactic/pass_defender/pass_defender_tactic.h"
@@ -37,9 +38,8 @@ void EnemyFreeKickPlayFSM::setTactics(const Update& event, unsigned int num_tact
     PriorityTacticVector tactics_to_return = {{}, {}, {}};
     Point block_kick_point;
 
-    auto enemy_threats = getAllEnemyThreats(
-        event.common.world_ptr->field(), event.common.world_ptr->friendlyTeam(),
-        event.common.world_ptr->enemyTeam(), event.common.world_ptr->ball(), false);
+    auto enemy_threats =
+        EvaluationContext::get(event.common.world_ptr)->getAllEnemyThreats(false);
 
     auto assignments = getAllDefenderAssignments(
         enemy_threats, event.common.world_ptr->field(), event.common.world_ptr->ball(),
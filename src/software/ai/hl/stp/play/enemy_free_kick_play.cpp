@@ -3,6 +3,7 @@
 #include "proto/parameters.pb.h"
 #include "shared/constants.h"
 #include "software/ai/evaluation/enemy_threat.h"
+#include "software/ai/evaluation/evaluation_context.h"
 #include "software/ai/hl/stp/tactic/crease_defender/crease_defender_tactic.h"
 #include "software/ai/hl/stp/tactic/move/move_tactic.h"
 #include "software/ai/hl/stp/tactic/shadow_enemy/shadow_enemy_tactic.h"
@@ -37,8 +38,7 @@ void EnemyFreekickPlay::getNextTactics(TacticCoroutine::push_type &yield,
 
         // Get all enemy threats
         auto enemy_threats =
-            getAllEnemyThreats(world_ptr->field(), world_ptr->friendlyTeam(),
-                               world_ptr->enemyTeam(), world_ptr->ball(), false);
+            EvaluationContext::get(world_ptr)->getAllEnemyThreats(false);
 
         // shadow free kicker should shadow the robot with the ball and if no such enemy
         // exists, then it will default to positioning between the ball and the friendly
@@ -1,5 +1,7 @@
 #include "software/ai/hl/stp/play/free_kick/free_kick_play_fsm.h"
 
+#include "software/ai/evaluation/evaluation_context.h"
+
 FreeKickPlayFSM::FreeKickPlayFSM(const TbotsProto::AiConfig &ai_config)
     : ai_config(ai_config),
       align_to_ball_tactic(std::make_shared<MoveTactic>()),
@@ -59,7 +61,7 @@ void FreeKickPlayFSM::updateReceiverPositioningTactics(
 
     std::vector<Point> best_receiving_positions =
         receiver_position_generator.getBestReceivingPositions(
-            *world, num_tactics, existing_receiver_positions, pass_origin_override);
+            world, num_tactics, existing_receiver_positions, pass_origin_override);
     // Note that getBestReceivingPositions may return fewer positions than requested
     // if there are not enough robots, so we will need to check the size of the vector.
     for (unsigned int i = 0;
@@ -130,10 +132,9 @@ void FreeKickPlayFSM::updateAlignToBallTactic(const WorldPtr &world_ptr)
 
 bool FreeKickPlayFSM::shotFound(const Update &event)
 {
-    shot = calcBestShotOnGoal(event.common.world_ptr->field(),
-                              event.common.world_ptr->friendlyTeam(),
-                              event.common.world_ptr->enemyTeam(),
-                              event.common.world_ptr->ball().position(), TeamType::ENEMY);
+    shot = EvaluationContext::get(event.common.world_ptr)
+               ->calcBestShotOnGoal(event.common.world_ptr->ball().position(),
+                                    TeamType::ENEMY);
     return shot.has_value() &&
            shot->getOpenAngle() >
                Angle::fromDegrees(
@@ -233,7 +234,7 @@ void FreeKickPlayFSM::lookForPass(const FreeKickPlayFSM::Update &event)
         robots_to_ignore.push_back(robot_with_ball_opt.value().id());
     }
     best_pass_and_score_so_far =
-        pass_generator.getBestPass(*event.common.world_ptr, robots_to_ignore);
+        pass_generator.getBestPass(event.common.world_ptr, robots_to_ignore);
 
     event.common.set_tactics(tactics_to_run);
 }
@@ -3,6 +3,7 @@
 #include "proto/parameters.pb.h"
 #include "shared/constants.h"
 #include "software/ai/evaluation/enemy_threat.h"
+#include "software/ai/evaluation/evaluation_context.h"
 #include "software/ai/evaluation/possession.h"
 #include "software/ai/hl/stp/tactic/move/move_tactic.h"
 #include "software/ai/hl/stp/tactic/shadow_enemy/shadow_enemy_tactic.h"
@@ -92,8 +93,7 @@ void KickoffEnemyPlay::getNextTactics(TacticCoroutine::push_type &yield,
         }
 
         auto enemy_threats =
-            getAllEnemyThreats(world_ptr->field(), world_ptr->friendlyTeam(),
-                               world_ptr->enemyTeam(), world_ptr->ball(), false);
+            EvaluationContext::get(world_ptr)->getAllEnemyThreats(false);
 
         PriorityTacticVector result = {{}};
 
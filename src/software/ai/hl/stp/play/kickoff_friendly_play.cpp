@@ -2,6 +2,7 @@
 
 #include "shared/constants.h"
 #include "software/ai/evaluation/enemy_threat.h"
+#include "software/ai/evaluation/evaluation_context.h"
 #include "software/ai/hl/stp/tactic/chip/chip_tactic.h"
 #include "software/ai/hl/stp/tactic/move/move_tactic.h"
 #include "software/util/generic_factory/generic_factory.h"
@@ -80,8 +81,7 @@ void KickoffFriendlyPlay::getNextTactics(TacticCoroutine::push_type &yield,
     while (world_ptr->gameState().isSetupState())
     {
         auto enemy_threats =
-            getAllEnemyThreats(world_ptr->field(), world_ptr->friendlyTeam(),
-                               world_ptr->enemyTeam(), world_ptr->ball(), false);
+            EvaluationContext::get(world_ptr)->getAllEnemyThreats(false);
 
         PriorityTacticVector result = {{}};
 
@@ -105,8 +105,7 @@ void KickoffFriendlyPlay::getNextTactics(TacticCoroutine::push_type &yield,
     while (!world_ptr->gameState().isPlaying())
     {
         auto enemy_threats =
-            getAllEnemyThreats(world_ptr->field(), world_ptr->friendlyTeam(),
-                               world_ptr->enemyTeam(), world_ptr->ball(), false);
+            EvaluationContext::get(world_ptr)->getAllEnemyThreats(false);
 
         PriorityTacticVector result = {{}};
 
@@ -3,6 +3,7 @@
 #include <munkres/munkres.h>
 
 #include <Tracy.hpp>
+#include <future>
 
 #include "proto/message_translation/tbots_protobuf.h"
 #include "software/ai/hl/stp/tactic/halt/halt_tactic.h"
@@ -113,6 +114,9 @@ std::unique_ptr<TbotsProto::PrimitiveSet> Play::get(
 
     tactic_robot_id_assignment.clear();
 
+    // Obstacles shared between robots are only valid for the world they were created in
+    obstacle_factory.clearObstacleCache();
+
     std::optional<Robot> goalie_robot = world_ptr->friendlyTeam().goalie();
     std::vector<Robot> robots         = world_ptr->friendlyTeam().getAllRobots();
 
@@ -128,28 +132,16 @@ std::unique_ptr<TbotsProto::PrimitiveSet> Play::get(
 
             auto motion_constraints =
                 buildMotionConstraintSet(world_ptr->gameState(), *goalie_tactic);
-            auto primitives = goalie_tactic->get(world_ptr);
-            CHECK(primitives.contains(goalie_robot_id))
-                << "Couldn't find a primitive for robot id " << goalie_robot_id;
-            auto [traj_path, primitive_proto] =
-                primitives[goalie_robot_id]->generatePrimitiveProtoMessage(
-                    *world_ptr, motion_constraints, robot_trajectories, obstacle_factory);
-
-            if (traj_path.has_value())
-            {
-                robot_trajectories.insert_or_assign(goalie_robot_id, traj_path.value());
-            }
-            else
-            {
-                robot_trajectories.erase(goalie_robot_id);
-            }
-
-            primitives_to_run->mutable_robot_primitives()->insert(
-                {goalie_robot_id, *primitive_proto});
+            auto primitive = goalie_tactic->get(world_ptr, goalie_robot.value());
             goalie_tactic->setLastExecutionRobot(goalie_robot_id);
 
-            primitives[goalie_robot_id]->getVisualizationProtos(obstacle_list,
-                                                                path_visualization);
+            // The goalie is planned in its own wave, before all other robots, so that
+            // the rest of the team avoids the goalie's trajectory from this tick
+            planTrajectories(
+                world_ptr,
+                {TrajectoryPlanningRequest{goalie_robot_id, primitive,
+                                           motion_constraints}},
+                *primitives_to_run);
         }
         else if (world_ptr->friendlyTeam().getGoalieId().has_value())
         {
@@ -265,17 +257,10 @@ Play::assignTactics(const WorldPtr &world_ptr, TacticVector tactic_vector,
     auto remaining_robots  = robots_to_assign;
 
 
-    std::vector<std::map<RobotId, std::shared_ptr<Primitive>>> primitive_sets;
-
-    for (auto tactic : tactic_vector)
-    {
-        primitive_sets.emplace_back(tactic->get(world_ptr));
-        CHECK(primitive_sets.back().size() == world_ptr->friendlyTeam().numRobots())
-            << primitive_sets.back().size() << " primitives from "
-            << objectTypeName(*tactic)
-            << " is not equal to the number of robots, which is "
-            << world_ptr->friendlyTeam().numRobots();
-    }
+    // Primitives that had to be generated to find the cost of assigning a robot to a
+    // tactic, so that they can be reused if the robot is assigned to the tactic
+    std::vector<std::map<RobotId, std::shared_ptr<Primitive>>> primitive_sets(
+        num_tactics);
 
     size_t num_rows = robots_to_assign.size();
     size_t num_cols = tactic_vector.size();
@@ -296,30 +281,28 @@ Play::assignTactics(const WorldPtr &world_ptr, TacticVector tactic_vector,
     // "jobs" (the Tactics).
     Matrix<double> matrix(num_rows, num_cols);
 
-    // Initialize the matrix with the cost of assigning each Robot to each Tactic
+    // Initialize the matrix with the cost of assigning each Robot to each Tactic.
+    // Tactics that can estimate the cost of a robot cheaply do so without updating
+    // their FSMs. Otherwise, the primitive for the robot is generated to find its cost.
     for (size_t row = 0; row < num_rows; row++)
     {
         for (size_t col = 0; col < num_cols; col++)
         {
-            Robot robot                    = robots_to_assign.at(row);
+            const Robot &robot             = robots_to_assign.at(row);
             std::shared_ptr<Tactic> tactic = tactic_vector.at(col);
-            auto primitives                = primitive_sets.at(col);
-            CHECK(primitives.contains(robot.id()))
-                << "Couldn't find a primitive for robot id " << robot.id();
-            double robot_cost_for_tactic =
-                primitives.at(robot.id())->getEstimatedPrimitiveCost();
+            std::optional<double> estimated_cost =
+                tactic->estimateCost(world_ptr, robot);
+            if (!estimated_cost.has_value())
+            {
+                std::shared_ptr<Primitive> primitive = tactic->get(world_ptr, robot);
+                estimated_cost = primitive->getEstimatedPrimitiveCost();
+                primitive_sets.at(col).emplace(robot.id(), std::move(primitive));
+            }
+            double robot_cost_for_tactic = estimated_cost.value();
 
-            std::set<RobotCapability> required_capabilities =
+            RobotCapabilityFlags required_capabilities =
                 tactic->robotCapabilityRequirements();
-            std::set<RobotCapability> robot_capabilities =
-                robot.getAvailableCapabilities();
-            std::set<RobotCapability> missing_capabilities;
-            std::set_difference(
-                required_capabilities.begin(), required_capabilities.end(),
-                robot_capabilities.begin(), robot_capabilities.end(),
-                std::inserter(missing_capabilities, missing_capabilities.begin()));
-
-            if (missing_capabilities.size() > 0)
+            if (!required_capabilities.isSubsetOf(robot.getAvailableCapabilityFlags()))
             {
                 // We arbitrarily increase the cost, so that robots with missing
                 // capabilities are not assigned
@@ -346,6 +329,7 @@ Play::assignTactics(const WorldPtr &world_ptr, TacticVector tactic_vector,
     //        -1, 0,-1,         and            0,-1,
     //         0,-1,-1,                       -1, 0,
     //        -1,-1, 0,
+    std::vector<TrajectoryPlanningRequest> planning_requests;
     for (size_t row = 0; row < num_rows; row++)
     {
         for (size_t col = 0; col < num_tactics; col++)
@@ -356,11 +340,23 @@ Play::assignTactics(const WorldPtr &world_ptr, TacticVector tactic_vector,
                 RobotId robot_id = robots_to_assign.at(row).id();
                 current_tactic_robot_id_assignment.emplace(tactic_vector.at(col),
                                                            robot_id);
-                tactic_vector.at(col)->setLastExecutionRobot(robot_id);
 
-                auto primitives = primitive_sets.at(col);
-                CHECK(primitives.contains(robot_id))
-                    << "Couldn't find a primitive for robot id " << robot_id;
+                // Only the assigned robot needs the tactic's FSM to be updated, if it
+                // wasn't already updated to find the cost of the robot. This has to
+                // happen before the last execution robot is updated, so that the FSM
+                // is only reset if the tactic was assigned to a different robot.
+                std::shared_ptr<Primitive> primitive;
+                auto primitive_it = primitive_sets.at(col).find(robot_id);
+                if (primitive_it != primitive_sets.at(col).end())
+                {
+                    primitive = primitive_it->second;
+                }
+                else
+                {
+                    primitive =
+                        tactic_vector.at(col)->get(world_ptr, robots_to_assign.at(row));
+                }
+                tactic_vector.at(col)->setLastExecutionRobot(robot_id);
 
                 // Create the list of obstacles
                 auto motion_constraints = buildMotionConstraintSet(
@@ -368,42 +364,94 @@ Play::assignTactics(const WorldPtr &world_ptr, TacticVector tactic_vector,
 
                 // Only generate primitive proto message for the final primitive to robot
                 // assignment
-                auto [traj_path, primitive_proto] =
-                    primitives[robot_id]->generatePrimitiveProtoMessage(
-                        *world_ptr, motion_constraints, robot_trajectories,
-                        obstacle_factory);
+                planning_requests.emplace_back(
+                    TrajectoryPlanningRequest{robot_id, primitive, motion_constraints});
 
-                if (traj_path.has_value())
-                {
-                    robot_trajectories.insert_or_assign(robot_id, traj_path.value());
-                }
-                else
-                {
-                    robot_trajectories.erase(robot_id);
-                }
-
-                primitives_to_run->mutable_robot_primitives()->insert(
-                    {robot_id, *primitive_proto});
                 remaining_robots.erase(
                     std::remove_if(remaining_robots.begin(), remaining_robots.end(),
                                    [robots_to_assign, row](const Robot &robot) {
                                        return robot.id() == robots_to_assign.at(row).id();
                                    }),
                     remaining_robots.end());
-
-                primitives[robot_id]->getVisualizationProtos(obstacle_list,
-                                                             path_visualization);
                 break;
             }
         }
     }
 
+    // All robots assigned from this tactic vector are planned together as one wave
+    planTrajectories(world_ptr, planning_requests, *primitives_to_run);
+
     return std::tuple<std::vector<Robot>, std::unique_ptr<TbotsProto::PrimitiveSet>,
                       std::map<std::shared_ptr<const Tactic>, RobotId>>{
         remaining_robots, std::move(primitives_to_run),
         current_tactic_robot_id_assignment};
 }
 
+ThreadPool &Play::trajectoryPlanningThreadPool()
+{
+    static ThreadPool thread_pool(std::thread::hardware_concurrency());
+    return thread_pool;
+}
+
+void Play::planTrajectories(const WorldPtr &world_ptr,
+                            const std::vector<TrajectoryPlanningRequest> &requests,
+                            TbotsProto::PrimitiveSet &primitives_to_run)
+{
+    ZoneScopedN("Play: Plan trajectories");
+
+    using PlanningResult =
+        std::pair<std::optional<TrajectoryPath>, std::unique_ptr<TbotsProto::Primitive>>;
+
+    // Every robot in this wave plans against the same snapshot of robot_trajectories,
+    // which is not modified until all robots in the wave are done planning. This makes
+    // the planned trajectories independent of the order in which the workers run.
+    std::vector<std::future<PlanningResult>> planning_results;
+    planning_results.reserve(requests.size());
+    for (const TrajectoryPlanningRequest &request : requests)
+    {
+        planning_results.emplace_back(
+            trajectoryPlanningThreadPool().submit([this, &world_ptr, &request]() {
+                ZoneScopedN("Play: Plan trajectory for robot");
+                ZoneValue(request.robot_id);
+                return request.primitive->generatePrimitiveProtoMessage(
+                    *world_ptr, request.motion_constraints, robot_trajectories,
+                    obstacle_factory);
+            }));
+    }
+
+    // Wait for the whole wave to finish before touching any results, so that no worker
+    // is still reading robot_trajectories when we start committing to it
+    for (const std::future<PlanningResult> &planning_result : planning_results)
+    {
+        planning_result.wait();
+    }
+
+    // Commit the results in request order, which is the same order the robots would
+    // have been planned in sequentially
+    for (size_t i = 0; i < requests.size(); i++)
+    {
+        const TrajectoryPlanningRequest &request = requests[i];
+        auto [traj_path, primitive_proto]        = planning_results[i].get();
+
+        if (traj_path.has_value())
+        {
+            robot_trajectories.insert_or_assign(
+                request.robot_id,
+                PlannedTrajectoryPath{traj_path.value(),
+                                      world_ptr->getMostRecentTimestamp()});
+        }
+        else
+        {
+            robot_trajectories.erase(request.robot_id);
+        }
+
+        primitives_to_run.mutable_robot_primitives()->insert(
+            {request.robot_id, *primitive_proto});
+
+        request.primitive->getVisualizationProtos(obstacle_list, path_visualization);
+    }
+}
+
 std::vector<std::string> Play::getState()
 {
     // by default just return the name of the play
@@ -9,6 +9,7 @@
 #include "software/ai/hl/stp/tactic/goalie/goalie_tactic.h"
 #include "software/ai/hl/stp/tactic/tactic.h"
 #include "software/ai/navigator/trajectory/trajectory_planner.h"
+#include "software/multithreading/thread_pool.hpp"
 
 // This coroutine returns a list of list of shared_ptrs to Tactic objects
 using TacticCoroutine = boost::coroutines2::coroutine<PriorityTacticVector>;
@@ -82,7 +83,7 @@ class Play
     std::map<std::shared_ptr<const Tactic>, RobotId> tactic_robot_id_assignment;
 
     // Cached robot trajectories
-    std::map<RobotId, TrajectoryPath> robot_trajectories;
+    std::map<RobotId, PlannedTrajectoryPath> robot_trajectories;
 
     // List of all obstacles in the world at the current iteration
     // and all robot paths. Used for visualization
@@ -99,6 +100,17 @@ class Play
     virtual void updateTactics(const PlayUpdate& play_update);
 
    private:
+    /**
+     * A robot that has been assigned a primitive, and whose trajectory still needs to
+     * be planned
+     */
+    struct TrajectoryPlanningRequest
+    {
+        RobotId robot_id;
+        std::shared_ptr<Primitive> primitive;
+        std::set<TbotsProto::MotionConstraint> motion_constraints;
+    };
+
     /**
      * Assigns the given tactics to as many of the given robots
      *
@@ -115,6 +127,32 @@ class Play
     assignTactics(const WorldPtr& world_ptr, TacticVector tactic_vector,
                   const std::vector<Robot>& robots_to_assign);
 
+    /**
+     * Plans the trajectories of a wave of robots in parallel, and generates their
+     * primitive protos.
+     *
+     * All robots in the wave see the robot trajectories committed by previous waves
+     * (and the previous tick's trajectories for all other robots). The results are
+     * committed to robot_trajectories in the order of the requests once the whole wave
+     * is done, so the output does not depend on the number of worker threads or the
+     * order in which they finish.
+     *
+     * @param world_ptr The world
+     * @param requests The robots to plan trajectories for, in commit order
+     * @param primitives_to_run The primitive set to add the generated primitives to
+     */
+    void planTrajectories(const WorldPtr& world_ptr,
+                          const std::vector<TrajectoryPlanningRequest>& requests,
+                          TbotsProto::PrimitiveSet& primitives_to_run);
+
+    /**
+     * Gets the fixed pool of worker threads shared by all plays for planning robot
+     * trajectories
+     *
+     * @return the trajectory planning thread pool
+     */
+    static ThreadPool& trajectoryPlanningThreadPool();
+
     /**
      * Returns a list of shared_ptrs to the Tactics the Play wants to run at this time, in
      * order of priority. The Tactic at the beginning of the vector has the highest
@@ -3,6 +3,7 @@
 #include "proto/message_translation/tbots_protobuf.h"
 #include "shared/constants.h"
 #include "software/ai/evaluation/enemy_threat.h"
+#include "software/ai/evaluation/evaluation_context.h"
 #include "software/ai/evaluation/find_open_areas.h"
 #include "software/ai/evaluation/possession.h"
 #include "software/ai/hl/stp/tactic/attacker/attacker_tactic.h"
@@ -67,7 +68,8 @@ void ShootOrChipPlay::getNextTactics(TacticCoroutine::push_type &yield,
         {
             enemy_robot_points.emplace_back(robot.position());
         }
-        std::vector<Circle> chip_targets = findGoodChipTargets(*world_ptr);
+        std::vector<Circle> chip_targets =
+            EvaluationContext::get(world_ptr)->findGoodChipTargets();
         for (unsigned i = 0;
              i < chip_targets.size() && i < move_to_open_area_tactics.size(); i++)
         {
@@ -40,7 +40,7 @@ void ShootOrPassPlayFSM::updateOffensivePositioningTactics(
 
     std::vector<Point> best_receiving_positions =
         receiver_position_generator.getBestReceivingPositions(
-            *world, num_tactics, existing_receiver_positions, pass_origin_override);
+            world, num_tactics, existing_receiver_positions, pass_origin_override);
     // Note that getBestReceivingPositions may return fewer positions than requested
     // if there are not enough robots, so we will need to check the size of the vector.
     for (unsigned int i = 0;
@@ -79,7 +79,7 @@ void ShootOrPassPlayFSM::lookForPass(const Update& event)
             robots_to_ignore.push_back(robot_with_ball_opt.value().id());
         }
         best_pass_and_score_so_far =
-            pass_generator.getBestPass(*event.common.world_ptr, robots_to_ignore);
+            pass_generator.getBestPass(event.common.world_ptr, robots_to_ignore);
 
         // update the best pass in the attacker tactic
         attacker_tactic->updateControlParams(best_pass_and_score_so_far.pass, false);
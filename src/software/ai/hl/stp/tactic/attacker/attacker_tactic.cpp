@@ -3,6 +3,7 @@
 #include "proto/message_translation/tbots_geometry.h"
 #include "shared/constants.h"
 #include "software/ai/evaluation/calc_best_shot.h"
+#include "software/ai/evaluation/evaluation_context.h"
 #include "software/logger/logger.h"
 #include "software/world/ball.h"
 
@@ -47,10 +48,10 @@ void AttackerTactic::updatePrimitive(const TacticUpdate& tactic_update, bool res
             DribbleFSM(ai_config.dribble_tactic_config()), AttackerFSM(ai_config));
     }
 
-    std::optional<Shot> shot = calcBestShotOnGoal(
-        tactic_update.world_ptr->field(), tactic_update.world_ptr->friendlyTeam(),
-        tactic_update.world_ptr->enemyTeam(), tactic_update.world_ptr->ball().position(),
-        TeamType::ENEMY, {tactic_update.robot});
+    std::optional<Shot> shot =
+        EvaluationContext::get(tactic_update.world_ptr)
+            ->calcBestShotOnGoal(tactic_update.world_ptr->ball().position(),
+                                 TeamType::ENEMY, {tactic_update.robot});
     if (shot && shot->getOpenAngle() <
                     Angle::fromDegrees(
                         ai_config.attacker_tactic_config().min_open_angle_for_shot_deg()))
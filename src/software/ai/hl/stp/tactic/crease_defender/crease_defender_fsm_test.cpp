@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include "proto/parameters.pb.h"
+#include "software/ai/hl/stp/tactic/crease_defender/crease_defender_tactic.h"
 #include "software/test_util/equal_within_tolerance.h"
 #include "software/test_util/test_util.h"
 
@@ -198,3 +199,23 @@ TEST(CreaseDefenderFSMTest, test_transitions)
         control_params, TacticUpdate(robot, world, [](std::shared_ptr<Primitive>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::X));
 }
+
+TEST(CreaseDefenderFSMTest, test_estimated_cost_matches_cost_of_blocking_threat)
+{
+    TbotsProto::AiConfig ai_config;
+    std::shared_ptr<World> world = ::TestUtil::createBlankTestingWorld();
+    Robot robot                  = ::TestUtil::createRobotAtPos(Point(-2, -3));
+    ::TestUtil::setBallPosition(world, Point(2, 3), Timestamp::fromSeconds(123));
+
+    // Ball in the enemy half, so the crease defender blocks the threat
+    CreaseDefenderTactic tactic(ai_config);
+    tactic.updateControlParams(Point(2, 3), TbotsProto::CreaseDefenderAlignment::LEFT);
+    std::optional<double> estimated_cost = tactic.estimateCost(world, robot);
+    ASSERT_TRUE(estimated_cost.has_value());
+    EXPECT_DOUBLE_EQ(estimated_cost.value(),
+                     tactic.get(world, robot)->getEstimatedPrimitiveCost());
+
+    // A robot further from the defense area takes longer to get into position
+    Robot far_robot = ::TestUtil::createRobotAtPos(Point(3, 3));
+    EXPECT_GT(tactic.estimateCost(world, far_robot).value(), estimated_cost.value());
+}
@@ -3,6 +3,7 @@
 #include "proto/parameters.pb.h"
 #include "shared/constants.h"
 #include "software/ai/evaluation/calc_best_shot.h"
+#include "software/ai/hl/stp/tactic/move_primitive.h"
 #include "software/geom/algorithms/intersection.h"
 #include "software/geom/point.h"
 #include "software/geom/ray.h"
@@ -24,6 +25,22 @@ CreaseDefenderTactic::CreaseDefenderTactic(TbotsProto::AiConfig ai_config)
     }
 }
 
+std::optional<double> CreaseDefenderTactic::estimateCost(const WorldPtr &world_ptr,
+                                                         const Robot &robot) const
+{
+    // Estimate the time to get to the point on the defense area that blocks the threat,
+    // with the same inflation of the defense area that the FSM uses
+    std::optional<Point> block_threat_point = CreaseDefenderFSM::findBlockThreatPoint(
+        world_ptr->field(), control_params.enemy_threat_origin,
+        control_params.crease_defender_alignment,
+        ai_config.robot_navigation_obstacle_config().robot_obstacle_inflation_factor() +
+            0.5);
+    return MovePrimitive::estimateCost(
+        robot, block_threat_point.value_or(robot.position()),
+        (control_params.enemy_threat_origin - robot.position()).orientation(),
+        control_params.max_allowed_speed_mode);
+}
+
 void CreaseDefenderTactic::accept(TacticVisitor &visitor) const
 {
     visitor.visit(*this);
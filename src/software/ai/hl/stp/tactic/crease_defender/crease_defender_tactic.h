@@ -56,6 +56,9 @@ class CreaseDefenderTactic : public Tactic
             TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT,
         TbotsProto::BallStealMode ball_steal_mode = TbotsProto::BallStealMode::STEAL);
 
+    std::optional<double> estimateCost(const WorldPtr &world_ptr,
+                                       const Robot &robot) const override;
+
     void accept(TacticVisitor &visitor) const override;
 
    private:
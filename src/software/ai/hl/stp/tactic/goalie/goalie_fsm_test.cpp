@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include "software/ai/hl/stp/tactic/goalie/goalie_tactic.h"
 #include "software/geom/algorithms/contains.h"
 #include "software/test_util/test_util.h"
 
@@ -192,3 +193,26 @@ TEST(GoalieFSMTest, test_transitions)
         {}, TacticUpdate(goalie, world_ptr, [](std::shared_ptr<Primitive>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<DribbleFSM>));
 }
+
+TEST(GoalieFSMTest, test_estimated_cost_matches_cost_of_positioning)
+{
+    Robot goalie                     = ::TestUtil::createRobotAtPos(Point(-4.5, 0));
+    std::shared_ptr<World> world_ptr = ::TestUtil::createBlankTestingWorld();
+    TbotsProto::AiConfig ai_config;
+    GoalieTactic tactic(ai_config);
+
+    // Goalie positions itself to block
+    ::TestUtil::setBallPosition(world_ptr, Point(0, 0), Timestamp::fromSeconds(123));
+    ::TestUtil::setBallVelocity(world_ptr, Vector(-0.1, 0), Timestamp::fromSeconds(123));
+    std::optional<double> estimated_cost = tactic.estimateCost(world_ptr, goalie);
+    ASSERT_TRUE(estimated_cost.has_value());
+    EXPECT_DOUBLE_EQ(estimated_cost.value(),
+                     tactic.get(world_ptr, goalie)->getEstimatedPrimitiveCost());
+
+    // Goalie moves to the goal line
+    tactic.updateControlParams(true);
+    estimated_cost = tactic.estimateCost(world_ptr, goalie);
+    ASSERT_TRUE(estimated_cost.has_value());
+    EXPECT_DOUBLE_EQ(estimated_cost.value(),
+                     tactic.get(world_ptr, goalie)->getEstimatedPrimitiveCost());
+}
@@ -1,6 +1,7 @@
 #include "software/ai/hl/stp/tactic/goalie/goalie_tactic.h"
 
 #include "software/ai/evaluation/calc_best_shot.h"
+#include "software/ai/hl/stp/tactic/move_primitive.h"
 #include "software/geom/algorithms/contains.h"
 #include "software/geom/point.h"
 
@@ -27,6 +28,24 @@ void GoalieTactic::updateControlParams(bool should_move_to_goal_line)
     control_params.should_move_to_goal_line = should_move_to_goal_line;
 }
 
+std::optional<double> GoalieTactic::estimateCost(const WorldPtr &world_ptr,
+                                                 const Robot &robot) const
+{
+    if (control_params.should_move_to_goal_line)
+    {
+        return MovePrimitive::estimateCost(robot, world_ptr->field().friendlyGoalCenter(),
+                                           Angle::zero(), max_allowed_speed_mode);
+    }
+
+    // Estimate the time to get into position between the ball and the friendly goal
+    Point goalie_position = GoalieFSM::getGoaliePositionToBlock(
+        world_ptr->ball(), world_ptr->field(), ai_config.goalie_tactic_config());
+    return MovePrimitive::estimateCost(
+        robot, goalie_position,
+        (world_ptr->ball().position() - goalie_position).orientation(),
+        max_allowed_speed_mode);
+}
+
 void GoalieTactic::accept(TacticVisitor &visitor) const
 {
     visitor.visit(*this);
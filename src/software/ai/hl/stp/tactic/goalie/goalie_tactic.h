@@ -31,6 +31,9 @@ class GoalieTactic : public Tactic
 
     void updateControlParams(bool should_move_to_goal_line);
 
+    std::optional<double> estimateCost(const WorldPtr &world_ptr,
+                                       const Robot &robot) const override;
+
     void accept(TacticVisitor &visitor) const override;
 
     DEFINE_TACTIC_DONE_AND_GET_FSM_STATE
@@ -10,6 +10,13 @@ HaltTactic::HaltTactic() : Tactic(std::set<RobotCapability>()), fsm_map()
     }
 }
 
+std::optional<double> HaltTactic::estimateCost(const WorldPtr &world_ptr,
+                                               const Robot &robot) const
+{
+    // The HaltTactic always runs a StopPrimitive, which has no cost
+    return 0.0;
+}
+
 void HaltTactic::accept(TacticVisitor &visitor) const
 {
     visitor.visit(*this);
@@ -15,6 +15,9 @@ class HaltTactic : public Tactic
      */
     explicit HaltTactic();
 
+    std::optional<double> estimateCost(const WorldPtr& world_ptr,
+                                       const Robot& robot) const override;
+
     void accept(TacticVisitor& visitor) const override;
 
     DEFINE_TACTIC_DONE_AND_GET_FSM_STATE
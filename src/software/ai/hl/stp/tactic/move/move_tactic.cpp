@@ -2,6 +2,8 @@
 
 #include <algorithm>
 
+#include "software/ai/hl/stp/tactic/move_primitive.h"
+
 MoveTactic::MoveTactic()
     : Tactic({RobotCapability::Move}),
       fsm_map(),
@@ -61,6 +63,14 @@ void MoveTactic::updatePrimitive(const TacticUpdate &tactic_update, bool reset_f
         ->process_event(MoveFSM::Update(control_params, tactic_update));
 }
 
+std::optional<double> MoveTactic::estimateCost(const WorldPtr &world_ptr,
+                                               const Robot &robot) const
+{
+    return MovePrimitive::estimateCost(robot, control_params.destination,
+                                       control_params.final_orientation,
+                                       control_params.max_allowed_speed_mode);
+}
+
 void MoveTactic::accept(TacticVisitor &visitor) const
 {
     visitor.visit(*this);
@@ -54,6 +54,9 @@ class MoveTactic : public Tactic
                              TbotsProto::MaxAllowedSpeedMode max_allowed_speed_mode,
                              TbotsProto::ObstacleAvoidanceMode obstacle_avoidance_mode);
 
+    std::optional<double> estimateCost(const WorldPtr& world_ptr,
+                                       const Robot& robot) const override;
+
     void accept(TacticVisitor& visitor) const override;
 
     DEFINE_TACTIC_DONE_AND_GET_FSM_STATE
@@ -242,3 +242,19 @@ TEST_F(MoveTacticTest, test_spinning_move_counter_clockwise)
             terminating_validation_functions, non_terminating_validation_functions,
             Duration::fromSeconds(10));
 }
+
+TEST(MoveTacticCostTest, test_estimated_cost_matches_primitive_cost)
+{
+    std::shared_ptr<World> world = ::TestUtil::createBlankTestingWorld();
+    Robot robot                  = ::TestUtil::createRobotAtPos(Point(-2, -3));
+
+    MoveTactic tactic;
+    tactic.updateControlParams(Point(2, 3), Angle::half(),
+                               TbotsProto::MaxAllowedSpeedMode::STOP_COMMAND,
+                               TbotsProto::ObstacleAvoidanceMode::SAFE);
+
+    std::optional<double> estimated_cost = tactic.estimateCost(world, robot);
+    ASSERT_TRUE(estimated_cost.has_value());
+    EXPECT_DOUBLE_EQ(estimated_cost.value(),
+                     tactic.get(world, robot)->getEstimatedPrimitiveCost());
+}
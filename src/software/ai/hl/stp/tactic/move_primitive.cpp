@@ -27,30 +27,39 @@ MovePrimitive::MovePrimitive(
     }
     else
     {
-        double max_speed = convertMaxAllowedSpeedModeToMaxAllowedSpeed(
-            max_allowed_speed_mode, robot.robotConstants());
-        trajectory.generate(robot.position(), destination, robot.velocity(), max_speed,
-                            robot.robotConstants().robot_max_acceleration_m_per_s_2,
-                            robot.robotConstants().robot_max_deceleration_m_per_s_2);
-
-        angular_trajectory.generate(
-            robot.orientation(), final_angle, robot.angularVelocity(),
-            AngularVelocity::fromRadians(
-                robot.robotConstants().robot_max_ang_speed_rad_per_s),
-            AngularVelocity::fromRadians(
-                robot.robotConstants().robot_max_ang_acceleration_rad_per_s_2),
-            AngularVelocity::fromRadians(
-                robot.robotConstants().robot_max_ang_acceleration_rad_per_s_2));
-
         estimated_cost =
-            std::max(trajectory.getTotalTime(), angular_trajectory.getTotalTime());
+            estimateCost(robot, destination, final_angle, max_allowed_speed_mode);
     }
 }
 
+double MovePrimitive::estimateCost(
+    const Robot &robot, const Point &destination, const Angle &final_angle,
+    const TbotsProto::MaxAllowedSpeedMode &max_allowed_speed_mode)
+{
+    double max_speed = convertMaxAllowedSpeedModeToMaxAllowedSpeed(
+        max_allowed_speed_mode, robot.robotConstants());
+    BangBangTrajectory2D trajectory;
+    trajectory.generate(robot.position(), destination, robot.velocity(), max_speed,
+                        robot.robotConstants().robot_max_acceleration_m_per_s_2,
+                        robot.robotConstants().robot_max_deceleration_m_per_s_2);
+
+    BangBangTrajectory1DAngular angular_trajectory;
+    angular_trajectory.generate(
+        robot.orientation(), final_angle, robot.angularVelocity(),
+        AngularVelocity::fromRadians(
+            robot.robotConstants().robot_max_ang_speed_rad_per_s),
+        AngularVelocity::fromRadians(
+            robot.robotConstants().robot_max_ang_acceleration_rad_per_s_2),
+        AngularVelocity::fromRadians(
+            robot.robotConstants().robot_max_ang_acceleration_rad_per_s_2));
+
+    return std::max(trajectory.getTotalTime(), angular_trajectory.getTotalTime());
+}
+
 std::pair<std::optional<TrajectoryPath>, std::unique_ptr<TbotsProto::Primitive>>
 MovePrimitive::generatePrimitiveProtoMessage(
     const World &world, const std::set<TbotsProto::MotionConstraint> &motion_constraints,
-    const std::map<RobotId, TrajectoryPath> &robot_trajectories,
+    const std::map<RobotId, PlannedTrajectoryPath> &robot_trajectories,
     const RobotNavigationObstacleFactory &obstacle_factory)
 {
     // Generate obstacle avoiding trajectory
@@ -69,7 +78,7 @@ MovePrimitive::generatePrimitiveProtoMessage(
     // If the robot is in a static obstacle, then we should first move to the nearest
     // point out
     std::optional<Point> updated_start_position =
-        endInObstacleSample(field_obstacles, robot.position(), navigable_area);
+        endInObstacleSample(*field_obstacles, robot.position(), navigable_area);
     if (updated_start_position.has_value() &&
         updated_start_position.value() != robot.position())
     {
@@ -78,7 +87,7 @@ MovePrimitive::generatePrimitiveProtoMessage(
     else
     {
         std::optional<Point> updated_destination =
-            endInObstacleSample(field_obstacles, destination, navigable_area);
+            endInObstacleSample(*field_obstacles, destination, navigable_area);
         if (updated_destination.has_value())
         {
             // Update the destination. Note that this may be the same as the original
@@ -93,22 +102,27 @@ MovePrimitive::generatePrimitiveProtoMessage(
         }
     }
 
-    std::optional<Point> prev_sub_destination;
+    // Planners are long lived and shared by all primitives generated on this thread
+    TrajectoryPlanner &planner = TrajectoryPlanner::getThreadLocalPlanner();
+
+    // Warm start from the trajectory path planned for this robot on a previous tick
     auto prev_trajectory_it = robot_trajectories.find(robot.id());
     if (prev_trajectory_it != robot_trajectories.end())
     {
-        const auto &prev_trajectory_path_nodes =
-            prev_trajectory_it->second.getTrajectoryPathNodes();
-        if (!prev_trajectory_path_nodes.empty())
-        {
-            prev_sub_destination =
-                prev_trajectory_path_nodes[0].getTrajectory()->getDestination();
-        }
+        const PlannedTrajectoryPath &prev_trajectory = prev_trajectory_it->second;
+        double prev_trajectory_age_s =
+            (world.getMostRecentTimestamp() - prev_trajectory.start_timestamp)
+                .toSeconds();
+        traj_path = planner.findWarmStartedTrajectory(
+            robot.position(), destination, robot.velocity(), constraints, obstacles,
+            navigable_area, prev_trajectory.traj_path, prev_trajectory_age_s);
+    }
+    else
+    {
+        traj_path =
+            planner.findTrajectory(robot.position(), destination, robot.velocity(),
+                                   constraints, obstacles, navigable_area);
     }
-
-    traj_path = planner.findTrajectory(robot.position(), destination, robot.velocity(),
-                                       constraints, obstacles, navigable_area,
-                                       prev_sub_destination);
 
     if (!traj_path.has_value())
     {
@@ -138,7 +152,7 @@ MovePrimitive::generatePrimitiveProtoMessage(
         {
             TbotsProto::TrajectoryPathParams2D::SubDestination sub_destination_proto;
             *(sub_destination_proto.mutable_sub_destination()) =
-                *createPointProto(path_nodes[i].getTrajectory()->getDestination());
+                *createPointProto(path_nodes[i].getTrajectory().getDestination());
             sub_destination_proto.set_connection_time_s(
                 static_cast<float>(path_nodes[i].getTrajectoryEndTime()));
             *(primitive_proto->mutable_move()
@@ -178,34 +192,23 @@ MovePrimitive::generatePrimitiveProtoMessage(
 
 void MovePrimitive::updateObstacles(
     const World &world, const std::set<TbotsProto::MotionConstraint> &motion_constraints,
-    const std::map<RobotId, TrajectoryPath> &robot_trajectories,
+    const std::map<RobotId, PlannedTrajectoryPath> &robot_trajectories,
     const RobotNavigationObstacleFactory &obstacle_factory)
 {
-    // Separately store the non-robot + non-ball obstacles
+    // The field, enemy robot and ball obstacles are the same for every robot planning
+    // in this world, so they are shared through the obstacle factory's cache. Only the
+    // friendly robot obstacles depend on which robot is planning.
     field_obstacles =
-        obstacle_factory.createObstaclesFromMotionConstraints(motion_constraints, world);
-
-    obstacles = field_obstacles;
+        obstacle_factory.getObstaclesFromMotionConstraints(motion_constraints, world);
+    std::shared_ptr<const std::vector<ObstaclePtr>> enemy_robot_obstacles =
+        obstacle_factory.getEnemyRobotObstacles(world, obstacle_avoidance_mode);
 
-    for (const Robot &enemy : world.enemyTeam().getAllRobots())
-    {
-        if (obstacle_avoidance_mode == TbotsProto::SAFE)
-        {
-            // Generate a possibly long stadium shape obstacle in the region
-            // where the enemy robot may move in
-            obstacles.push_back(obstacle_factory.createStadiumEnemyRobotObstacle(enemy));
-        }
-        else if (obstacle_avoidance_mode == TbotsProto::AGGRESSIVE)
-        {
-            // Generate a moving obstacle depending on the enemy robot's velocity.
-            // This is considered a more aggressive strategy as it assumes the enemy
-            // robot is moving at a constant speed. The generated obstacle can also be
-            // much smaller than the stadium shape obstacle, allowing the robot to move
-            // more freely.
-            obstacles.push_back(
-                obstacle_factory.createConstVelocityEnemyRobotObstacle(enemy));
-        }
-    }
+    obstacles.clear();
+    obstacles.reserve(field_obstacles->size() + enemy_robot_obstacles->size() +
+                      world.friendlyTeam().numRobots());
+    obstacles.insert(obstacles.end(), field_obstacles->begin(), field_obstacles->end());
+    obstacles.insert(obstacles.end(), enemy_robot_obstacles->begin(),
+                     enemy_robot_obstacles->end());
 
     for (const Robot &friendly : world.friendlyTeam().getAllRobots())
     {
@@ -214,22 +217,20 @@ void MovePrimitive::updateObstacles(
             auto traj_iter = robot_trajectories.find(friendly.id());
             if (traj_iter != robot_trajectories.end())
             {
-                obstacles.push_back(
-                    obstacle_factory.createFromMovingRobot(friendly, traj_iter->second));
+                obstacles.push_back(obstacle_factory.createFromMovingRobot(
+                    friendly, traj_iter->second.traj_path));
             }
             else
             {
                 obstacles.push_back(
-                    obstacle_factory.createStaticObstacleFromRobotPosition(
-                        friendly.position()));
+                    obstacle_factory.getStaticFriendlyRobotObstacle(world, friendly));
             }
         }
     }
 
     if (ball_collision_type == TbotsProto::AVOID)
     {
-        obstacles.push_back(
-            obstacle_factory.createFromBallPosition(world.ball().position()));
+        obstacles.push_back(obstacle_factory.getBallObstacle(world));
     }
 }
 
@@ -36,6 +36,21 @@ class MovePrimitive : public Primitive
 
     ~MovePrimitive() override = default;
 
+    /**
+     * Estimates the cost of moving the given robot to the destination, which is the
+     * time it would take to reach the destination and final angle (ignoring obstacles)
+     *
+     * @param robot Robot to move
+     * @param destination Destination position of the robot
+     * @param final_angle Desired final orientation of the robot
+     * @param max_allowed_speed_mode Max allowed speed the robot can move at
+     *
+     * @return the estimated cost of the move primitive
+     */
+    static double estimateCost(
+        const Robot &robot, const Point &destination, const Angle &final_angle,
+        const TbotsProto::MaxAllowedSpeedMode &max_allowed_speed_mode);
+
     /**
      * Gets the primitive proto message
      *
@@ -49,7 +64,7 @@ class MovePrimitive : public Primitive
     generatePrimitiveProtoMessage(
         const World &world,
         const std::set<TbotsProto::MotionConstraint> &motion_constraints,
-        const std::map<RobotId, TrajectoryPath> &robot_trajectories,
+        const std::map<RobotId, PlannedTrajectoryPath> &robot_trajectories,
         const RobotNavigationObstacleFactory &obstacle_factory) override;
 
     /**
@@ -73,10 +88,11 @@ class MovePrimitive : public Primitive
      * @param robot_trajectories A map of the friendly robots' known trajectories
      * @param obstacle_factory Obstacle factory to use
      */
-    void updateObstacles(const World &world,
-                         const std::set<TbotsProto::MotionConstraint> &motion_constraints,
-                         const std::map<RobotId, TrajectoryPath> &robot_trajectories,
-                         const RobotNavigationObstacleFactory &obstacle_factory);
+    void updateObstacles(
+        const World &world,
+        const std::set<TbotsProto::MotionConstraint> &motion_constraints,
+        const std::map<RobotId, PlannedTrajectoryPath> &robot_trajectories,
+        const RobotNavigationObstacleFactory &obstacle_factory);
 
     Robot robot;
     Point destination;
@@ -91,13 +107,11 @@ class MovePrimitive : public Primitive
 
     // List of all obstacles that the robot should avoid
     std::vector<ObstaclePtr> obstacles;
-    // List of only the motion constraint obstacles that the robot should avoid
-    std::vector<ObstaclePtr> field_obstacles;
+    // List of only the motion constraint obstacles that the robot should avoid, shared
+    // with other robots planning with the same motion constraints
+    std::shared_ptr<const std::vector<ObstaclePtr>> field_obstacles;
 
-    BangBangTrajectory2D trajectory;
     std::optional<TrajectoryPath> traj_path;
-    BangBangTrajectory1DAngular angular_trajectory;
-    TrajectoryPlanner planner;
 
     constexpr static unsigned int NUM_TRAJECTORY_VISUALIZATION_POINTS = 10;
 };
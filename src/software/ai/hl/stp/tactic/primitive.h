@@ -2,6 +2,7 @@
 
 #include "proto/primitive.pb.h"
 #include "software/ai/navigator/obstacle/robot_navigation_obstacle_factory.h"
+#include "software/ai/navigator/trajectory/planned_trajectory_path.h"
 #include "software/ai/navigator/trajectory/trajectory_path.h"
 
 /**
@@ -29,7 +30,7 @@ class Primitive
     generatePrimitiveProtoMessage(
         const World &world,
         const std::set<TbotsProto::MotionConstraint> &motion_constraints,
-        const std::map<RobotId, TrajectoryPath> &robot_trajectories,
+        const std::map<RobotId, PlannedTrajectoryPath> &robot_trajectories,
         const RobotNavigationObstacleFactory &obstacle_factory) = 0;
 
     /**
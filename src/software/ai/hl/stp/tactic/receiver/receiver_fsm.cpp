@@ -1,5 +1,6 @@
 #include "software/ai/hl/stp/tactic/receiver/receiver_fsm.h"
 
+#include "software/ai/evaluation/evaluation_context.h"
 #include "software/ai/hl/stp/tactic/move_primitive.h"
 
 Angle ReceiverFSM::getOneTouchShotDirection(const Ray& shot, const Ball& ball)
@@ -63,18 +64,18 @@ Shot ReceiverFSM::getOneTouchShotPositionAndOrientation(const Robot& robot,
     return Shot(ideal_position, ideal_orientation);
 }
 
-std::optional<Shot> ReceiverFSM::findFeasibleShot(const World& world,
+std::optional<Shot> ReceiverFSM::findFeasibleShot(const WorldPtr& world_ptr,
                                                   const Robot& assigned_robot)
 {
     // Check if we can shoot on the enemy goal from the receiver position
     std::optional<Shot> best_shot_opt =
-        calcBestShotOnGoal(world.field(), world.friendlyTeam(), world.enemyTeam(),
-                           assigned_robot.position(), TeamType::ENEMY, {assigned_robot});
+        EvaluationContext::get(world_ptr)->calcBestShotOnGoal(
+            assigned_robot.position(), TeamType::ENEMY, {assigned_robot});
 
     // The percentage of open net the robot would shoot on
     if (best_shot_opt)
     {
-        Vector robot_to_ball = world.ball().position() - assigned_robot.position();
+        Vector robot_to_ball = world_ptr->ball().position() - assigned_robot.position();
 
         // The angle the robot will have to deflect the ball to shoot
         Vector robot_to_shot_target =
@@ -105,13 +106,13 @@ bool ReceiverFSM::onetouchPossible(const Update& event)
 {
     return !event.control_params.disable_one_touch_shot &&
            receiver_tactic_config.enable_one_touch_kick() &&
-           (findFeasibleShot(*event.common.world_ptr, event.common.robot) !=
+           (findFeasibleShot(event.common.world_ptr, event.common.robot) !=
             std::nullopt);
 }
 
 void ReceiverFSM::updateOnetouch(const Update& event)
 {
-    auto best_shot = findFeasibleShot(*event.common.world_ptr, event.common.robot);
+    auto best_shot = findFeasibleShot(event.common.world_ptr, event.common.robot);
 
     if (best_shot.has_value() && event.control_params.pass)
     {
@@ -73,10 +73,11 @@ struct ReceiverFSM
      * respects max_deflection_for_one_touch_deg for the highest chance
      * of scoring with a one-touch shot. If neither of those are true, return a nullopt
      *
-     * @param world The world to find a feasible shot on
+     * @param world_ptr The world to find a feasible shot on
      * @param assigned_robot The robot that will be performing the one-touch
      */
-    std::optional<Shot> findFeasibleShot(const World& world, const Robot& assigned_robot);
+    std::optional<Shot> findFeasibleShot(const WorldPtr& world_ptr,
+                                         const Robot& assigned_robot);
 
     /**
      * Checks if a one touch shot is possible
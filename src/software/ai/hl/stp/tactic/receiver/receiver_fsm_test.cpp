@@ -116,3 +116,22 @@ INSTANTIATE_TEST_CASE_P(
                        testing::Range(-5.0, 5.0, 2.5)  // Angle deviation from ideal pass,
                                                        // in degrees
                        ));
+
+TEST(ReceiverFSMTest, test_estimated_cost_matches_cost_of_waiting_for_pass)
+{
+    std::shared_ptr<World> world = ::TestUtil::createBlankTestingWorld();
+    Robot robot                  = ::TestUtil::createRobotAtPos(Point(1, 2));
+    ::TestUtil::setBallPosition(world, Point(-1, 0), Timestamp::fromSeconds(0));
+
+    ReceiverTactic tactic(TbotsProto::ReceiverTacticConfig{});
+
+    // The cost can't be estimated without a pass
+    EXPECT_FALSE(tactic.estimateCost(world, robot).has_value());
+
+    // Waiting for the pass
+    tactic.updateControlParams(Pass(Point(-1, 0), Point(2, 1), 4));
+    std::optional<double> estimated_cost = tactic.estimateCost(world, robot);
+    ASSERT_TRUE(estimated_cost.has_value());
+    EXPECT_DOUBLE_EQ(estimated_cost.value(),
+                     tactic.get(world, robot)->getEstimatedPrimitiveCost());
+}
@@ -2,6 +2,7 @@
 
 #include "shared/constants.h"
 #include "software/ai/evaluation/calc_best_shot.h"
+#include "software/ai/hl/stp/tactic/move_primitive.h"
 #include "software/geom/algorithms/closest_point.h"
 #include "software/geom/algorithms/convex_angle.h"
 #include "software/logger/logger.h"
@@ -27,6 +28,20 @@ void ReceiverTactic::updateControlParams(std::optional<Pass> updated_pass,
     control_params.disable_one_touch_shot = disable_one_touch_shot;
 }
 
+std::optional<double> ReceiverTactic::estimateCost(const WorldPtr& world_ptr,
+                                                   const Robot& robot) const
+{
+    if (!control_params.pass.has_value())
+    {
+        return std::nullopt;
+    }
+
+    // Estimate the time to get to the receiving point of the pass
+    return MovePrimitive::estimateCost(robot, control_params.pass->receiverPoint(),
+                                       control_params.pass->receiverOrientation(),
+                                       TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
+}
+
 void ReceiverTactic::accept(TacticVisitor& visitor) const
 {
     visitor.visit(*this);
@@ -31,6 +31,9 @@ class ReceiverTactic : public Tactic
     void updateControlParams(std::optional<Pass> updated_pass,
                              bool disable_one_touch_shot = false);
 
+    std::optional<double> estimateCost(const WorldPtr& world_ptr,
+                                       const Robot& robot) const override;
+
     void accept(TacticVisitor& visitor) const override;
 
     DEFINE_TACTIC_DONE_AND_GET_FSM_STATE
@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include "software/ai/hl/stp/tactic/shadow_enemy/shadow_enemy_tactic.h"
 #include "software/test_util/test_util.h"
 
 TEST(ShadowEnemyFSMTest, test_findBlockPassPoint)
@@ -142,3 +143,25 @@ TEST(ShadowEnemyFSMTest, test_transitions)
         TacticUpdate(shadower, world, [](std::shared_ptr<Primitive>) {})));
     EXPECT_TRUE(fsm.is(boost::sml::state<ShadowEnemyFSM::BlockPassState>));
 }
+
+TEST(ShadowEnemyFSMTest, test_estimated_cost_matches_cost_of_blocking_pass)
+{
+    Robot enemy                  = ::TestUtil::createRobotAtPos(Point(0, 2));
+    Robot shadowee               = ::TestUtil::createRobotAtPos(Point(0, -2));
+    Robot shadower               = ::TestUtil::createRobotAtPos(Point(-2, 0));
+    std::shared_ptr<World> world = ::TestUtil::createBlankTestingWorld();
+    ::TestUtil::setBallPosition(world, Point(0, 2), Timestamp::fromSeconds(0));
+    EnemyThreat enemy_threat{shadowee,     false, Angle::zero(), std::nullopt,
+                             std::nullopt, 1,     enemy};
+
+    ShadowEnemyTactic tactic;
+    tactic.updateControlParams(enemy_threat, 0.5);
+    std::optional<double> estimated_cost = tactic.estimateCost(world, shadower);
+    ASSERT_TRUE(estimated_cost.has_value());
+    EXPECT_DOUBLE_EQ(estimated_cost.value(),
+                     tactic.get(world, shadower)->getEstimatedPrimitiveCost());
+
+    // The last execution robot is estimated the same way
+    tactic.setLastExecutionRobot(shadower.id());
+    EXPECT_DOUBLE_EQ(tactic.estimateCost(world, shadower).value(), estimated_cost.value());
+}
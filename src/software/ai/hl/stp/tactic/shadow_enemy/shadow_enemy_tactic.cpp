@@ -1,5 +1,7 @@
 #include "software/ai/hl/stp/tactic/shadow_enemy/shadow_enemy_tactic.h"
 
+#include "software/ai/hl/stp/tactic/move_primitive.h"
+
 ShadowEnemyTactic::ShadowEnemyTactic()
     : Tactic({RobotCapability::Move, RobotCapability::Kick}),
       fsm_map(),
@@ -19,6 +21,26 @@ void ShadowEnemyTactic::updateControlParams(std::optional<EnemyThreat> enemy_thr
     control_params.shadow_distance = shadow_distance;
 }
 
+std::optional<double> ShadowEnemyTactic::estimateCost(const WorldPtr &world_ptr,
+                                                      const Robot &robot) const
+{
+    // Estimate the time to get between the ball and the threat, which is where the
+    // robot shadows the threat from unless the threat has the ball
+    Point ball_position = world_ptr->ball().position();
+    Point shadow_position =
+        ball_position + (world_ptr->field().friendlyGoalCenter() - ball_position)
+                            .normalize(control_params.shadow_distance);
+    if (control_params.enemy_threat.has_value())
+    {
+        shadow_position = ShadowEnemyFSM::findBlockPassPoint(
+            ball_position, control_params.enemy_threat->robot,
+            control_params.shadow_distance);
+    }
+    return MovePrimitive::estimateCost(robot, shadow_position,
+                                       (ball_position - robot.position()).orientation(),
+                                       TbotsProto::MaxAllowedSpeedMode::PHYSICAL_LIMIT);
+}
+
 void ShadowEnemyTactic::accept(TacticVisitor &visitor) const
 {
     visitor.visit(*this);
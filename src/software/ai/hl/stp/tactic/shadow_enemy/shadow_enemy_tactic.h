@@ -26,6 +26,9 @@ class ShadowEnemyTactic : public Tactic
     void updateControlParams(std::optional<EnemyThreat> enemy_threat,
                              double shadow_distance);
 
+    std::optional<double> estimateCost(const WorldPtr &world_ptr,
+                                       const Robot &robot) const override;
+
     void accept(TacticVisitor &visitor) const override;
 
     DEFINE_TACTIC_DONE_AND_GET_FSM_STATE
@@ -29,7 +29,6 @@ void Tactic::setLastExecutionRobot(std::optional<RobotId> last_execution_robot)
 
 std::map<RobotId, std::shared_ptr<Primitive>> Tactic::get(const WorldPtr &world_ptr)
 {
-    TbotsProto::RobotNavigationObstacleConfig obstacle_config;
     std::map<RobotId, std::shared_ptr<Primitive>> primitives_map;
 
     {
@@ -38,20 +37,30 @@ std::map<RobotId, std::shared_ptr<Primitive>> Tactic::get(const WorldPtr &world_
 
         for (const auto &robot : world_ptr->friendlyTeam().getAllRobots())
         {
-            updatePrimitive(
-                TacticUpdate(robot, world_ptr,
-                             [this](std::shared_ptr<Primitive> new_primitive) {
-                                 primitive = std::move(new_primitive);
-                             }),
-                !last_execution_robot.has_value() ||
-                    last_execution_robot.value() != robot.id());
-
-            CHECK(primitive != nullptr)
-                << "Primitive for " << objectTypeName(*this) << " in state "
-                << getFSMState() << " was not set" << std::endl;
-            primitives_map[robot.id()] = std::move(primitive);
+            primitives_map[robot.id()] = get(world_ptr, robot);
         }
     }
 
     return primitives_map;
 }
+
+std::shared_ptr<Primitive> Tactic::get(const WorldPtr &world_ptr, const Robot &robot)
+{
+    updatePrimitive(TacticUpdate(robot, world_ptr,
+                                 [this](std::shared_ptr<Primitive> new_primitive) {
+                                     primitive = std::move(new_primitive);
+                                 }),
+                    !last_execution_robot.has_value() ||
+                        last_execution_robot.value() != robot.id());
+
+    CHECK(primitive != nullptr) << "Primitive for " << objectTypeName(*this)
+                                << " in state " << getFSMState() << " was not set"
+                                << std::endl;
+    return std::move(primitive);
+}
+
+std::optional<double> Tactic::estimateCost(const WorldPtr &world_ptr,
+                                           const Robot &robot) const
+{
+    return std::nullopt;
+}
@@ -92,6 +92,32 @@ class Tactic
      */
     std::map<RobotId, std::shared_ptr<Primitive>> get(const WorldPtr &world_ptr);
 
+    /**
+     * Updates and returns the primitive for the given robot from this tactic
+     *
+     * @param world_ptr The updated world
+     * @param robot The robot to get the primitive for
+     *
+     * @return the next primitive for the robot
+     */
+    std::shared_ptr<Primitive> get(const WorldPtr &world_ptr, const Robot &robot);
+
+    /**
+     * Estimates the cost of the given robot running this tactic without updating the
+     * tactic's FSM. Tactics that can do this cheaply should override it. The estimate
+     * is only used to assign robots to tactics, so it does not have to match the cost
+     * of the primitive that get() would return, but it should be in the same unit (the
+     * time in seconds for the robot to get into position).
+     *
+     * @param world_ptr The updated world
+     * @param robot The robot to estimate the cost for
+     *
+     * @return the estimated cost of the robot running this tactic, or std::nullopt if
+     * the primitive has to be generated to find the cost
+     */
+    virtual std::optional<double> estimateCost(const WorldPtr &world_ptr,
+                                               const Robot &robot) const;
+
     /**
      * Accepts a Tactic Visitor and calls the visit function on itself
      *
@@ -28,6 +28,7 @@ class ConstVelocityObstacle : public GeomObstacle<GEOM_TYPE>
     double distance(const Point& p, const double t_sec = 0) const override;
     double signedDistance(const Point& p, const double t_sec = 0) const override;
     bool intersects(const Segment& segment, const double t_sec = 0) const override;
+    Rectangle sweptAxisAlignedBoundingBox(const double t_sec) const override;
 
    private:
     const Vector velocity_;
@@ -80,3 +81,21 @@ bool ConstVelocityObstacle<GEOM_TYPE>::intersects(const Segment& segment,
     return ::intersects(this->geom_,
                         segment - velocity_ * std::min(t_sec, max_time_horizon_sec_));
 }
+
+template <typename GEOM_TYPE>
+Rectangle ConstVelocityObstacle<GEOM_TYPE>::sweptAxisAlignedBoundingBox(
+    const double t_sec) const
+{
+    // The obstacle moves in a straight line, so the swept area is bounded by the
+    // bounding boxes at the start and end of the motion
+    const Rectangle start_bounding_box = ::axisAlignedBoundingBox(this->geom_);
+    const Vector displacement = velocity_ * std::min(t_sec, max_time_horizon_sec_);
+    return Rectangle(Point(std::min(start_bounding_box.xMin(),
+                                    start_bounding_box.xMin() + displacement.x()),
+                           std::min(start_bounding_box.yMin(),
+                                    start_bounding_box.yMin() + displacement.y())),
+                     Point(std::max(start_bounding_box.xMax(),
+                                    start_bounding_box.xMax() + displacement.x()),
+                           std::max(start_bounding_box.yMax(),
+                                    start_bounding_box.yMax() + displacement.y())));
+}
@@ -71,3 +71,19 @@ TEST(ConstVelocityObstacleTest, circle_obstacle_intersects)
     EXPECT_FALSE(obstacle->intersects(segment_1, 3.0));
     EXPECT_TRUE(obstacle->intersects(segment_2, 3.0));
 }
+
+TEST(ConstVelocityObstacleTest, circle_obstacle_swept_axis_aligned_bounding_box)
+{
+    Circle circle({0, 0}, 1);
+    ObstaclePtr obstacle(
+        std::make_shared<ConstVelocityObstacle<Circle>>(circle, Vector(1.0, -2.0), 2.0));
+
+    // The box should cover the obstacle from its current position until it has moved
+    // for 1 second
+    EXPECT_EQ(obstacle->sweptAxisAlignedBoundingBox(1.0),
+              Rectangle(Point(-1.0, -3.0), Point(2.0, 1.0)));
+
+    // The obstacle stops being predicted after the time horizon
+    EXPECT_EQ(obstacle->sweptAxisAlignedBoundingBox(5.0),
+              Rectangle(Point(-1.0, -5.0), Point(3.0, 1.0)));
+}
@@ -27,6 +27,7 @@ class GeomObstacle : public Obstacle
     Point closestPoint(const Point& p) const override;
     TbotsProto::Obstacle createObstacleProto() const override;
     Rectangle axisAlignedBoundingBox(double inflation_radius = 0) const override;
+    Rectangle sweptAxisAlignedBoundingBox(const double t_sec) const override;
     std::string toString(void) const override;
     void accept(ObstacleVisitor& visitor) const override;
     std::vector<Point> rasterize(const double resolution_size) const override;
@@ -97,6 +98,13 @@ Rectangle GeomObstacle<GEOM_TYPE>::axisAlignedBoundingBox(
     return ::axisAlignedBoundingBox(geom_, inflation_radius);
 }
 
+template <typename GEOM_TYPE>
+Rectangle GeomObstacle<GEOM_TYPE>::sweptAxisAlignedBoundingBox(const double t_sec) const
+{
+    // A static obstacle covers the same area at every time
+    return ::axisAlignedBoundingBox(geom_);
+}
+
 template <typename GEOM_TYPE>
 std::string GeomObstacle<GEOM_TYPE>::toString(void) const
 {
@@ -99,6 +99,17 @@ class Obstacle
      */
     virtual Rectangle axisAlignedBoundingBox(const double inflation_radius) const = 0;
 
+    /**
+     * Create an axis aligned bounding box which contains this obstacle at every time
+     * from now until t_sec seconds into the future
+     *
+     * @param t_sec Time in seconds into the future that the bounding box must cover
+     *
+     * @return Rectangle representing the axis aligned bounding box of the obstacle
+     * swept over the time interval
+     */
+    virtual Rectangle sweptAxisAlignedBoundingBox(const double t_sec) const = 0;
+
     /**
      * Output string to describe the obstacle
      *
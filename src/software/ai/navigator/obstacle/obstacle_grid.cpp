@@ -0,0 +1,163 @@
+#include "software/ai/navigator/obstacle/obstacle_grid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+ObstacleGrid::ObstacleGrid(const std::vector<ObstaclePtr>& obstacles, double max_time_sec)
+    : obstacles(obstacles),
+      min_x(0.0),
+      min_y(0.0),
+      cell_size_m(MIN_CELL_SIZE_METERS),
+      num_cols(0),
+      num_rows(0)
+{
+    if (obstacles.empty())
+    {
+        cell_start_indices = {0};
+        return;
+    }
+
+    std::vector<Rectangle> bounding_boxes;
+    bounding_boxes.reserve(obstacles.size());
+
+    double max_x = std::numeric_limits<double>::lowest();
+    double max_y = std::numeric_limits<double>::lowest();
+    min_x        = std::numeric_limits<double>::max();
+    min_y        = std::numeric_limits<double>::max();
+    for (const ObstaclePtr& obstacle : obstacles)
+    {
+        const Rectangle& bounding_box = bounding_boxes.emplace_back(
+            obstacle->sweptAxisAlignedBoundingBox(max_time_sec));
+        min_x = std::min(min_x, bounding_box.xMin() - BOUNDING_BOX_MARGIN_METERS);
+        min_y = std::min(min_y, bounding_box.yMin() - BOUNDING_BOX_MARGIN_METERS);
+        max_x = std::max(max_x, bounding_box.xMax() + BOUNDING_BOX_MARGIN_METERS);
+        max_y = std::max(max_y, bounding_box.yMax() + BOUNDING_BOX_MARGIN_METERS);
+    }
+
+    const double x_length = max_x - min_x;
+    const double y_length = max_y - min_y;
+    cell_size_m           = std::max({MIN_CELL_SIZE_METERS,
+                            x_length / static_cast<double>(MAX_CELLS_PER_AXIS),
+                            y_length / static_cast<double>(MAX_CELLS_PER_AXIS)});
+    num_cols              = std::min(MAX_CELLS_PER_AXIS,
+                        static_cast<size_t>(std::floor(x_length / cell_size_m)) + 1);
+    num_rows              = std::min(MAX_CELLS_PER_AXIS,
+                        static_cast<size_t>(std::floor(y_length / cell_size_m)) + 1);
+
+    // Find the range of cells that each obstacle's bounding box overlaps
+    struct CellRange
+    {
+        size_t min_col;
+        size_t max_col;
+        size_t min_row;
+        size_t max_row;
+    };
+    std::vector<CellRange> cell_ranges;
+    cell_ranges.reserve(obstacles.size());
+    for (const Rectangle& bounding_box : bounding_boxes)
+    {
+        cell_ranges.push_back(CellRange{
+            getClampedCell(bounding_box.xMin() - BOUNDING_BOX_MARGIN_METERS, min_x,
+                           num_cols),
+            getClampedCell(bounding_box.xMax() + BOUNDING_BOX_MARGIN_METERS, min_x,
+                           num_cols),
+            getClampedCell(bounding_box.yMin() - BOUNDING_BOX_MARGIN_METERS, min_y,
+                           num_rows),
+            getClampedCell(bounding_box.yMax() + BOUNDING_BOX_MARGIN_METERS, min_y,
+                           num_rows)});
+    }
+
+    // Count the obstacles in each cell, then lay out all cells contiguously. Obstacles
+    // are added in ascending order so that queries check them in the original order.
+    cell_start_indices.assign(num_cols * num_rows + 1, 0);
+    for (const CellRange& range : cell_ranges)
+    {
+        for (size_t row = range.min_row; row <= range.max_row; row++)
+        {
+            for (size_t col = range.min_col; col <= range.max_col; col++)
+            {
+                cell_start_indices[row * num_cols + col + 1]++;
+            }
+        }
+    }
+    for (size_t i = 1; i < cell_start_indices.size(); i++)
+    {
+        cell_start_indices[i] += cell_start_indices[i - 1];
+    }
+
+    cell_obstacle_indices.resize(cell_start_indices.back());
+    std::vector<unsigned int> cell_fill_indices(cell_start_indices.begin(),
+                                                cell_start_indices.end() - 1);
+    for (unsigned int obstacle_index = 0; obstacle_index < cell_ranges.size();
+         obstacle_index++)
+    {
+        const CellRange& range = cell_ranges[obstacle_index];
+        for (size_t row = range.min_row; row <= range.max_row; row++)
+        {
+            for (size_t col = range.min_col; col <= range.max_col; col++)
+            {
+                cell_obstacle_indices[cell_fill_indices[row * num_cols + col]++] =
+                    obstacle_index;
+            }
+        }
+    }
+}
+
+std::optional<size_t> ObstacleGrid::getCellIndex(const Point& p) const
+{
+    const double col = std::floor((p.x() - min_x) / cell_size_m);
+    const double row = std::floor((p.y() - min_y) / cell_size_m);
+    if (col < 0.0 || row < 0.0 || col >= static_cast<double>(num_cols) ||
+        row >= static_cast<double>(num_rows))
+    {
+        return std::nullopt;
+    }
+    return static_cast<size_t>(row) * num_cols + static_cast<size_t>(col);
+}
+
+size_t ObstacleGrid::getClampedCell(double value, double min_value,
+                                    size_t num_cells) const
+{
+    return std::min(num_cells - 1, static_cast<size_t>(std::max(
+                                       0.0, (value - min_value) / cell_size_m)));
+}
+
+ObstaclePtr ObstacleGrid::findContainingObstacle(const Point& p, double t_sec) const
+{
+    std::optional<size_t> cell_index = getCellIndex(p);
+    if (!cell_index.has_value())
+    {
+        return nullptr;
+    }
+
+    for (unsigned int i = cell_start_indices[cell_index.value()];
+         i < cell_start_indices[cell_index.value() + 1]; i++)
+    {
+        const ObstaclePtr& obstacle = obstacles[cell_obstacle_indices[i]];
+        if (obstacle->contains(p, t_sec))
+        {
+            return obstacle;
+        }
+    }
+    return nullptr;
+}
+
+bool ObstacleGrid::contains(const Point& p, double t_sec) const
+{
+    std::optional<size_t> cell_index = getCellIndex(p);
+    if (!cell_index.has_value())
+    {
+        return false;
+    }
+
+    for (unsigned int i = cell_start_indices[cell_index.value()];
+         i < cell_start_indices[cell_index.value() + 1]; i++)
+    {
+        if (obstacles[cell_obstacle_indices[i]]->contains(p, t_sec))
+        {
+            return true;
+        }
+    }
+    return false;
+}
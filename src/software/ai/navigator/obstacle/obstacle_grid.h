@@ -0,0 +1,103 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "software/ai/navigator/obstacle/obstacle.hpp"
+
+/**
+ * A uniform grid over the bounding boxes of a list of obstacles, used as a broad-phase
+ * for point-in-obstacle checks.
+ *
+ * Every obstacle is registered in all grid cells that its swept bounding box (over the
+ * grid's time horizon) overlaps. A point query then only has to run the exact
+ * containment check against the handful of obstacles registered in the cell the point
+ * falls into, instead of against every obstacle.
+ *
+ * Queries give exactly the same answers as checking every obstacle in order, as long as
+ * they are made for times within the time horizon the grid was built for.
+ */
+class ObstacleGrid
+{
+   public:
+    ObstacleGrid() = delete;
+
+    /**
+     * Builds a grid over the given obstacles
+     *
+     * @param obstacles The obstacles to index
+     * @param max_time_sec The latest time, in seconds into the future, that the grid
+     * will be queried for
+     */
+    explicit ObstacleGrid(const std::vector<ObstaclePtr>& obstacles, double max_time_sec);
+
+    /**
+     * Finds the first obstacle, in the order of the obstacle list this grid was built
+     * from, which contains the given point at the given time
+     *
+     * @param p The point to check
+     * @param t_sec Time in seconds into the future to check. Must not be later than
+     * the max_time_sec the grid was built with.
+     *
+     * @return the first obstacle containing p, or nullptr if no obstacle contains p
+     */
+    ObstaclePtr findContainingObstacle(const Point& p, double t_sec) const;
+
+    /**
+     * Checks whether any obstacle contains the given point at the given time
+     *
+     * @param p The point to check
+     * @param t_sec Time in seconds into the future to check. Must not be later than
+     * the max_time_sec the grid was built with.
+     *
+     * @return true if any obstacle contains p at t_sec
+     */
+    bool contains(const Point& p, double t_sec) const;
+
+   private:
+    /**
+     * Gets the index of the cell that contains the given point
+     *
+     * @param p The point
+     *
+     * @return the index of the cell containing p, or std::nullopt if p is outside of
+     * the grid (and so is not within any obstacle's bounding box)
+     */
+    std::optional<size_t> getCellIndex(const Point& p) const;
+
+    /**
+     * Gets the column or row of the cell that the given coordinate falls into, clamped
+     * to the grid
+     *
+     * @param value The x or y coordinate
+     * @param min_value The smallest x or y coordinate of the grid
+     * @param num_cells The number of columns or rows of the grid
+     *
+     * @return the column or row of the cell
+     */
+    size_t getClampedCell(double value, double min_value, size_t num_cells) const;
+
+    std::vector<ObstaclePtr> obstacles;
+
+    // Bottom left corner and dimensions of the grid
+    double min_x;
+    double min_y;
+    double cell_size_m;
+    size_t num_cols;
+    size_t num_rows;
+
+    // The obstacles in each cell stored contiguously, with the indices of cell i's
+    // obstacles in cell_obstacle_indices[cell_start_indices[i]] up to (but not
+    // including) cell_obstacle_indices[cell_start_indices[i + 1]], in ascending order
+    std::vector<unsigned int> cell_start_indices;
+    std::vector<unsigned int> cell_obstacle_indices;
+
+    // Smallest size of a grid cell. Roughly the size of a robot obstacle.
+    static constexpr double MIN_CELL_SIZE_METERS = 0.25;
+    // Upper bound on the number of cells along either axis, to limit the cost of
+    // building the grid when the obstacles are spread out over a large area
+    static constexpr size_t MAX_CELLS_PER_AXIS = 64;
+    // Margin added to the obstacles' bounding boxes to guard against floating point
+    // error when the grid is queried at the edge of a bounding box
+    static constexpr double BOUNDING_BOX_MARGIN_METERS = 1e-6;
+};
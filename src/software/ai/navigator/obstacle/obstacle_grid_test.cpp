@@ -0,0 +1,202 @@
+#include "software/ai/navigator/obstacle/obstacle_grid.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <random>
+
+#include "software/ai/navigator/obstacle/robot_navigation_obstacle_factory.h"
+#include "software/test_util/test_util.h"
+
+class ObstacleGridTest : public testing::Test
+{
+   protected:
+    ObstacleGridTest()
+        : world(TestUtil::createBlankTestingWorld(TbotsProto::FieldType::DIV_A)),
+          obstacle_factory(TbotsProto::RobotNavigationObstacleConfig())
+    {
+    }
+
+    /**
+     * Finds the first obstacle containing the point by checking every obstacle
+     */
+    ObstaclePtr findContainingObstacle(const std::vector<ObstaclePtr>& obstacles,
+                                       const Point& p, double t_sec)
+    {
+        for (const ObstaclePtr& obstacle : obstacles)
+        {
+            if (obstacle->contains(p, t_sec))
+            {
+                return obstacle;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * Creates obstacles like the ones the trajectory planner avoids on a crowded field
+     */
+    std::vector<ObstaclePtr> createCrowdedFieldObstacles(std::mt19937& random_num_gen)
+    {
+        std::uniform_real_distribution x_distribution(-world->field().xLength() / 2,
+                                                      world->field().xLength() / 2);
+        std::uniform_real_distribution y_distribution(-world->field().yLength() / 2,
+                                                      world->field().yLength() / 2);
+        std::uniform_real_distribution velocity_distribution(-2.0, 2.0);
+
+        std::vector<ObstaclePtr> obstacles =
+            obstacle_factory.createObstaclesFromMotionConstraints(
+                {TbotsProto::MotionConstraint::FRIENDLY_DEFENSE_AREA,
+                 TbotsProto::MotionConstraint::CENTER_CIRCLE},
+                *world);
+        for (RobotId id = 0; id < 11; id++)
+        {
+            Robot enemy(
+                id, Point(x_distribution(random_num_gen), y_distribution(random_num_gen)),
+                Vector(velocity_distribution(random_num_gen),
+                       velocity_distribution(random_num_gen)),
+                Angle::zero(), AngularVelocity::zero(), Timestamp::fromSeconds(0));
+            obstacles.push_back(
+                obstacle_factory.createConstVelocityEnemyRobotObstacle(enemy));
+            obstacles.push_back(obstacle_factory.createStaticObstacleFromRobotPosition(
+                Point(x_distribution(random_num_gen), y_distribution(random_num_gen))));
+        }
+        return obstacles;
+    }
+
+    std::shared_ptr<World> world;
+    RobotNavigationObstacleFactory obstacle_factory;
+};
+
+TEST_F(ObstacleGridTest, empty_grid_contains_nothing)
+{
+    ObstacleGrid grid({}, 2.0);
+
+    EXPECT_FALSE(grid.contains(Point(0, 0), 0.0));
+    EXPECT_EQ(grid.findContainingObstacle(Point(0, 0), 0.0), nullptr);
+}
+
+TEST_F(ObstacleGridTest, returns_first_obstacle_in_list_order)
+{
+    ObstaclePtr big_circle   = obstacle_factory.createFromShape(Circle(Point(0, 0), 2.0));
+    ObstaclePtr small_circle = obstacle_factory.createFromShape(Circle(Point(1, 0), 0.5));
+    ObstacleGrid grid({small_circle, big_circle}, 2.0);
+
+    EXPECT_EQ(grid.findContainingObstacle(Point(1, 0), 0.0), small_circle);
+    EXPECT_EQ(grid.findContainingObstacle(Point(-1, 0), 0.0), big_circle);
+    EXPECT_EQ(grid.findContainingObstacle(Point(3, 0), 0.0), nullptr);
+}
+
+TEST_F(ObstacleGridTest, moving_obstacle_is_found_along_its_path)
+{
+    Robot enemy(0, Point(-2, 0), Vector(2, 0), Angle::zero(), AngularVelocity::zero(),
+                Timestamp::fromSeconds(0));
+    ObstaclePtr obstacle = obstacle_factory.createCircleWithConstVelocity(
+        Circle(enemy.position(), 0.2), enemy.velocity());
+    ObstacleGrid grid({obstacle}, 2.0);
+
+    EXPECT_TRUE(grid.contains(Point(-2, 0), 0.0));
+    EXPECT_FALSE(grid.contains(Point(-2, 0), 0.2));
+}
+
+TEST_F(ObstacleGridTest, crowded_scene_matches_checking_every_obstacle)
+{
+    std::mt19937 random_num_gen(42);
+    std::uniform_real_distribution x_distribution(-world->field().xLength() / 2,
+                                                  world->field().xLength() / 2);
+    std::uniform_real_distribution y_distribution(-world->field().yLength() / 2,
+                                                  world->field().yLength() / 2);
+    std::uniform_real_distribution velocity_distribution(-2.0, 2.0);
+    std::uniform_real_distribution time_distribution(0.0, 2.0);
+
+    std::vector<ObstaclePtr> obstacles =
+        obstacle_factory.createObstaclesFromMotionConstraints(
+            {TbotsProto::MotionConstraint::FRIENDLY_DEFENSE_AREA,
+             TbotsProto::MotionConstraint::ENEMY_DEFENSE_AREA,
+             TbotsProto::MotionConstraint::CENTER_CIRCLE},
+            *world);
+    for (RobotId id = 0; id < 11; id++)
+    {
+        Robot enemy(id,
+                    Point(x_distribution(random_num_gen), y_distribution(random_num_gen)),
+                    Vector(velocity_distribution(random_num_gen),
+                           velocity_distribution(random_num_gen)),
+                    Angle::zero(), AngularVelocity::zero(), Timestamp::fromSeconds(0));
+        obstacles.push_back(
+            id % 2 == 0 ? obstacle_factory.createStadiumEnemyRobotObstacle(enemy)
+                        : obstacle_factory.createConstVelocityEnemyRobotObstacle(enemy));
+
+        Robot friendly(
+            id, Point(x_distribution(random_num_gen), y_distribution(random_num_gen)),
+            Vector(velocity_distribution(random_num_gen),
+                   velocity_distribution(random_num_gen)),
+            Angle::zero(), AngularVelocity::zero(), Timestamp::fromSeconds(0));
+        TrajectoryPath friendly_path(BangBangTrajectory2D(
+            friendly.position(),
+            Point(x_distribution(random_num_gen), y_distribution(random_num_gen)),
+            friendly.velocity(), KinematicConstraints(3.0, 3.0, 3.0)));
+        obstacles.push_back(
+            obstacle_factory.createFromMovingRobot(friendly, friendly_path));
+    }
+
+    ObstacleGrid grid(obstacles, 2.0);
+
+    for (int i = 0; i < 10000; i++)
+    {
+        Point p(x_distribution(random_num_gen), y_distribution(random_num_gen));
+        double t_sec         = time_distribution(random_num_gen);
+        ObstaclePtr expected = findContainingObstacle(obstacles, p, t_sec);
+        EXPECT_EQ(grid.findContainingObstacle(p, t_sec), expected)
+            << "p=" << p << " t=" << t_sec;
+        EXPECT_EQ(grid.contains(p, t_sec), expected != nullptr);
+    }
+}
+
+TEST_F(ObstacleGridTest, DISABLED_contains_speed_test)
+{
+    std::mt19937 random_num_gen(13);
+    std::uniform_real_distribution x_distribution(-world->field().xLength() / 2,
+                                                  world->field().xLength() / 2);
+    std::uniform_real_distribution y_distribution(-world->field().yLength() / 2,
+                                                  world->field().yLength() / 2);
+    std::uniform_real_distribution t_distribution(0.0, 2.0);
+
+    std::vector<ObstaclePtr> obstacles = createCrowdedFieldObstacles(random_num_gen);
+    ObstacleGrid grid(obstacles, 2.0);
+
+    std::vector<std::pair<Point, double>> queries;
+    for (int i = 0; i < 100000; i++)
+    {
+        queries.emplace_back(
+            Point(x_distribution(random_num_gen), y_distribution(random_num_gen)),
+            t_distribution(random_num_gen));
+    }
+
+    // Checking every obstacle through a virtual call, as the planner used to
+    auto start_time                   = std::chrono::system_clock::now();
+    unsigned int num_virtual_contains = 0;
+    for (const auto& [p, t_sec] : queries)
+    {
+        if (findContainingObstacle(obstacles, p, t_sec) != nullptr)
+        {
+            num_virtual_contains++;
+        }
+    }
+    const double virtual_duration_ms = ::TestUtil::millisecondsSince(start_time);
+
+    start_time                     = std::chrono::system_clock::now();
+    unsigned int num_grid_contains = 0;
+    for (const auto& [p, t_sec] : queries)
+    {
+        if (grid.contains(p, t_sec))
+        {
+            num_grid_contains++;
+        }
+    }
+    const double grid_duration_ms = ::TestUtil::millisecondsSince(start_time);
+
+    EXPECT_EQ(num_grid_contains, num_virtual_contains);
+    std::cout << "Took " << virtual_duration_ms << "ms checking every obstacle and "
+              << grid_duration_ms << "ms with the grid to check " << queries.size()
+              << " points against " << obstacles.size() << " obstacles" << std::endl;
+}
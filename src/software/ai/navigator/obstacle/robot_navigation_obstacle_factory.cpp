@@ -7,10 +7,144 @@ RobotNavigationObstacleFactory::RobotNavigationObstacleFactory(
     TbotsProto::RobotNavigationObstacleConfig config)
     : config(config),
       robot_radius_expansion_amount(config.robot_obstacle_inflation_factor() *
-                                    ROBOT_MAX_RADIUS_METERS)
+                                    ROBOT_MAX_RADIUS_METERS),
+      obstacle_cache(std::make_shared<ObstacleCache>())
 {
 }
 
+template <typename CachedObstacles, typename GetCachedObstacles, typename CreateObstacles>
+CachedObstacles RobotNavigationObstacleFactory::getOrCreateCachedObstacles(
+    const World &world, GetCachedObstacles get_cached_obstacles,
+    CreateObstacles create_obstacles) const
+{
+    {
+        auto lock = lockObstacleCache(world);
+        if (CachedObstacles &cached_obstacles = get_cached_obstacles(*obstacle_cache))
+        {
+            return cached_obstacles;
+        }
+    }
+
+    CachedObstacles new_obstacles = create_obstacles();
+
+    // Check again, since another thread may have cached the obstacles while they were
+    // being created
+    auto lock                         = lockObstacleCache(world);
+    CachedObstacles &cached_obstacles = get_cached_obstacles(*obstacle_cache);
+    if (!cached_obstacles)
+    {
+        cached_obstacles = std::move(new_obstacles);
+    }
+    return cached_obstacles;
+}
+
+std::shared_ptr<const std::vector<ObstaclePtr>>
+RobotNavigationObstacleFactory::getObstaclesFromMotionConstraints(
+    const std::set<TbotsProto::MotionConstraint> &motion_constraints,
+    const World &world) const
+{
+    uint32_t motion_constraints_mask = 0;
+    for (auto motion_constraint : motion_constraints)
+    {
+        motion_constraints_mask |= 1u << static_cast<uint32_t>(motion_constraint);
+    }
+
+    return getOrCreateCachedObstacles<std::shared_ptr<const std::vector<ObstaclePtr>>>(
+        world,
+        [motion_constraints_mask](ObstacleCache &cache) -> auto & {
+            return cache.motion_constraint_obstacles[motion_constraints_mask];
+        },
+        [&]() {
+            return std::make_shared<const std::vector<ObstaclePtr>>(
+                createObstaclesFromMotionConstraints(motion_constraints, world));
+        });
+}
+
+std::shared_ptr<const std::vector<ObstaclePtr>>
+RobotNavigationObstacleFactory::getEnemyRobotObstacles(
+    const World &world, TbotsProto::ObstacleAvoidanceMode obstacle_avoidance_mode) const
+{
+    return getOrCreateCachedObstacles<std::shared_ptr<const std::vector<ObstaclePtr>>>(
+        world,
+        [obstacle_avoidance_mode](ObstacleCache &cache) -> auto & {
+            return cache.enemy_robot_obstacles[obstacle_avoidance_mode];
+        },
+        [&]() {
+            std::vector<ObstaclePtr> enemy_robot_obstacles;
+            for (const Robot &enemy : world.enemyTeam().getAllRobots())
+            {
+                if (obstacle_avoidance_mode == TbotsProto::SAFE)
+                {
+                    // Generate a possibly long stadium shape obstacle in the region
+                    // where the enemy robot may move in
+                    enemy_robot_obstacles.push_back(
+                        createStadiumEnemyRobotObstacle(enemy));
+                }
+                else if (obstacle_avoidance_mode == TbotsProto::AGGRESSIVE)
+                {
+                    // Generate a moving obstacle depending on the enemy robot's
+                    // velocity. This is considered a more aggressive strategy as it
+                    // assumes the enemy robot is moving at a constant speed. The
+                    // generated obstacle can also be much smaller than the stadium
+                    // shape obstacle, allowing the robot to move more freely.
+                    enemy_robot_obstacles.push_back(
+                        createConstVelocityEnemyRobotObstacle(enemy));
+                }
+            }
+            return std::make_shared<const std::vector<ObstaclePtr>>(
+                std::move(enemy_robot_obstacles));
+        });
+}
+
+ObstaclePtr RobotNavigationObstacleFactory::getStaticFriendlyRobotObstacle(
+    const World &world, const Robot &friendly_robot) const
+{
+    return getOrCreateCachedObstacles<ObstaclePtr>(
+        world,
+        [&friendly_robot](ObstacleCache &cache) -> auto & {
+            return cache.static_friendly_robot_obstacles[friendly_robot.id()];
+        },
+        [&]() {
+            return createStaticObstacleFromRobotPosition(friendly_robot.position());
+        });
+}
+
+ObstaclePtr RobotNavigationObstacleFactory::getBallObstacle(const World &world) const
+{
+    return getOrCreateCachedObstacles<ObstaclePtr>(
+        world, [](ObstacleCache &cache) -> auto & { return cache.ball_obstacle; },
+        [&]() { return createFromBallPosition(world.ball().position()); });
+}
+
+void RobotNavigationObstacleFactory::clearObstacleCache()
+{
+    std::scoped_lock lock(obstacle_cache->mutex);
+    obstacle_cache->clear();
+}
+
+std::unique_lock<std::mutex> RobotNavigationObstacleFactory::lockObstacleCache(
+    const World &world) const
+{
+    std::unique_lock<std::mutex> lock(obstacle_cache->mutex);
+    if (obstacle_cache->world != &world ||
+        obstacle_cache->timestamp != world.getMostRecentTimestamp())
+    {
+        obstacle_cache->clear();
+        obstacle_cache->world     = &world;
+        obstacle_cache->timestamp = world.getMostRecentTimestamp();
+    }
+    return lock;
+}
+
+void RobotNavigationObstacleFactory::ObstacleCache::clear()
+{
+    world = nullptr;
+    motion_constraint_obstacles.clear();
+    enemy_robot_obstacles.clear();
+    static_friendly_robot_obstacles.clear();
+    ball_obstacle = nullptr;
+}
+
 std::vector<ObstaclePtr>
 RobotNavigationObstacleFactory::createObstaclesFromMotionConstraint(
     const TbotsProto::MotionConstraint &motion_constraint, const World &world) const
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <map>
+#include <memory>
+#include <mutex>
+
 #include "proto/parameters.pb.h"
 #include "proto/primitive.pb.h"
 #include "shared/constants.h"
@@ -37,6 +41,65 @@ class RobotNavigationObstacleFactory
         const std::set<TbotsProto::MotionConstraint> &motion_constraints,
         const World &world) const;
 
+    /**
+     * Gets the obstacles for the given motion constraints. The obstacles are created
+     * once per world and shared by every robot that plans with the same motion
+     * constraints in that world.
+     *
+     * @param motion_constraints The motion constraints to get obstacles for
+     * @param world World we're enforcing motion constraints in
+     *
+     * @return Obstacles representing the given motion constraints
+     */
+    std::shared_ptr<const std::vector<ObstaclePtr>> getObstaclesFromMotionConstraints(
+        const std::set<TbotsProto::MotionConstraint> &motion_constraints,
+        const World &world) const;
+
+    /**
+     * Gets the obstacles around all enemy robots for the given obstacle avoidance mode.
+     * The obstacles are created once per world and shared by every robot that plans
+     * with the same obstacle avoidance mode in that world.
+     *
+     * @param world World containing the enemy robots
+     * @param obstacle_avoidance_mode How safe the obstacles around the enemy robots
+     * should be. SAFE creates stadium obstacles and AGGRESSIVE creates constant
+     * velocity obstacles.
+     *
+     * @return Obstacles around all enemy robots
+     */
+    std::shared_ptr<const std::vector<ObstaclePtr>> getEnemyRobotObstacles(
+        const World &world,
+        TbotsProto::ObstacleAvoidanceMode obstacle_avoidance_mode) const;
+
+    /**
+     * Gets the static obstacle around the given friendly robot's position. The
+     * obstacle is created once per world and shared by every robot that plans in it.
+     *
+     * @param world World containing the friendly robot
+     * @param friendly_robot The friendly robot to get the obstacle around
+     *
+     * @return obstacle around the robot
+     */
+    ObstaclePtr getStaticFriendlyRobotObstacle(const World &world,
+                                               const Robot &friendly_robot) const;
+
+    /**
+     * Gets the obstacle around the ball. The obstacle is created once per world and
+     * shared by every robot that plans in it.
+     *
+     * @param world World containing the ball
+     *
+     * @return obstacle around the ball
+     */
+    ObstaclePtr getBallObstacle(const World &world) const;
+
+    /**
+     * Clears all obstacles that are shared between robots. This should be called
+     * before planning in a new world, since a new world may reuse the address and
+     * timestamp of a previous one.
+     */
+    void clearObstacleCache();
+
     /**
      * Create static obstacles for the given motion constraint
      *
@@ -142,8 +205,65 @@ class RobotNavigationObstacleFactory
                                         const Point &ball_point) const;
 
    private:
+    /**
+     * Obstacles that are shared by all robots planning in the same world
+     */
+    struct ObstacleCache
+    {
+        std::mutex mutex;
+
+        // The world the obstacles were created for
+        const World *world = nullptr;
+        Timestamp timestamp;
+
+        // Keyed by the bitmask of the motion constraints
+        std::map<uint32_t, std::shared_ptr<const std::vector<ObstaclePtr>>>
+            motion_constraint_obstacles;
+        std::map<TbotsProto::ObstacleAvoidanceMode,
+                 std::shared_ptr<const std::vector<ObstaclePtr>>>
+            enemy_robot_obstacles;
+        std::map<RobotId, ObstaclePtr> static_friendly_robot_obstacles;
+        ObstaclePtr ball_obstacle;
+
+        /**
+         * Removes all cached obstacles
+         */
+        void clear();
+    };
+
+    /**
+     * Locks the obstacle cache, clearing it first if it was filled for a different
+     * world
+     *
+     * @param world The world that obstacles are about to be looked up for
+     *
+     * @return the lock on the obstacle cache
+     */
+    std::unique_lock<std::mutex> lockObstacleCache(const World &world) const;
+
+    /**
+     * Gets obstacles from the obstacle cache, creating and caching them if they are not
+     * cached yet. The obstacles are created without holding the lock on the cache, so
+     * that planners on other threads are not blocked while they are created. If another
+     * thread caches the same obstacles first, its obstacles are returned instead.
+     *
+     * @param world The world that the obstacles are for
+     * @param get_cached_obstacles Returns a reference to where the obstacles are stored
+     * in the given cache, which is nullptr if they are not cached
+     * @param create_obstacles Creates the obstacles
+     *
+     * @return the cached obstacles
+     */
+    template <typename CachedObstacles, typename GetCachedObstacles,
+              typename CreateObstacles>
+    CachedObstacles getOrCreateCachedObstacles(const World &world,
+                                               GetCachedObstacles get_cached_obstacles,
+                                               CreateObstacles create_obstacles) const;
+
     TbotsProto::RobotNavigationObstacleConfig config;
     double robot_radius_expansion_amount;
+    // Shared by copies of this factory, which create the same obstacles
+    std::shared_ptr<ObstacleCache> obstacle_cache;
 
     /**
      * Returns an obstacle for the field_rectangle expanded on all sides to account for
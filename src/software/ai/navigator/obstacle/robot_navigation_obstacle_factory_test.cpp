@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <thread>
 
 #include "software/ai/navigator/obstacle/const_velocity_obstacle.hpp"
 #include "software/ai/navigator/obstacle/geom_obstacle.hpp"
@@ -220,9 +221,8 @@ TEST_F(RobotNavigationObstacleFactoryTest, trajectory_robot_obstacle)
     Robot robot =
         Robot(4, origin, velocity, Angle::zero(), AngularVelocity::zero(), current_time);
 
-    TrajectoryPath trajectory(std::make_shared<BangBangTrajectory2D>(
-                                  origin, end, velocity, KinematicConstraints(1, 1, 1)),
-                              BangBangTrajectory2D::generator);
+    TrajectoryPath trajectory(
+        BangBangTrajectory2D(origin, end, velocity, KinematicConstraints(1, 1, 1)));
 
     ObstaclePtr obstacle =
         robot_navigation_obstacle_factory.createFromMovingRobot(robot, trajectory);
@@ -285,9 +285,9 @@ TEST_F(RobotNavigationObstacleFactoryTest, trajectory_obstacle)
     Point destination(4.0, 1.0);
     Vector velocity(1.0, 0.0);
 
-    auto trajectory = std::make_shared<BangBangTrajectory2D>(
-        origin, destination, velocity, KinematicConstraints(1.0, 1.0, 1.0));
-    TrajectoryPath trajectory_path(trajectory, BangBangTrajectory2D::generator);
+    BangBangTrajectory2D trajectory(origin, destination, velocity,
+                                    KinematicConstraints(1.0, 1.0, 1.0));
+    TrajectoryPath trajectory_path(trajectory);
 
     Robot robot =
         Robot(4, origin, velocity, Angle::zero(), AngularVelocity::zero(), current_time);
@@ -500,3 +500,94 @@ TEST_F(RobotNavigationObstacleFactoryMotionConstraintTest, ball_placement_rotate
         ADD_FAILURE() << "Stadium Obstacle was not created";
     }
 }
+
+TEST_F(RobotNavigationObstacleFactoryMotionConstraintTest,
+       shared_obstacles_are_reused_within_world)
+{
+    std::set<TbotsProto::MotionConstraint> motion_constraints = {
+        TbotsProto::MotionConstraint::CENTER_CIRCLE,
+        TbotsProto::MotionConstraint::FRIENDLY_DEFENSE_AREA};
+
+    auto obstacles = robot_navigation_obstacle_factory.getObstaclesFromMotionConstraints(
+        motion_constraints, *world_ptr);
+    EXPECT_EQ(2, obstacles->size());
+    EXPECT_EQ(obstacles,
+              robot_navigation_obstacle_factory.getObstaclesFromMotionConstraints(
+                  motion_constraints, *world_ptr));
+    EXPECT_NE(obstacles,
+              robot_navigation_obstacle_factory.getObstaclesFromMotionConstraints(
+                  {TbotsProto::MotionConstraint::CENTER_CIRCLE}, *world_ptr));
+
+    auto enemy_robot_obstacles =
+        robot_navigation_obstacle_factory.getEnemyRobotObstacles(
+            *world_ptr, TbotsProto::ObstacleAvoidanceMode::SAFE);
+    EXPECT_EQ(2, enemy_robot_obstacles->size());
+    EXPECT_EQ(enemy_robot_obstacles,
+              robot_navigation_obstacle_factory.getEnemyRobotObstacles(
+                  *world_ptr, TbotsProto::ObstacleAvoidanceMode::SAFE));
+
+    Robot friendly_robot = world_ptr->friendlyTeam().getAllRobots().front();
+    auto friendly_robot_obstacle =
+        robot_navigation_obstacle_factory.getStaticFriendlyRobotObstacle(*world_ptr,
+                                                                         friendly_robot);
+    EXPECT_EQ(friendly_robot_obstacle,
+              robot_navigation_obstacle_factory.getStaticFriendlyRobotObstacle(
+                  *world_ptr, friendly_robot));
+
+    auto ball_obstacle = robot_navigation_obstacle_factory.getBallObstacle(*world_ptr);
+    EXPECT_EQ(ball_obstacle,
+              robot_navigation_obstacle_factory.getBallObstacle(*world_ptr));
+}
+
+TEST_F(RobotNavigationObstacleFactoryMotionConstraintTest,
+       shared_obstacles_are_recreated_after_clearing_cache)
+{
+    auto ball_obstacle = robot_navigation_obstacle_factory.getBallObstacle(*world_ptr);
+
+    Ball new_ball = Ball(Point(-1, 0), Vector(0, 0), current_time);
+    world_ptr->updateBall(new_ball);
+    robot_navigation_obstacle_factory.clearObstacleCache();
+
+    auto new_ball_obstacle =
+        robot_navigation_obstacle_factory.getBallObstacle(*world_ptr);
+    EXPECT_NE(ball_obstacle, new_ball_obstacle);
+    EXPECT_TRUE(new_ball_obstacle->contains(Point(-1, 0)));
+    EXPECT_FALSE(new_ball_obstacle->contains(Point(1, 2)));
+}
+
+TEST_F(RobotNavigationObstacleFactoryMotionConstraintTest,
+       shared_obstacles_are_the_same_on_all_threads)
+{
+    // Threads that ask for the same obstacles at once may each create them, but all
+    // of them must get the obstacles that were cached first
+    std::set<TbotsProto::MotionConstraint> motion_constraints = {
+        TbotsProto::MotionConstraint::CENTER_CIRCLE,
+        TbotsProto::MotionConstraint::FRIENDLY_DEFENSE_AREA};
+    const unsigned int num_threads = 8;
+    std::vector<std::shared_ptr<const std::vector<ObstaclePtr>>> obstacles(num_threads);
+    std::vector<ObstaclePtr> ball_obstacles(num_threads);
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < num_threads; i++)
+    {
+        threads.emplace_back([&, i]() {
+            obstacles[i] =
+                robot_navigation_obstacle_factory.getObstaclesFromMotionConstraints(
+                    motion_constraints, *world_ptr);
+            ball_obstacles[i] =
+                robot_navigation_obstacle_factory.getBallObstacle(*world_ptr);
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (unsigned int i = 0; i < num_threads; i++)
+    {
+        EXPECT_EQ(obstacles[0], obstacles[i]);
+        EXPECT_EQ(ball_obstacles[0], ball_obstacles[i]);
+    }
+    EXPECT_EQ(obstacles[0],
+              robot_navigation_obstacle_factory.getObstaclesFromMotionConstraints(
+                  motion_constraints, *world_ptr));
+}
@@ -24,6 +24,7 @@ class TrajectoryObstacle : public GeomObstacle<GEOM_TYPE>
     double distance(const Point& p, const double t_sec = 0) const override;
     double signedDistance(const Point& p, const double t_sec = 0) const override;
     bool intersects(const Segment& segment, const double t_sec = 0) const override;
+    Rectangle sweptAxisAlignedBoundingBox(const double t_sec) const override;
 
    private:
     const TrajectoryPath traj_;
@@ -102,3 +103,35 @@ bool TrajectoryObstacle<GEOM_TYPE>::intersects(const Segment& segment,
         return ::intersects(this->geom_, segment - displacement);
     }
 }
+
+template <typename GEOM_TYPE>
+Rectangle TrajectoryObstacle<GEOM_TYPE>::sweptAxisAlignedBoundingBox(
+    const double t_sec) const
+{
+    // The obstacle is displaced by (traj_.getPosition(t) - traj_.getPosition(0)), and
+    // every position along the trajectory is within its bounding boxes, so the swept
+    // area is bounded by the obstacle's bounding box grown by the trajectory's extent
+    const Rectangle start_bounding_box = ::axisAlignedBoundingBox(this->geom_);
+    const Point start_position         = traj_.getPosition(0);
+
+    double min_x_displacement = 0.0;
+    double min_y_displacement = 0.0;
+    double max_x_displacement = 0.0;
+    double max_y_displacement = 0.0;
+    for (const Rectangle& traj_bounding_box : traj_.getBoundingBoxes())
+    {
+        min_x_displacement =
+            std::min(min_x_displacement, traj_bounding_box.xMin() - start_position.x());
+        min_y_displacement =
+            std::min(min_y_displacement, traj_bounding_box.yMin() - start_position.y());
+        max_x_displacement =
+            std::max(max_x_displacement, traj_bounding_box.xMax() - start_position.x());
+        max_y_displacement =
+            std::max(max_y_displacement, traj_bounding_box.yMax() - start_position.y());
+    }
+
+    return Rectangle(Point(start_bounding_box.xMin() + min_x_displacement,
+                           start_bounding_box.yMin() + min_y_displacement),
+                     Point(start_bounding_box.xMax() + max_x_displacement,
+                           start_bounding_box.yMax() + max_y_displacement));
+}
@@ -7,9 +7,8 @@ class TrajectoryObstacleTest : public testing::Test
 {
    public:
     TrajectoryObstacleTest()
-        : obstacle_traj(std::make_shared<BangBangTrajectory2D>(
-                            start, end, initial_vel, KinematicConstraints(1, 1, 1)),
-                        BangBangTrajectory2D::generator),
+        : obstacle_traj(BangBangTrajectory2D(start, end, initial_vel,
+                                             KinematicConstraints(1, 1, 1))),
           obstacle(std::make_shared<TrajectoryObstacle<Circle>>(circle, obstacle_traj))
     {
     }
@@ -81,3 +80,21 @@ TEST_F(TrajectoryObstacleTest, circle_obstacle_intersects)
     EXPECT_FALSE(obstacle->intersects(segment_start, end_time));
     EXPECT_TRUE(obstacle->intersects(segment_end, end_time));
 }
+
+TEST_F(TrajectoryObstacleTest, circle_obstacle_swept_axis_aligned_bounding_box)
+{
+    Rectangle bounding_box =
+        obstacle->sweptAxisAlignedBoundingBox(obstacle_traj.getTotalTime());
+
+    // The box should contain the obstacle at every point along its trajectory
+    for (double t = 0.0; t <= obstacle_traj.getTotalTime(); t += 0.1)
+    {
+        Point position = obstacle_traj.getPosition(t);
+        EXPECT_TRUE(contains(bounding_box, position + Vector(radius, 0)));
+        EXPECT_TRUE(contains(bounding_box, position + Vector(-radius, 0)));
+        EXPECT_TRUE(contains(bounding_box, position + Vector(0, radius)));
+        EXPECT_TRUE(contains(bounding_box, position + Vector(0, -radius)));
+    }
+    EXPECT_FALSE(contains(bounding_box, end + Vector(radius + 0.1, 0)));
+    EXPECT_FALSE(contains(bounding_box, start + Vector(0, radius + 0.1)));
+}
@@ -18,6 +18,7 @@ void BangBangTrajectory1D::generate(double initial_pos, double final_pos,
 {
     // We will overwrite the previous trajectory
     num_trajectory_parts = 0;
+    final_position       = final_pos;
 
     CHECK(max_vel != 0) << "Max velocity cannot be 0";
     CHECK(max_accel != 0) << "Max acceleration cannot be 0";
@@ -83,6 +84,108 @@ void BangBangTrajectory1D::generate(double initial_pos, double final_pos,
     }
 }
 
+double BangBangTrajectory1D::calculateDurationWithScaledConstraints(
+    double initial_pos, double final_pos, double initial_vel, double max_vel,
+    double max_accel, double max_decel, double constraint_scale,
+    double &out_duration_derivative) const
+{
+    // The trajectory profile is picked the same way as in generate(). Within each
+    // profile, the duration is a closed form function of the scaled constraints, which
+    // is differentiated with respect to the scale.
+    const double scale = constraint_scale;
+    max_vel            = std::abs(max_vel) * scale;
+    max_accel          = std::abs(max_accel) * scale;
+    max_decel          = std::abs(max_decel) * scale;
+
+    double stop_pos = closestPositionToStop(initial_pos, initial_vel, max_decel);
+    if (isInRangeInclusive(stop_pos, initial_pos, final_pos))
+    {
+        // Initial velocity is zero or towards the destination
+        double direction      = std::copysign(1, final_pos - initial_pos);
+        double dist           = std::abs(final_pos - initial_pos);
+        double speed          = std::abs(initial_vel);
+        double triangular_pos = triangularProfileStopPosition(
+            initial_pos, initial_vel, max_vel, max_accel, max_decel, direction);
+        if (isInRangeExclusive(triangular_pos, initial_pos, final_pos))
+        {
+            // Trapezoidal profile, where the first part either accelerates up to or
+            // decelerates down to max velocity
+            double t1, d1;
+            if (speed < max_vel)
+            {
+                t1 = (max_vel - speed) / max_accel;
+                d1 = (max_vel * max_vel - speed * speed) / (2 * max_accel);
+                out_duration_derivative =
+                    (speed / max_accel - dist / max_vel -
+                     speed * speed / (max_accel * max_vel)) /
+                    scale;
+            }
+            else
+            {
+                t1 = (speed - max_vel) / max_decel;
+                d1 = (speed * speed - max_vel * max_vel) / (2 * max_decel);
+                out_duration_derivative = (-speed / max_decel - dist / max_vel +
+                                           speed * speed / (max_decel * max_vel)) /
+                                          scale;
+            }
+            double t3 = max_vel / max_decel;
+            double d3 = max_vel * max_vel / (2 * max_decel);
+            return t1 + (dist - d1 - d3) / max_vel + t3;
+        }
+
+        // Triangular profile
+        double squared_peak_speed_factor = speed * speed + 2 * dist * max_accel;
+        if (squared_peak_speed_factor <= 0)
+        {
+            // Already at rest at the destination
+            out_duration_derivative = 0;
+            return 0;
+        }
+        double t_decel =
+            std::sqrt(squared_peak_speed_factor / (max_decel * (max_accel + max_decel)));
+        double t_accel = (max_decel * t_decel - speed) / max_accel;
+        out_duration_derivative =
+            ((1 + max_decel / max_accel) * t_decel *
+                 (dist * max_accel / squared_peak_speed_factor - 1) +
+             speed / max_accel) /
+            scale;
+        return t_accel + t_decel;
+    }
+
+    // Decelerate to a stop first, then follow a profile from rest to the destination.
+    // The position that the trajectory stops at also depends on the scale.
+    double time_to_stop_sec = std::abs(initial_vel) / max_decel;
+    double dist             = std::abs(final_pos - stop_pos);
+    double d_dist_d_scale =
+        std::copysign(1, final_pos - stop_pos) * (stop_pos - initial_pos) / scale;
+    double direction      = std::copysign(1, final_pos - stop_pos);
+    double triangular_pos = triangularProfileStopPosition(stop_pos, 0, max_vel, max_accel,
+                                                          max_decel, direction);
+    if (isInRangeExclusive(triangular_pos, stop_pos, final_pos))
+    {
+        // Trapezoidal profile from rest
+        double t1 = max_vel / max_accel;
+        double d1 = max_vel * max_vel / (2 * max_accel);
+        double t3 = max_vel / max_decel;
+        double d3 = max_vel * max_vel / (2 * max_decel);
+        out_duration_derivative = -time_to_stop_sec / scale + d_dist_d_scale / max_vel -
+                                  dist / (max_vel * scale);
+        return time_to_stop_sec + t1 + (dist - d1 - d3) / max_vel + t3;
+    }
+
+    // Triangular profile from rest
+    double t_decel =
+        std::sqrt(2 * dist * max_accel / (max_decel * (max_accel + max_decel)));
+    double t_accel = max_decel * t_decel / max_accel;
+    out_duration_derivative = -time_to_stop_sec / scale;
+    if (dist > 0)
+    {
+        out_duration_derivative += (1 + max_decel / max_accel) * t_decel / 2 *
+                                   (d_dist_d_scale / dist - 1 / scale);
+    }
+    return time_to_stop_sec + t_accel + t_decel;
+}
+
 void BangBangTrajectory1D::generateTrapezoidalTrajectory(
     double initial_pos, double final_pos, double initial_vel, double max_vel,
     double max_accel, double max_decel, double time_offset_sec)
@@ -175,6 +278,13 @@ void BangBangTrajectory1D::generateTriangularTrajectory(
 
 double BangBangTrajectory1D::getPosition(double t_sec) const
 {
+    // Evaluating the last trajectory part at its end time can be off from the
+    // destination by rounding errors
+    if (t_sec >= getTotalTime())
+    {
+        return final_position;
+    }
+
     TrajectoryPart traj_part;
     double t_delta_sec;
     getTrajPartAndDeltaTime(t_sec, traj_part, t_delta_sec);
@@ -280,9 +390,8 @@ std::pair<double, double> BangBangTrajectory1D::getMinMaxPositions() const
         min_max_pos.second = std::max(min_max_pos.second, part.position);
     }
 
-    double final_position = getDestination();
-    min_max_pos.first     = std::min(min_max_pos.first, final_position);
-    min_max_pos.second    = std::max(min_max_pos.second, final_position);
+    min_max_pos.first  = std::min(min_max_pos.first, final_position);
+    min_max_pos.second = std::max(min_max_pos.second, final_position);
 
     return min_max_pos;
 }
@@ -45,11 +45,40 @@ class BangBangTrajectory1D : public Trajectory<double, double, double>
     void generate(double initial_pos, double final_pos, double initial_vel,
                   double max_vel, double max_accel, double max_decel);
 
+    /**
+     * Calculates the duration of the trajectory that generate() would produce if all of
+     * the given kinematic constraints were scaled by the same factor, along with how
+     * quickly the duration changes with that factor. This is much cheaper than
+     * generating the trajectory, and doesn't change the existing trajectory.
+     *
+     * @param initial_pos Starting position of the trajectory
+     * @param final_pos Destination. Where the trajectory should end at
+     * @param initial_vel The velocity at the start of the trajectory
+     * @param max_vel The maximum velocity (magnitude) the trajectory could have before
+     * scaling. Must be non-zero.
+     * @param max_accel The maximum acceleration the trajectory could have before
+     * scaling. Must be non-zero.
+     * @param max_decel The maximum deceleration the trajectory could have before
+     * scaling. Must be non-zero.
+     * @param constraint_scale The factor to scale the kinematic constraints by. Must be
+     * positive.
+     * @param out_duration_derivative Out parameter for the derivative of the duration
+     * with respect to constraint_scale
+     *
+     * @return The duration of the trajectory in seconds
+     */
+    double calculateDurationWithScaledConstraints(double initial_pos, double final_pos,
+                                                  double initial_vel, double max_vel,
+                                                  double max_accel, double max_decel,
+                                                  double constraint_scale,
+                                                  double &out_duration_derivative) const;
+
     /**
      * Get position at time t
      *
      * @param t_sec Duration elapsed since start of trajectory in seconds
-     * @return The position at time t
+     * @return The position at time t, which is exactly the destination at and after
+     * the total time
      */
     double getPosition(double t_sec) const override;
 
@@ -217,4 +246,8 @@ class BangBangTrajectory1D : public Trajectory<double, double, double>
     size_t num_trajectory_parts                                       = 0;
     std::array<TrajectoryPart, MAX_TRAJECTORY_PARTS> trajectory_parts = {
         TrajectoryPart(), TrajectoryPart(), TrajectoryPart(), TrajectoryPart()};
+
+    // The destination of the trajectory, which is returned exactly at and after the
+    // total time instead of being evaluated from the last trajectory part
+    double final_position = 0.0;
 };
@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include <random>
+
 #include "software/test_util/test_util.h"
 
 class BangBangTrajectory1DTest : public testing::Test
@@ -322,3 +324,46 @@ TEST_F(BangBangTrajectory1DTest, test_trajectory_min_max_range)
     EXPECT_DOUBLE_EQ(min_max.first, 0.0);
     EXPECT_DOUBLE_EQ(min_max.second, 1.0);
 }
+
+TEST_F(BangBangTrajectory1DTest, duration_with_scaled_constraints_matches_generate)
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution pos_dist(-10.0, 10.0);
+    std::uniform_real_distribution vel_dist(-4.0, 4.0);
+    std::uniform_real_distribution scale_dist(0.05, 1.0);
+
+    for (int i = 0; i < 10000; i++)
+    {
+        const double initial_pos = pos_dist(rng);
+        const double final_pos   = pos_dist(rng);
+        const double initial_vel = vel_dist(rng);
+        const double scale       = scale_dist(rng);
+
+        double duration_derivative;
+        const double duration = traj.calculateDurationWithScaledConstraints(
+            initial_pos, final_pos, initial_vel, 3, 2, 4, scale, duration_derivative);
+        traj.generate(initial_pos, final_pos, initial_vel, 3 * scale, 2 * scale,
+                      4 * scale);
+        ASSERT_NEAR(duration, traj.getTotalTime(), 1e-9);
+
+        // Compare the derivative to a central difference, away from the scales at
+        // which the trajectory switches between profiles
+        const double delta = 1e-6;
+        double unused_derivative;
+        const double duration_above = traj.calculateDurationWithScaledConstraints(
+            initial_pos, final_pos, initial_vel, 3, 2, 4, scale + delta,
+            unused_derivative);
+        const double duration_below = traj.calculateDurationWithScaledConstraints(
+            initial_pos, final_pos, initial_vel, 3, 2, 4, scale - delta,
+            unused_derivative);
+        const double one_sided_above = (duration_above - duration) / delta;
+        const double one_sided_below = (duration - duration_below) / delta;
+        if (std::abs(one_sided_above - one_sided_below) <
+            1e-3 * std::max(1.0, std::abs(one_sided_above)))
+        {
+            EXPECT_NEAR(duration_derivative,
+                        (duration_above - duration_below) / (2 * delta),
+                        1e-3 * std::max(1.0, std::abs(duration_derivative)));
+        }
+    }
+}
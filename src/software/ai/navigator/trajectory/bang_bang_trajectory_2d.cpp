@@ -1,5 +1,9 @@
 #include "software/ai/navigator/trajectory/bang_bang_trajectory_2d.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 BangBangTrajectory2D::BangBangTrajectory2D(const Point& initial_pos,
                                            const Point& final_pos,
                                            const Vector& initial_vel,
@@ -22,55 +26,114 @@ void BangBangTrajectory2D::generate(const Point& initial_pos, const Point& final
      *
      * The max velocity, acceleration, and deceleration are assumed to be the kinematic
      * constraints in 2D space, as opposed to the constraints for individual x and y
-     * components. To find the components of these constraints for each axis which will
-     * give us two trajectories with (almost) equal durations, we will use binary search
-     * over the components of the given kinematic constraints.
+     * components. The constraints are split between the axes by an angle alpha, with
+     * the x axis getting cos(alpha) and the y axis getting sin(alpha) of them. The
+     * difference between the durations of the x and y trajectories generally increases
+     * with alpha, so we search for the alpha at which the durations are (almost) equal.
+     *
+     * Scaling the distance, velocity and kinematic constraints of a 1D trajectory by
+     * the same factor does not change its duration. So if the initial velocity is zero
+     * (or parallel to the displacement), the durations are equal when the constraints
+     * are split in proportion to the displacement along each axis. We use this as the
+     * initial guess for alpha, which is exact for robots starting at rest.
      *
-     * We will start with alpha = PI/4 (45 deg) which will have the x and y components
-     * equivalent to each other. Depending on which 1D trajectory takes longer to reach
-     * the destination, we will either increase or decrease alpha by increment
-     * (= PI/(8*2^i) where i is the iteration of binary search we're at). This will
-     * result in the component which is taking longer to reach the destination to get a
-     * larger component of the kinematic constraints relative to the other component which
-     * reaches the destination faster.
+     * Otherwise, the guess is refined with Newton's method on the duration difference.
+     * The durations and their derivatives with respect to alpha have a closed form for
+     * each axis, so the 1D trajectories don't have to be generated until alpha is
+     * found. The Newton steps are kept within a bracket around the root, falling back
+     * to bisection when a step would leave it.
      */
+    const Vector displacement = final_pos - initial_pos;
+    double alpha =
+        std::clamp(std::atan2(std::abs(displacement.y()), std::abs(displacement.x())),
+                   MIN_ALPHA, MAX_ALPHA);
 
-    double alpha     = M_PI / 4.0;
-    double increment = M_PI / 8.0;
+    // The x trajectory is faster at low_alpha and slower at high_alpha
+    double low_alpha  = MIN_ALPHA;
+    double high_alpha = MAX_ALPHA;
 
-    while (increment > 1e-3)
+    // Keep track of the best alpha found, in case the durations can not be made equal
+    // within the tolerance (ex. if one axis doesn't need to move at all)
+    double best_alpha         = alpha;
+    double best_time_diff_sec = std::numeric_limits<double>::max();
+    for (unsigned int i = 0; i < MAX_ITERATIONS; i++)
     {
-        const double cos = std::cos(alpha);
-        const double sin = std::sin(alpha);
-
-        x_trajectory.generate(initial_pos.x(), final_pos.x(), initial_vel.x(),
-                              max_vel * cos, max_accel * cos, max_decel * cos);
-        y_trajectory.generate(initial_pos.y(), final_pos.y(), initial_vel.y(),
-                              max_vel * sin, max_accel * sin, max_decel * sin);
-
-        const double x_time_sec = x_trajectory.getTotalTime();
-        const double y_time_sec = y_trajectory.getTotalTime();
-        if (std::abs(x_time_sec - y_time_sec) < TRAJ_ACCURACY_TOLERANCE_SEC)
+        double time_diff_derivative;
+        const double time_diff_sec = calculateDurationDifference(
+            initial_pos, final_pos, initial_vel, max_vel, max_accel, max_decel, alpha,
+            time_diff_derivative);
+        if (std::abs(time_diff_sec) < std::abs(best_time_diff_sec))
+        {
+            best_alpha         = alpha;
+            best_time_diff_sec = time_diff_sec;
+        }
+        if (std::abs(time_diff_sec) < TRAJ_ACCURACY_TOLERANCE_SEC)
         {
-            // The duration of the trajectories are close enough, so we can stop the
-            // binary search.
             break;
         }
 
-        if (x_time_sec > y_time_sec)
+        // If the x trajectory takes longer, then the x axis needs a larger component
+        // of the constraints, so alpha must decrease
+        if (time_diff_sec > 0)
         {
-            // x trajectory takes longer, so decrease the alpha resulting in the x
-            // trajectory getting a larger component of the kinematic constraints relative
-            // to y and reaching the destination faster
-            alpha -= increment;
+            high_alpha = alpha;
         }
         else
         {
-            alpha += increment;
+            low_alpha = alpha;
+        }
+        if (high_alpha - low_alpha < MIN_ALPHA_RESOLUTION)
+        {
+            break;
         }
 
-        increment /= 2.0;
+        alpha = alpha - time_diff_sec / time_diff_derivative;
+        if (!(alpha > low_alpha && alpha < high_alpha))
+        {
+            alpha = (low_alpha + high_alpha) / 2.0;
+        }
     }
+
+    generateWithConstraintAngle(initial_pos, final_pos, initial_vel, max_vel, max_accel,
+                                max_decel, best_alpha);
+}
+
+double BangBangTrajectory2D::calculateDurationDifference(
+    const Point& initial_pos, const Point& final_pos, const Vector& initial_vel,
+    double max_vel, double max_accel, double max_decel, double alpha,
+    double& out_duration_difference_derivative) const
+{
+    const double cos = std::cos(alpha);
+    const double sin = std::sin(alpha);
+
+    double x_duration_derivative;
+    double y_duration_derivative;
+    const double x_duration_sec = x_trajectory.calculateDurationWithScaledConstraints(
+        initial_pos.x(), final_pos.x(), initial_vel.x(), max_vel, max_accel, max_decel,
+        cos, x_duration_derivative);
+    const double y_duration_sec = y_trajectory.calculateDurationWithScaledConstraints(
+        initial_pos.y(), final_pos.y(), initial_vel.y(), max_vel, max_accel, max_decel,
+        sin, y_duration_derivative);
+
+    // d(cos)/d(alpha) = -sin and d(sin)/d(alpha) = cos
+    out_duration_difference_derivative =
+        -sin * x_duration_derivative - cos * y_duration_derivative;
+    return x_duration_sec - y_duration_sec;
+}
+
+void BangBangTrajectory2D::generateWithConstraintAngle(const Point& initial_pos,
+                                                       const Point& final_pos,
+                                                       const Vector& initial_vel,
+                                                       double max_vel, double max_accel,
+                                                       double max_decel, double alpha)
+{
+    const double cos = std::cos(alpha);
+    const double sin = std::sin(alpha);
+
+    x_trajectory.generate(initial_pos.x(), final_pos.x(), initial_vel.x(), max_vel * cos,
+                          max_accel * cos, max_decel * cos);
+    y_trajectory.generate(initial_pos.y(), final_pos.y(), initial_vel.y(), max_vel * sin,
+                          max_accel * sin, max_decel * sin);
 }
 
 Point BangBangTrajectory2D::getPosition(double t_sec) const
@@ -113,11 +176,3 @@ std::vector<Rectangle> BangBangTrajectory2D::getBoundingBoxes() const
     return {Rectangle({x_min_max.first, y_min_max.first},
                       {x_min_max.second, y_min_max.second})};
 }
-
-std::shared_ptr<Trajectory2D> BangBangTrajectory2D::generator(
-    const Point& initial_pos, const Point& final_pos, const Vector& initial_vel,
-    const KinematicConstraints& constraints)
-{
-    return std::make_shared<BangBangTrajectory2D>(initial_pos, final_pos, initial_vel,
-                                                  constraints);
-}
@@ -84,24 +84,60 @@ class BangBangTrajectory2D : public Trajectory2D
      */
     std::vector<Rectangle> getBoundingBoxes() const override;
 
+   private:
     /**
-     * Static function for generating a BangBangTrajectory2D pointer with Trajectory2D
-     * interface
+     * Generates the x and y trajectories, with the kinematic constraints split between
+     * the x and y axes by the given angle
+     *
      * @param initial_pos Where the trajectory should start at
      * @param final_pos Where the trajectory should end at
      * @param initial_vel The initial velocity of the trajectory
-     * @param constraints The kinematic constraints of the trajectory
-     * @return A shared pointer to a BangBangTrajectory2D
+     * @param max_vel The maximum speed of the trajectory
+     * @param max_accel The maximum acceleration of the trajectory
+     * @param max_decel The maximum deceleration of the trajectory
+     * @param alpha The angle in radians, in (0, PI/2), that splits the constraints.
+     * The x axis gets cos(alpha) and the y axis gets sin(alpha) of each constraint.
      */
-    static std::shared_ptr<Trajectory2D> generator(
-        const Point& initial_pos, const Point& final_pos, const Vector& initial_vel,
-        const KinematicConstraints& constraints);
+    void generateWithConstraintAngle(const Point& initial_pos, const Point& final_pos,
+                                     const Vector& initial_vel, double max_vel,
+                                     double max_accel, double max_decel, double alpha);
+
+    /**
+     * Calculates how much longer the x trajectory would take than the y trajectory if
+     * they were generated with the kinematic constraints split by the given angle,
+     * without generating them
+     *
+     * @param initial_pos Where the trajectory should start at
+     * @param final_pos Where the trajectory should end at
+     * @param initial_vel The initial velocity of the trajectory
+     * @param max_vel The maximum speed of the trajectory
+     * @param max_accel The maximum acceleration of the trajectory
+     * @param max_decel The maximum deceleration of the trajectory
+     * @param alpha The angle in radians, in (0, PI/2), that splits the constraints, as
+     * in generateWithConstraintAngle
+     * @param out_duration_difference_derivative Out parameter for the derivative of the
+     * duration difference with respect to alpha
+     *
+     * @return The duration of the x trajectory minus the duration of the y trajectory
+     */
+    double calculateDurationDifference(const Point& initial_pos, const Point& final_pos,
+                                       const Vector& initial_vel, double max_vel,
+                                       double max_accel, double max_decel, double alpha,
+                                       double& out_duration_difference_derivative) const;
 
-   private:
     BangBangTrajectory1D x_trajectory;
     BangBangTrajectory1D y_trajectory;
 
     // The maximum difference the x and y trajectory runtimes could have from each other
     // in seconds
     static constexpr double TRAJ_ACCURACY_TOLERANCE_SEC = 0.01;
+
+    // Range of angles that the kinematic constraints can be split by. Both axes always
+    // get a non-zero component of the constraints.
+    static constexpr double MIN_ALPHA = 1e-6;
+    static constexpr double MAX_ALPHA = M_PI / 2.0 - MIN_ALPHA;
+    // The search for alpha stops once it is narrowed down to a range this small
+    static constexpr double MIN_ALPHA_RESOLUTION = 1e-6;
+    // Upper bound on the number of Newton iterations
+    static constexpr unsigned int MAX_ITERATIONS = 30;
 };
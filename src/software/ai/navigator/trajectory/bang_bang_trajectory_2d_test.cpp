@@ -2,7 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <random>
+#include <tuple>
 
 #include "software/logger/logger.h"
 #include "software/test_util/test_util.h"
@@ -103,6 +105,22 @@ TEST_F(BangBangTrajectory2DTest, test_random_start_and_final_position_sampling)
     }
 }
 
+TEST_F(BangBangTrajectory2DTest, test_trajectory_ends_exactly_at_destination)
+{
+    traj.generate(Point(0, 0), Point(4, 0), Vector(0, 0), 1, 1, 1);
+    EXPECT_EQ(Point(4, 0), traj.getPosition(traj.getTotalTime()));
+    EXPECT_EQ(Point(4, 0), traj.getPosition(traj.getTotalTime() + 1));
+
+    for (int i = 0; i < NUM_RANDOM_TESTS; ++i)
+    {
+        Point start_pos  = getRandomPoint();
+        Point final_pos  = getRandomPoint();
+        Vector start_vel = getRandomVector();
+        traj.generate(start_pos, final_pos, start_vel, 4, 3, 5);
+        ASSERT_EQ(final_pos, traj.getDestination());
+    }
+}
+
 TEST_F(BangBangTrajectory2DTest, test_trajectory_bounding_box)
 {
     Point start_pos(0, 0);
@@ -113,3 +131,52 @@ TEST_F(BangBangTrajectory2DTest, test_trajectory_bounding_box)
     EXPECT_TRUE(TestUtil::equalWithinTolerance(traj.getBoundingBoxes()[0],
                                                Rectangle(start_pos, destination), 1e-3));
 }
+
+TEST_F(BangBangTrajectory2DTest, test_trajectory_from_rest_is_straight_line)
+{
+    // When starting at rest, the constraints can be split between the axes so that
+    // both axes take exactly the same time, which moves the robot in a straight line
+    for (int i = 0; i < NUM_RANDOM_TESTS; ++i)
+    {
+        Point start_pos = getRandomPoint();
+        Point final_pos = getRandomPoint();
+        traj.generate(start_pos, final_pos, Vector(), 4, 3, 5);
+
+        const Vector direction = (final_pos - start_pos).normalize();
+        for (int j = 0; j <= NUM_SUB_POINTS; j++)
+        {
+            double t                   = j * traj.getTotalTime() / NUM_SUB_POINTS;
+            const Vector from_start    = traj.getPosition(t) - start_pos;
+            const double off_line_dist = std::abs(direction.cross(from_start));
+            ASSERT_LE(off_line_dist, 1e-3)
+                << "Trajectory from " << start_pos << " to " << final_pos
+                << " is not on a straight line at t=" << t;
+        }
+    }
+}
+
+TEST_F(BangBangTrajectory2DTest, DISABLED_generate_speed_test)
+{
+    const int num_trajectories = 100000;
+
+    std::vector<std::tuple<Point, Point, Vector>> queries;
+    for (int i = 0; i < num_trajectories; i++)
+    {
+        queries.emplace_back(getRandomPoint(), getRandomPoint(), getRandomVector());
+    }
+
+    double total_time_sec = 0.0;
+    auto start_time       = std::chrono::system_clock::now();
+    for (const auto& [start_pos, final_pos, start_vel] : queries)
+    {
+        traj.generate(start_pos, final_pos, start_vel, 4, 3, 5);
+        total_time_sec += traj.getTotalTime();
+    }
+
+    double duration_ms = ::TestUtil::millisecondsSince(start_time);
+    double avg_us      = duration_ms * 1000.0 / static_cast<double>(num_trajectories);
+
+    std::cout << "Took " << duration_ms << "ms to generate " << num_trajectories
+              << " trajectories, average time of " << avg_us
+              << "us (total trajectory time " << total_time_sec << "s)" << std::endl;
+}
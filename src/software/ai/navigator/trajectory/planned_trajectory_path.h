@@ -0,0 +1,17 @@
+#pragma once
+
+#include "software/ai/navigator/trajectory/trajectory_path.h"
+#include "software/time/timestamp.h"
+
+/**
+ * A trajectory path that was planned for a robot, along with the time at which the
+ * robot started following it
+ */
+struct PlannedTrajectoryPath
+{
+    // The planned trajectory path. Time 0 along the path is start_timestamp.
+    TrajectoryPath traj_path;
+
+    // The world timestamp at which the trajectory path was planned
+    Timestamp start_timestamp;
+};
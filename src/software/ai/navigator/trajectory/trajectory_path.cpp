@@ -2,10 +2,8 @@
 
 #include "software/logger/logger.h"
 
-TrajectoryPath::TrajectoryPath(const std::shared_ptr<Trajectory2D>& initial_trajectory,
-                               const TrajectoryGenerator& traj_generator)
-    : traj_path({TrajectoryPathNode(initial_trajectory)}),
-      trajectory_generator(traj_generator)
+TrajectoryPath::TrajectoryPath(const BangBangTrajectory2D& initial_trajectory)
+    : traj_path({TrajectoryPathNode(initial_trajectory)})
 {
 }
 
@@ -24,9 +22,10 @@ void TrajectoryPath::append(double connection_time_sec, const Point& destination
             // To have a smooth and continuous trajectory path, we want the start
             // position and velocity of the newly generated trajectory to be
             // the end position and velocity of the last trajectory.
-            Point connection_pos  = getPosition(connection_time_sec);
-            Vector connection_vel = getVelocity(connection_time_sec);
-            traj_path.emplace_back(trajectory_generator(connection_pos, destination,
+            const BangBangTrajectory2D& connection_traj = traj_path[i].getTrajectory();
+            Point connection_pos  = connection_traj.getPosition(connection_time_sec);
+            Vector connection_vel = connection_traj.getVelocity(connection_time_sec);
+            traj_path.emplace_back(BangBangTrajectory2D(connection_pos, destination,
                                                         connection_vel, constraints));
 
             traj_path[i].setTrajectoryEndTime(connection_time_sec);
@@ -45,7 +44,7 @@ Point TrajectoryPath::getPosition(double t_sec) const
     {
         if (t_sec <= traj.getTrajectoryEndTime())
         {
-            return traj.getTrajectory()->getPosition(t_sec);
+            return traj.getTrajectory().getPosition(t_sec);
         }
         else
         {
@@ -53,7 +52,7 @@ Point TrajectoryPath::getPosition(double t_sec) const
         }
     }
 
-    return traj_path.back().getTrajectory()->getDestination();
+    return traj_path.back().getTrajectory().getDestination();
 }
 
 Vector TrajectoryPath::getVelocity(double t_sec) const
@@ -62,7 +61,7 @@ Vector TrajectoryPath::getVelocity(double t_sec) const
     {
         if (t_sec <= traj.getTrajectoryEndTime())
         {
-            return traj.getTrajectory()->getVelocity(t_sec);
+            return traj.getTrajectory().getVelocity(t_sec);
         }
         else
         {
@@ -79,7 +78,7 @@ Vector TrajectoryPath::getAcceleration(double t_sec) const
     {
         if (t_sec <= traj.getTrajectoryEndTime())
         {
-            return traj.getTrajectory()->getAcceleration(t_sec);
+            return traj.getTrajectory().getAcceleration(t_sec);
         }
         else
         {
@@ -105,13 +104,13 @@ std::vector<Rectangle> TrajectoryPath::getBoundingBoxes() const
     std::vector<Rectangle> bounding_boxes;
     for (const TrajectoryPathNode& traj_node : traj_path)
     {
-        const std::vector<Rectangle> bbs = traj_node.getTrajectory()->getBoundingBoxes();
+        const std::vector<Rectangle> bbs = traj_node.getTrajectory().getBoundingBoxes();
         bounding_boxes.insert(bounding_boxes.begin(), bbs.begin(), bbs.end());
     }
     return bounding_boxes;
 }
 
-const std::vector<TrajectoryPathNode>& TrajectoryPath::getTrajectoryPathNodes() const
+const TrajectoryPathNodes& TrajectoryPath::getTrajectoryPathNodes() const
 {
     return traj_path;
 }
@@ -1,14 +1,16 @@
 #pragma once
 
-#include <functional>
-#include <memory>
+#include <boost/container/small_vector.hpp>
 
 #include "software/ai/navigator/trajectory/kinematic_constraints.h"
 #include "software/ai/navigator/trajectory/trajectory_path_node.h"
 
-using TrajectoryGenerator = std::function<std::shared_ptr<Trajectory2D>(
-    const Point& initial_pos, const Point& final_pos, const Vector& initial_vel,
-    const KinematicConstraints& constraints)>;
+// Trajectory paths rarely have more than a few nodes, so that many nodes are stored
+// inline to avoid allocating memory whenever a trajectory path is created, copied or
+// appended to
+static constexpr size_t NUM_INLINE_TRAJECTORY_PATH_NODES = 3;
+using TrajectoryPathNodes =
+    boost::container::small_vector<TrajectoryPathNode, NUM_INLINE_TRAJECTORY_PATH_NODES>;
 
 /**
  * TrajectoryPath represents a list of 2D trajectories that are connected end-to-end
@@ -24,11 +26,8 @@ class TrajectoryPath : public Trajectory2D
      * Constructor
      *
      * @param initial_trajectory The initial trajectory of this trajectory path
-     * @param traj_generator A function used to generate new trajectories given the
-     * kinematic constraints, initial position, final position, and initial velocity.
      */
-    TrajectoryPath(const std::shared_ptr<Trajectory2D>& initial_trajectory,
-                   const TrajectoryGenerator& traj_generator);
+    explicit TrajectoryPath(const BangBangTrajectory2D& initial_trajectory);
 
     /**
      * Generate and append a new trajectory to the end of this trajectory path
@@ -83,9 +82,8 @@ class TrajectoryPath : public Trajectory2D
      *
      * @return The list of TrajectoryPathNodes that make up this trajectory path
      */
-    const std::vector<TrajectoryPathNode>& getTrajectoryPathNodes() const;
+    const TrajectoryPathNodes& getTrajectoryPathNodes() const;
 
    private:
-    std::vector<TrajectoryPathNode> traj_path;
-    TrajectoryGenerator trajectory_generator;
+    TrajectoryPathNodes traj_path;
 };
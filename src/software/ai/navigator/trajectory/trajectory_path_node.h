@@ -1,11 +1,9 @@
 #pragma once
 
-#include <memory>
-
 #include "software/ai/navigator/trajectory/bang_bang_trajectory_2d.h"
 
 /**
- * A class that wraps Trajectory2D and allows for earlier trajectory
+ * A class that wraps BangBangTrajectory2D and allows for earlier trajectory
  * end-time than the actual full duration. This is useful for having
  * multiple trajectories continuously connected to each other to form
  * a path (TrajectoryPath).
@@ -18,7 +16,7 @@ class TrajectoryPathNode
      * @param trajectory Trajectory of this trajectory path node
      * @param trajectory_end_time_s End time of this trajectory
      */
-    TrajectoryPathNode(const std::shared_ptr<Trajectory2D> &trajectory,
+    TrajectoryPathNode(const BangBangTrajectory2D &trajectory,
                        double trajectory_end_time_s)
         : trajectory(trajectory), trajectory_end_time_s(trajectory_end_time_s){};
 
@@ -27,14 +25,14 @@ class TrajectoryPathNode
      * is the total time of the trajectory
      * @param trajectory Trajectory of this trajectory path node
      */
-    TrajectoryPathNode(const std::shared_ptr<Trajectory2D> &trajectory)
-        : trajectory(trajectory), trajectory_end_time_s(trajectory->getTotalTime()){};
+    TrajectoryPathNode(const BangBangTrajectory2D &trajectory)
+        : trajectory(trajectory), trajectory_end_time_s(trajectory.getTotalTime()){};
 
     /**
      * Get the trajectory of this trajectory path node
      * @return Trajectory of this trajectory path node
      */
-    const std::shared_ptr<Trajectory2D> &getTrajectory() const
+    const BangBangTrajectory2D &getTrajectory() const
     {
         return trajectory;
     }
@@ -58,6 +56,6 @@ class TrajectoryPathNode
     }
 
    private:
-    std::shared_ptr<Trajectory2D> trajectory;
+    BangBangTrajectory2D trajectory;
     double trajectory_end_time_s;
 };
@@ -3,23 +3,37 @@
 #include "software/geom/algorithms/contains.h"
 #include "software/geom/algorithms/distance.h"
 
-TrajectoryPlanner::TrajectoryPlanner()
-    : relative_sub_destinations(getRelativeSubDestinations())
+std::atomic<unsigned int> TrajectoryPlanner::num_warm_start_hits   = 0;
+std::atomic<unsigned int> TrajectoryPlanner::num_warm_start_misses = 0;
+
+TrajectoryPlanner &TrajectoryPlanner::getThreadLocalPlanner()
+{
+    thread_local TrajectoryPlanner planner;
+    return planner;
+}
+
+const TrajectoryPlanner::RelativeSubDestinationTable &
+TrajectoryPlanner::getRelativeSubDestinations()
 {
+    static const RelativeSubDestinationTable relative_sub_destinations =
+        createRelativeSubDestinations();
+    return relative_sub_destinations;
 }
 
-std::vector<Vector> TrajectoryPlanner::getRelativeSubDestinations()
+TrajectoryPlanner::RelativeSubDestinationTable
+TrajectoryPlanner::createRelativeSubDestinations()
 {
     // A set of sub destinations positioned around a circle relative to the robot.
-    std::vector<Vector> relative_sub_destinations;
+    RelativeSubDestinationTable relative_sub_destinations;
     const Angle sub_angles = Angle::full() / NUM_SUB_DESTINATION_ANGLES;
+    size_t index           = 0;
     for (const double distance : SUB_DESTINATION_DISTANCES_METERS)
     {
         for (unsigned int i = 0; i < NUM_SUB_DESTINATION_ANGLES; ++i)
         {
-            Angle angle = sub_angles * i;
-            relative_sub_destinations.emplace_back(
-                Vector::createFromAngle(angle).normalize(distance));
+            Angle angle   = sub_angles * i;
+            Vector offset = Vector::createFromAngle(angle).normalize(distance);
+            relative_sub_destinations[index++] = {offset, offset.orientation()};
         }
     }
     return relative_sub_destinations;
@@ -32,18 +46,18 @@ std::vector<Point> TrajectoryPlanner::getSubDestinations(
     // and filter out undesirable sub destinations to reduce trajectory sampling.
     std::vector<Point> sub_destinations;
     Angle direction = (destination - start).orientation();
-    sub_destinations.reserve(relative_sub_destinations.size());
+    sub_destinations.reserve(NUM_RELATIVE_SUB_DESTINATIONS);
 
-    for (const Vector &relative_sub_dest : relative_sub_destinations)
+    for (const RelativeSubDestination &relative_sub_dest : getRelativeSubDestinations())
     {
-        Angle sub_dest_angle_to_dest = relative_sub_dest.orientation().minDiff(direction);
+        Angle sub_dest_angle_to_dest = relative_sub_dest.orientation.minDiff(direction);
         if (sub_dest_angle_to_dest < MIN_SUB_DESTINATION_ANGLE ||
             sub_dest_angle_to_dest > MAX_SUB_DESTINATION_ANGLE)
         {
             continue;
         }
 
-        Point sub_dest = start + relative_sub_dest;
+        Point sub_dest = start + relative_sub_dest.offset;
         if (!contains(navigable_area, sub_dest))
         {
             continue;
@@ -64,8 +78,12 @@ std::optional<TrajectoryPath> TrajectoryPlanner::findTrajectory(
         return std::nullopt;
     }
 
+    // Broad-phase for all collision checks in this call. Collisions are never checked
+    // later than MAX_FUTURE_COLLISION_CHECK_SEC into the future.
+    const ObstacleGrid obstacle_grid(obstacles, MAX_FUTURE_COLLISION_CHECK_SEC);
+
     TrajectoryPathWithCost best_traj_with_cost = getDirectTrajectoryWithCost(
-        start, destination, initial_velocity, constraints, obstacles);
+        start, destination, initial_velocity, constraints, obstacle_grid);
 
     // Return direct trajectory to the destination if it doesn't have any collisions
     if (!best_traj_with_cost.collides())
@@ -75,11 +93,146 @@ std::optional<TrajectoryPath> TrajectoryPlanner::findTrajectory(
 
     // Sample trajectory paths by trying different sub destinations and connection times
     // and store the best trajectory path (min cost)
+    return sampleSubDestinations(start, destination, initial_velocity, constraints,
+                                 obstacle_grid,
+                                 getSubDestinations(start, destination, navigable_area),
+                                 prev_sub_destination, best_traj_with_cost)
+        .traj_path;
+}
+
+std::optional<TrajectoryPath> TrajectoryPlanner::findWarmStartedTrajectory(
+    const Point &start, const Point &destination, const Vector &initial_velocity,
+    const KinematicConstraints &constraints, const std::vector<ObstaclePtr> &obstacles,
+    const Rectangle &navigable_area, const TrajectoryPath &prev_traj_path,
+    double prev_traj_path_age_s)
+{
+    if (constraints.getMaxVelocity() <= 0.0 || constraints.getMaxAcceleration() <= 0.0 ||
+        constraints.getMaxDeceleration() <= 0.0)
+    {
+        return std::nullopt;
+    }
+
+    const ObstacleGrid obstacle_grid(obstacles, MAX_FUTURE_COLLISION_CHECK_SEC);
+
+    TrajectoryPathWithCost best_traj_with_cost = getDirectTrajectoryWithCost(
+        start, destination, initial_velocity, constraints, obstacle_grid);
+
+    // The direct trajectory is always preferred if it doesn't have any collisions
+    if (!best_traj_with_cost.collides())
+    {
+        return best_traj_with_cost.traj_path;
+    }
+
+    const auto &prev_path_nodes = prev_traj_path.getTrajectoryPathNodes();
+    std::optional<Point> prev_sub_destination;
+    if (!prev_path_nodes.empty())
+    {
+        prev_sub_destination = prev_path_nodes[0].getTrajectory().getDestination();
+    }
+
+    // Only warm start from a previous trajectory path that went through a sub
+    // destination to (about) the same destination. Otherwise, there is nothing to
+    // reuse and all sub destinations are sampled.
+    if (prev_path_nodes.size() < 2 || prev_traj_path_age_s < 0.0 ||
+        distance(prev_traj_path.getDestination(), destination) >
+            WARM_START_MAX_DESTINATION_CHANGE_METERS)
+    {
+        num_warm_start_misses++;
+        return sampleSubDestinations(
+                   start, destination, initial_velocity, constraints, obstacle_grid,
+                   getSubDestinations(start, destination, navigable_area),
+                   prev_sub_destination, best_traj_with_cost)
+            .traj_path;
+    }
+
+    // Shift the previous trajectory path forward to now, by connecting to the
+    // destination prev_traj_path_age_s earlier than it was planned to
+    const double connection_time =
+        prev_path_nodes[0].getTrajectoryEndTime() - prev_traj_path_age_s;
+    if (connection_time > 0.0)
+    {
+        TrajectoryPathWithCost sub_trajectory =
+            getDirectTrajectoryWithCost(start, prev_sub_destination.value(),
+                                        initial_velocity, constraints, obstacle_grid);
+        if (connection_time <= sub_trajectory.traj_path.getTotalTime())
+        {
+            TrajectoryPath warm_traj_path = sub_trajectory.traj_path;
+            warm_traj_path.append(connection_time, destination, constraints);
+            TrajectoryPathWithCost warm_traj_with_cost = getTrajectoryWithCost(
+                warm_traj_path, obstacle_grid, sub_trajectory, connection_time);
+
+            const double expected_total_time =
+                prev_traj_path.getTotalTime() - prev_traj_path_age_s;
+            if (!warm_traj_with_cost.collides() &&
+                warm_traj_path.getTotalTime() <=
+                    expected_total_time + WARM_START_MAX_EXTRA_TIME_SEC)
+            {
+                num_warm_start_hits++;
+                return warm_traj_path;
+            }
+
+            warm_traj_with_cost.cost += SUB_DESTINATION_CLOSE_BONUS_COST;
+            if (warm_traj_with_cost.cost < best_traj_with_cost.cost)
+            {
+                best_traj_with_cost = warm_traj_with_cost;
+            }
+        }
+    }
+    num_warm_start_misses++;
+
+    // The obstacles have likely only moved slightly since the previous trajectory path
+    // was planned, so first look for a better trajectory path near the previous one
+    std::vector<Point> nearby_sub_destinations;
+    std::vector<Point> other_sub_destinations;
     for (const Point &sub_dest : getSubDestinations(start, destination, navigable_area))
+    {
+        if (distance(sub_dest, prev_sub_destination.value()) <=
+            WARM_START_SUB_DESTINATION_RADIUS_METERS)
+        {
+            nearby_sub_destinations.emplace_back(sub_dest);
+        }
+        else
+        {
+            other_sub_destinations.emplace_back(sub_dest);
+        }
+    }
+
+    best_traj_with_cost = sampleSubDestinations(
+        start, destination, initial_velocity, constraints, obstacle_grid,
+        nearby_sub_destinations, prev_sub_destination, best_traj_with_cost);
+    if (!best_traj_with_cost.collides())
+    {
+        return best_traj_with_cost.traj_path;
+    }
+
+    return sampleSubDestinations(start, destination, initial_velocity, constraints,
+                                 obstacle_grid, other_sub_destinations,
+                                 prev_sub_destination, best_traj_with_cost)
+        .traj_path;
+}
+
+unsigned int TrajectoryPlanner::getNumWarmStartHits()
+{
+    return num_warm_start_hits;
+}
+
+unsigned int TrajectoryPlanner::getNumWarmStartMisses()
+{
+    return num_warm_start_misses;
+}
+
+TrajectoryPathWithCost TrajectoryPlanner::sampleSubDestinations(
+    const Point &start, const Point &destination, const Vector &initial_velocity,
+    const KinematicConstraints &constraints, const ObstacleGrid &obstacle_grid,
+    const std::vector<Point> &sub_destinations,
+    const std::optional<Point> &prev_sub_destination,
+    TrajectoryPathWithCost best_traj_with_cost)
+{
+    for (const Point &sub_dest : sub_destinations)
     {
         // Generate a direct trajectory to the sub destination
         TrajectoryPathWithCost sub_trajectory = getDirectTrajectoryWithCost(
-            start, sub_dest, initial_velocity, constraints, obstacles);
+            start, sub_dest, initial_velocity, constraints, obstacle_grid);
 
         // Prefer sub destinations that are closer to the previous sub destination.
         // This is used to avoid oscillation between two sub destinations that return a
@@ -109,7 +262,7 @@ std::optional<TrajectoryPath> TrajectoryPlanner::findTrajectory(
             }
 
             TrajectoryPathWithCost full_traj_with_cost = getTrajectoryWithCost(
-                traj_path_to_dest, obstacles, sub_trajectory, connection_time);
+                traj_path_to_dest, obstacle_grid, sub_trajectory, connection_time);
             full_traj_with_cost.cost += cost_offset;
             if (full_traj_with_cost.cost < best_traj_with_cost.cost)
             {
@@ -132,22 +285,20 @@ std::optional<TrajectoryPath> TrajectoryPlanner::findTrajectory(
         }
     }
 
-    return best_traj_with_cost.traj_path;
+    return best_traj_with_cost;
 }
 
 TrajectoryPathWithCost TrajectoryPlanner::getDirectTrajectoryWithCost(
     const Point &start, const Point &destination, const Vector &initial_velocity,
-    const KinematicConstraints &constraints, const std::vector<ObstaclePtr> &obstacles)
+    const KinematicConstraints &constraints, const ObstacleGrid &obstacle_grid)
 {
-    return getTrajectoryWithCost(
-        TrajectoryPath(std::make_shared<BangBangTrajectory2D>(
-                           start, destination, initial_velocity, constraints),
-                       BangBangTrajectory2D::generator),
-        obstacles, std::nullopt, std::nullopt);
+    return getTrajectoryWithCost(TrajectoryPath(BangBangTrajectory2D(
+                                     start, destination, initial_velocity, constraints)),
+                                 obstacle_grid, std::nullopt, std::nullopt);
 }
 
 TrajectoryPathWithCost TrajectoryPlanner::getTrajectoryWithCost(
-    const TrajectoryPath &trajectory, const std::vector<ObstaclePtr> &obstacles,
+    const TrajectoryPath &trajectory, const ObstacleGrid &obstacle_grid,
     const std::optional<TrajectoryPathWithCost> &sub_traj_with_cost,
     const std::optional<double> sub_traj_duration_s)
 {
@@ -170,7 +321,7 @@ TrajectoryPathWithCost TrajectoryPlanner::getTrajectoryWithCost(
     else
     {
         first_non_collision_time =
-            getFirstNonCollisionTime(trajectory, obstacles, search_end_time_s);
+            getFirstNonCollisionTime(trajectory, obstacle_grid, search_end_time_s);
     }
     traj_with_cost.collision_duration_front_s = first_non_collision_time;
 
@@ -178,7 +329,7 @@ TrajectoryPathWithCost TrajectoryPlanner::getTrajectoryWithCost(
      * Find the duration we're within an obstacle before search_end_time_s
      */
     double last_non_collision_time =
-        getLastNonCollisionTime(trajectory, obstacles, search_end_time_s);
+        getLastNonCollisionTime(trajectory, obstacle_grid, search_end_time_s);
     traj_with_cost.collision_duration_back_s =
         search_end_time_s - last_non_collision_time;
 
@@ -195,8 +346,27 @@ TrajectoryPathWithCost TrajectoryPlanner::getTrajectoryWithCost(
     }
     else
     {
-        std::pair<double, ObstaclePtr> collision = getFirstCollisionTime(
-            trajectory, obstacles, first_non_collision_time, last_non_collision_time);
+        // The cached sub-trajectory is identical to this trajectory up to
+        // sub_traj_duration_s. If it was checked for collisions past that time without
+        // finding one, there is no need to check that part of the trajectory again.
+        double collision_search_start_time_s = first_non_collision_time;
+        if (sub_traj_with_cost.has_value() &&
+            sub_traj_with_cost->collision_duration_front_s < sub_traj_duration_s)
+        {
+            const double sub_traj_last_non_collision_time_s =
+                std::min(sub_traj_with_cost->traj_path.getTotalTime(),
+                         MAX_FUTURE_COLLISION_CHECK_SEC) -
+                sub_traj_with_cost->collision_duration_back_s;
+            if (sub_traj_last_non_collision_time_s >= sub_traj_duration_s)
+            {
+                collision_search_start_time_s =
+                    std::max(collision_search_start_time_s, sub_traj_duration_s.value());
+            }
+        }
+
+        std::pair<double, ObstaclePtr> collision =
+            getFirstCollisionTime(trajectory, obstacle_grid,
+                                  collision_search_start_time_s, last_non_collision_time);
         traj_with_cost.first_collision_time_s = collision.first;
         traj_with_cost.colliding_obstacle     = collision.second;
     }
@@ -235,26 +405,16 @@ double TrajectoryPlanner::calculateCost(
     return total_cost;
 }
 
-double TrajectoryPlanner::getFirstNonCollisionTime(
-    const TrajectoryPath &traj_path, const std::vector<ObstaclePtr> &obstacles,
-    const double search_end_time_s) const
+double TrajectoryPlanner::getFirstNonCollisionTime(const TrajectoryPath &traj_path,
+                                                   const ObstacleGrid &obstacle_grid,
+                                                   const double search_end_time_s) const
 {
     double path_duration = traj_path.getTotalTime();
     for (double time = 0.0; time <= search_end_time_s;
          time += FORWARD_COLLISION_CHECK_STEP_INTERVAL_SEC)
     {
-        Point position       = traj_path.getPosition(time);
-        bool collision_found = false;
-        for (const ObstaclePtr &obstacle : obstacles)
-        {
-            if (obstacle->contains(position, time))
-            {
-                collision_found = true;
-                break;
-            }
-        }
-
-        if (!collision_found)
+        Point position = traj_path.getPosition(time);
+        if (!obstacle_grid.contains(position, time))
         {
             return time;
         }
@@ -263,19 +423,17 @@ double TrajectoryPlanner::getFirstNonCollisionTime(
 }
 
 std::pair<double, ObstaclePtr> TrajectoryPlanner::getFirstCollisionTime(
-    const TrajectoryPath &traj_path, const std::vector<ObstaclePtr> &obstacles,
+    const TrajectoryPath &traj_path, const ObstacleGrid &obstacle_grid,
     const double start_time_s, const double search_end_time_s) const
 {
     for (double time = start_time_s; time <= search_end_time_s;
          time += COLLISION_CHECK_STEP_INTERVAL_SEC)
     {
-        Point position = traj_path.getPosition(time);
-        for (const ObstaclePtr &obstacle : obstacles)
+        Point position       = traj_path.getPosition(time);
+        ObstaclePtr obstacle = obstacle_grid.findContainingObstacle(position, time);
+        if (obstacle != nullptr)
         {
-            if (obstacle->contains(position, time))
-            {
-                return std::make_pair(time, obstacle);
-            }
+            return std::make_pair(time, obstacle);
         }
     }
 
@@ -283,25 +441,15 @@ std::pair<double, ObstaclePtr> TrajectoryPlanner::getFirstCollisionTime(
     return std::make_pair(std::numeric_limits<double>::max(), nullptr);
 }
 
-double TrajectoryPlanner::getLastNonCollisionTime(
-    const TrajectoryPath &traj_path, const std::vector<ObstaclePtr> &obstacles,
-    const double search_end_time_s) const
+double TrajectoryPlanner::getLastNonCollisionTime(const TrajectoryPath &traj_path,
+                                                  const ObstacleGrid &obstacle_grid,
+                                                  const double search_end_time_s) const
 {
     for (double time = search_end_time_s; time >= 0.0;
          time -= COLLISION_CHECK_STEP_INTERVAL_SEC)
     {
-        Point position       = traj_path.getPosition(time);
-        bool collision_found = false;
-        for (const ObstaclePtr &obstacle : obstacles)
-        {
-            if (obstacle->contains(position, time))
-            {
-                collision_found = true;
-                break;
-            }
-        }
-
-        if (!collision_found)
+        Point position = traj_path.getPosition(time);
+        if (!obstacle_grid.contains(position, time))
         {
             return time;
         }
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <optional>
 
 #include "software/ai/navigator/obstacle/obstacle.hpp"
+#include "software/ai/navigator/obstacle/obstacle_grid.h"
 #include "software/ai/navigator/trajectory/trajectory_path.h"
 #include "software/ai/navigator/trajectory/trajectory_path_with_cost.h"
 
@@ -12,7 +15,17 @@ class TrajectoryPlanner
     /**
      * Constructor
      */
-    TrajectoryPlanner();
+    TrajectoryPlanner() = default;
+
+    /**
+     * Gets a trajectory planner that is owned by the calling thread. The planner is
+     * created the first time it is requested on a thread and lives for as long as the
+     * thread does, so that primitives can borrow it instead of each constructing
+     * their own.
+     *
+     * @return the calling thread's trajectory planner
+     */
+    static TrajectoryPlanner &getThreadLocalPlanner();
 
     /**
      * Find a trajectory from the start position to the destination which
@@ -34,7 +47,78 @@ class TrajectoryPlanner
         const std::vector<ObstaclePtr> &obstacles, const Rectangle &navigable_area,
         const std::optional<Point> &prev_sub_destination = std::nullopt);
 
+    /**
+     * Find a trajectory from the start position to the destination which
+     * attempts to avoid the list of obstacles, warm started from the trajectory path
+     * that was planned for the same robot on a previous tick.
+     *
+     * As with findTrajectory, the direct trajectory to the destination is returned if
+     * it is collision-free. Otherwise, the previous trajectory path is shifted forward
+     * in time to now, by regenerating it from the start position through the same sub
+     * destination, and re-validated against the current obstacles. If it is
+     * collision-free and not much slower than the previous trajectory path was
+     * expected to be, it is reused without sampling any sub destinations (a warm start
+     * hit). Otherwise (a warm start miss), only the sub destinations close to the
+     * previous sub destination are sampled, falling back to sampling all other sub
+     * destinations if none of those lead to a collision-free trajectory path.
+     *
+     * @param start Start position of the trajectory
+     * @param destination Destination of the trajectory
+     * @param initial_velocity Initial velocity of the trajectory
+     * @param constraints Kinematic constraints of the trajectory
+     * @param obstacles List of obstacles to avoid
+     * @param navigable_area The navigable area of the field
+     * @param prev_traj_path The trajectory path that was previously planned for this
+     * robot
+     * @param prev_traj_path_age_s Time in seconds since prev_traj_path was planned
+     * @return TrajectoryPath which attempts to avoid the obstacles
+     */
+    std::optional<TrajectoryPath> findWarmStartedTrajectory(
+        const Point &start, const Point &destination, const Vector &initial_velocity,
+        const KinematicConstraints &constraints,
+        const std::vector<ObstaclePtr> &obstacles, const Rectangle &navigable_area,
+        const TrajectoryPath &prev_traj_path, double prev_traj_path_age_s);
+
+    /**
+     * Gets the number of times findWarmStartedTrajectory has reused a previous
+     * trajectory path, across all trajectory planners
+     *
+     * @return the number of warm start hits
+     */
+    static unsigned int getNumWarmStartHits();
+
+    /**
+     * Gets the number of times findWarmStartedTrajectory could not reuse a previous
+     * trajectory path and had to sample sub destinations, across all trajectory
+     * planners
+     *
+     * @return the number of warm start misses
+     */
+    static unsigned int getNumWarmStartMisses();
+
    private:
+    /**
+     * Samples trajectory paths through the given sub destinations and returns the
+     * best of them, or the given best trajectory path if none of them are better
+     *
+     * @param start Start position of the trajectory
+     * @param destination Destination of the trajectory
+     * @param initial_velocity Initial velocity of the trajectory
+     * @param constraints Kinematic constraints of the trajectory
+     * @param obstacle_grid Grid of all obstacles
+     * @param sub_destinations The sub destinations to sample trajectory paths through
+     * @param prev_sub_destination The previous sub destination of this robot.
+     * nullopt if there is no previous sub destination
+     * @param best_traj_with_cost The best trajectory path found so far
+     * @return The trajectory path with the lowest cost
+     */
+    TrajectoryPathWithCost sampleSubDestinations(
+        const Point &start, const Point &destination, const Vector &initial_velocity,
+        const KinematicConstraints &constraints, const ObstacleGrid &obstacle_grid,
+        const std::vector<Point> &sub_destinations,
+        const std::optional<Point> &prev_sub_destination,
+        TrajectoryPathWithCost best_traj_with_cost);
+
     /**
      * Calculate the cost of the given trajectory path with cost
      *
@@ -51,26 +135,25 @@ class TrajectoryPlanner
      * @param destination Destination of the trajectory
      * @param initial_velocity Initial velocity of the trajectory
      * @param constraints Kinematic constraints of the trajectory
-     * @param obstacles List of all obstacles
+     * @param obstacle_grid Grid of all obstacles
      * @return A trajectory path with only a single trajectory + its cost
      */
     TrajectoryPathWithCost getDirectTrajectoryWithCost(
         const Point &start, const Point &destination, const Vector &initial_velocity,
-        const KinematicConstraints &constraints,
-        const std::vector<ObstaclePtr> &obstacles);
+        const KinematicConstraints &constraints, const ObstacleGrid &obstacle_grid);
 
     /**
      * Given a trajectory path, calculate its cost
      *
      * @param trajectory The trajectory path to calculate the cost of
-     * @param obstacles List of all obstacles
+     * @param obstacle_grid Grid of all obstacles
      * @param sub_traj_with_cost Optional cached trajectory path with cost of the sub
      * trajectory
      * @param sub_traj_duration_s Optional duration of the cached sub_traj_with_cost
      * @return The trajectory path with its cost
      */
     TrajectoryPathWithCost getTrajectoryWithCost(
-        const TrajectoryPath &trajectory, const std::vector<ObstaclePtr> &obstacles,
+        const TrajectoryPath &trajectory, const ObstacleGrid &obstacle_grid,
         const std::optional<TrajectoryPathWithCost> &sub_traj_with_cost,
         const std::optional<double> sub_traj_duration_s);
 
@@ -79,13 +162,13 @@ class TrajectoryPlanner
      * E.g. will return 0 if the trajectory's start position is not in an obstacle
      *
      * @param traj_path The trajectory path to check
-     * @param obstacles A list of all obstacles
+     * @param obstacle_grid Grid of all obstacles
      * @param search_end_time_s The latest time to check for collisions
      * @return Earliest non-collision time, or traj_path.getTotalDuration() if the
      * trajectory is in a collision from start to search_end_time_s
      */
     double getFirstNonCollisionTime(const TrajectoryPath &traj_path,
-                                    const std::vector<ObstaclePtr> &obstacles,
+                                    const ObstacleGrid &obstacle_grid,
                                     const double search_end_time_s) const;
 
     /**
@@ -93,7 +176,7 @@ class TrajectoryPlanner
      * for the given trajectory path and obstacles.
      *
      * @param traj_path The trajectory path to check
-     * @param obstacles The list of all obstacles
+     * @param obstacle_grid Grid of all obstacles
      * @param start_time_s The time in seconds to start the search from
      * @param search_end_time_s The time in seconds to stop the search at
      * @return The first collision time within [start_time_sec and search_end_time_s]
@@ -101,7 +184,7 @@ class TrajectoryPlanner
      * std::numeric_limits<double>::max() and nullptr.
      */
     std::pair<double, ObstaclePtr> getFirstCollisionTime(
-        const TrajectoryPath &traj_path, const std::vector<ObstaclePtr> &obstacles,
+        const TrajectoryPath &traj_path, const ObstacleGrid &obstacle_grid,
         const double start_time_s, const double search_end_time_s) const;
 
     /**
@@ -110,14 +193,14 @@ class TrajectoryPlanner
      * end in a collision.
      *
      * @param traj_path The trajectory path to check
-     * @param obstacles The list of all obstacles
+     * @param obstacle_grid Grid of all obstacles
      * @param search_end_time_s The latest time to check for collisions. Assumed to
      * be within the duration of the trajectory path.
      * @return Time in seconds at which the trajectory is not in a collision. Result
      * will be in the range [0, search_end_time_s].
      */
     double getLastNonCollisionTime(const TrajectoryPath &traj_path,
-                                   const std::vector<ObstaclePtr> &obstacles,
+                                   const ObstacleGrid &obstacle_grid,
                                    const double search_end_time_s) const;
 
     /**
@@ -133,21 +216,44 @@ class TrajectoryPlanner
     std::vector<Point> getSubDestinations(const Point &start, const Point &destination,
                                           const Rectangle &navigable_area) const;
 
-    /**
-     * Helper function for generating the relative sub destinations
-     * given the constants below.
-     *
-     * @return The vector of relative sub destinations
-     */
-    static std::vector<Vector> getRelativeSubDestinations();
-
-    const std::vector<Vector> relative_sub_destinations;
     static constexpr std::array<double, 4> SUB_DESTINATION_DISTANCES_METERS = {0.4, 1.1,
                                                                                2.3, 3};
     static constexpr unsigned int NUM_SUB_DESTINATION_ANGLES                = 16;
+    static constexpr size_t NUM_RELATIVE_SUB_DESTINATIONS =
+        SUB_DESTINATION_DISTANCES_METERS.size() * NUM_SUB_DESTINATION_ANGLES;
     static constexpr Angle MIN_SUB_DESTINATION_ANGLE = Angle::fromDegrees(20);
     static constexpr Angle MAX_SUB_DESTINATION_ANGLE = Angle::fromDegrees(140);
 
+    /**
+     * A sub destination relative to the start position, along with its orientation
+     * so that it can be filtered by angle without any trig calls
+     */
+    struct RelativeSubDestination
+    {
+        Vector offset;
+        Angle orientation;
+    };
+
+    using RelativeSubDestinationTable =
+        std::array<RelativeSubDestination, NUM_RELATIVE_SUB_DESTINATIONS>;
+
+    /**
+     * Gets the relative sub destinations given the constants above. The table is
+     * computed once, the first time it is requested, and shared by all trajectory
+     * planners.
+     *
+     * @return The table of relative sub destinations
+     */
+    static const RelativeSubDestinationTable &getRelativeSubDestinations();
+
+    /**
+     * Helper function for generating the relative sub destinations
+     * given the constants above.
+     *
+     * @return The table of relative sub destinations
+     */
+    static RelativeSubDestinationTable createRelativeSubDestinations();
+
     const double SUB_DESTINATION_STEP_INTERVAL_SEC         = 0.2;
     const double COLLISION_CHECK_STEP_INTERVAL_SEC         = 0.1;
     const double FORWARD_COLLISION_CHECK_STEP_INTERVAL_SEC = 0.05;
@@ -155,4 +261,19 @@ class TrajectoryPlanner
 
     const double SUB_DESTINATION_CLOSE_BONUS_THRESHOLD_METERS = 0.1;
     const double SUB_DESTINATION_CLOSE_BONUS_COST             = -0.3;
+
+    // A previous trajectory path is only reused if it is at most this much slower than
+    // it was expected to be when it was planned
+    const double WARM_START_MAX_EXTRA_TIME_SEC = 0.1;
+    // A previous trajectory path is only warm started from if its destination is
+    // within this distance of the new destination
+    const double WARM_START_MAX_DESTINATION_CHANGE_METERS = 0.1;
+    // On a warm start miss, only sub destinations within this distance of the previous
+    // sub destination are sampled
+    const double WARM_START_SUB_DESTINATION_RADIUS_METERS = 0.8;
+
+    // Warm start statistics across all trajectory planners. Trajectory planners may
+    // run on several threads at once.
+    static std::atomic<unsigned int> num_warm_start_hits;
+    static std::atomic<unsigned int> num_warm_start_misses;
 };
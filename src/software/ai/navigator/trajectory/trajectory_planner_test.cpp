@@ -2,8 +2,12 @@
 
 #include <gtest/gtest.h>
 
+#include <random>
+#include <thread>
+
 #include "software/ai/navigator/obstacle/robot_navigation_obstacle_factory.h"
 #include "software/geom/algorithms/contains.h"
+#include "software/test_util/allocation_counter.h"
 #include "software/test_util/test_util.h"
 
 class TrajectoryPlannerTest : public testing::Test
@@ -73,6 +77,38 @@ class TrajectoryPlannerTest : public testing::Test
         }
     }
 
+    /**
+     * Creates the obstacles of a crowded field with both teams' robots and the usual
+     * motion constraints
+     *
+     * @param random_num_gen The random number generator to place the robots with
+     * @return the obstacles
+     */
+    std::vector<ObstaclePtr> createCrowdedFieldObstacles(std::mt19937& random_num_gen)
+    {
+        std::uniform_real_distribution x_distribution(-world->field().xLength() / 2,
+                                                      world->field().xLength() / 2);
+        std::uniform_real_distribution y_distribution(-world->field().yLength() / 2,
+                                                      world->field().yLength() / 2);
+        std::uniform_real_distribution velocity_distribution(-2.0, 2.0);
+
+        std::vector<ObstaclePtr> obstacles = {friendly_defense_area_obstacle,
+                                              center_circle_obstacle};
+        for (RobotId id = 0; id < 11; id++)
+        {
+            Robot enemy(
+                id, Point(x_distribution(random_num_gen), y_distribution(random_num_gen)),
+                Vector(velocity_distribution(random_num_gen),
+                       velocity_distribution(random_num_gen)),
+                Angle::zero(), AngularVelocity::zero(), Timestamp::fromSeconds(0));
+            obstacles.push_back(
+                obstacle_factory.createConstVelocityEnemyRobotObstacle(enemy));
+            obstacles.push_back(obstacle_factory.createStaticObstacleFromRobotPosition(
+                Point(x_distribution(random_num_gen), y_distribution(random_num_gen))));
+        }
+        return obstacles;
+    }
+
     TrajectoryPlanner traj_planner;
     std::shared_ptr<World> world;
     RobotNavigationObstacleFactory obstacle_factory;
@@ -186,3 +222,244 @@ TEST_F(TrajectoryPlannerTest, test_traj_avoid_enemy_half_and_ball_during_friendl
     verifyNoCollision(traj_path.value(), obstacles);
     verifyTrajectoryIsWithinRectangle(traj_path.value(), valid_traj_rectangle);
 }
+
+TEST_F(TrajectoryPlannerTest, test_warm_start_reuses_valid_previous_trajectory)
+{
+    Point start_pos(-1.0, 0.0);
+    Point destination(1.0, 0.0);
+    std::vector obstacles = {robot_obstacle};
+
+    auto prev_traj_path =
+        traj_planner.findTrajectory(start_pos, destination, Vector(), constraints,
+                                    obstacles, world->field().fieldBoundary());
+    ASSERT_TRUE(prev_traj_path.has_value());
+    ASSERT_GE(prev_traj_path->getTrajectoryPathNodes().size(), 2);
+
+    // The robot has followed the previous trajectory path for one tick
+    const double age_s      = 1.0 / 60.0;
+    unsigned int num_hits   = TrajectoryPlanner::getNumWarmStartHits();
+    unsigned int num_misses = TrajectoryPlanner::getNumWarmStartMisses();
+    auto traj_path          = traj_planner.findWarmStartedTrajectory(
+        prev_traj_path->getPosition(age_s), destination,
+        prev_traj_path->getVelocity(age_s), constraints, obstacles,
+        world->field().fieldBoundary(), prev_traj_path.value(), age_s);
+
+    ASSERT_TRUE(traj_path.has_value());
+    EXPECT_EQ(TrajectoryPlanner::getNumWarmStartHits(), num_hits + 1);
+    EXPECT_EQ(TrajectoryPlanner::getNumWarmStartMisses(), num_misses);
+    EXPECT_EQ(traj_path->getDestination(), destination);
+    EXPECT_EQ(
+        traj_path->getTrajectoryPathNodes()[0].getTrajectory().getDestination(),
+        prev_traj_path->getTrajectoryPathNodes()[0].getTrajectory().getDestination());
+    EXPECT_NEAR(traj_path->getTotalTime(), prev_traj_path->getTotalTime() - age_s, 0.01);
+    verifyNoCollision(traj_path.value(), obstacles);
+}
+
+TEST_F(TrajectoryPlannerTest, test_warm_start_replans_when_previous_trajectory_is_blocked)
+{
+    Point start_pos(-1.0, 0.0);
+    Point destination(1.0, 0.0);
+    std::vector obstacles = {robot_obstacle};
+
+    auto prev_traj_path =
+        traj_planner.findTrajectory(start_pos, destination, Vector(), constraints,
+                                    obstacles, world->field().fieldBoundary());
+    ASSERT_TRUE(prev_traj_path.has_value());
+    ASSERT_GE(prev_traj_path->getTrajectoryPathNodes().size(), 2);
+
+    // A robot has moved onto the previous trajectory path, right where it turns
+    // towards the destination
+    obstacles.push_back(obstacle_factory.createStaticObstacleFromRobotPosition(
+        prev_traj_path->getPosition(
+            prev_traj_path->getTrajectoryPathNodes()[0].getTrajectoryEndTime())));
+
+    unsigned int num_hits   = TrajectoryPlanner::getNumWarmStartHits();
+    unsigned int num_misses = TrajectoryPlanner::getNumWarmStartMisses();
+    auto traj_path          = traj_planner.findWarmStartedTrajectory(
+        start_pos, destination, Vector(), constraints, obstacles,
+        world->field().fieldBoundary(), prev_traj_path.value(), 0.0);
+
+    ASSERT_TRUE(traj_path.has_value());
+    EXPECT_EQ(TrajectoryPlanner::getNumWarmStartHits(), num_hits);
+    EXPECT_EQ(TrajectoryPlanner::getNumWarmStartMisses(), num_misses + 1);
+    EXPECT_EQ(traj_path->getPosition(0.0), start_pos);
+    EXPECT_EQ(traj_path->getDestination(), destination);
+    verifyNoCollision(traj_path.value(), obstacles);
+}
+
+TEST_F(TrajectoryPlannerTest, test_warm_start_misses_when_previous_trajectory_has_expired)
+{
+    Point start_pos(-1.0, 0.0);
+    Point destination(1.0, 0.0);
+    std::vector obstacles = {robot_obstacle};
+
+    auto prev_traj_path =
+        traj_planner.findTrajectory(start_pos, destination, Vector(), constraints,
+                                    obstacles, world->field().fieldBoundary());
+    ASSERT_TRUE(prev_traj_path.has_value());
+    ASSERT_GE(prev_traj_path->getTrajectoryPathNodes().size(), 2);
+
+    // The previous trajectory path should have already turned towards the destination,
+    // so there is nothing to reuse
+    unsigned int num_hits   = TrajectoryPlanner::getNumWarmStartHits();
+    unsigned int num_misses = TrajectoryPlanner::getNumWarmStartMisses();
+    auto traj_path          = traj_planner.findWarmStartedTrajectory(
+        start_pos, destination, Vector(), constraints, obstacles,
+        world->field().fieldBoundary(), prev_traj_path.value(),
+        prev_traj_path->getTrajectoryPathNodes()[0].getTrajectoryEndTime());
+
+    ASSERT_TRUE(traj_path.has_value());
+    EXPECT_EQ(TrajectoryPlanner::getNumWarmStartHits(), num_hits);
+    EXPECT_EQ(TrajectoryPlanner::getNumWarmStartMisses(), num_misses + 1);
+    EXPECT_EQ(traj_path->getDestination(), destination);
+    verifyNoCollision(traj_path.value(), obstacles);
+}
+
+TEST_F(TrajectoryPlannerTest, test_sampling_trajectory_paths_does_not_allocate)
+{
+    // A line of robots between the start positions and the destination, so that many
+    // trajectory paths have to be sampled
+    std::vector<ObstaclePtr> obstacles;
+    for (int i = -3; i <= 3; i++)
+    {
+        obstacles.push_back(
+            obstacle_factory.createStaticObstacleFromRobotPosition(Point(0, i * 0.3)));
+    }
+    Rectangle navigable_area = world->field().fieldBoundary();
+
+    auto count_planning_allocations = [&](const Point& start_pos) {
+        AllocationCounter allocation_counter;
+        auto traj_path = traj_planner.findTrajectory(
+            start_pos, Point(2, 0), Vector(), constraints, obstacles, navigable_area);
+        size_t num_allocations = allocation_counter.getNumAllocations();
+        EXPECT_TRUE(traj_path.has_value());
+        return num_allocations;
+    };
+
+    // The number of allocations made while planning should not depend on how many
+    // trajectory paths are sampled
+    size_t num_allocations_close = count_planning_allocations(Point(-0.5, 0));
+    size_t num_allocations_far   = count_planning_allocations(Point(-3, 0.5));
+    EXPECT_EQ(num_allocations_close, num_allocations_far);
+}
+
+TEST_F(TrajectoryPlannerTest, test_creating_trajectory_planner_does_not_allocate)
+{
+    // The sub destination table is shared by all planners instead of being built by
+    // each of them
+    AllocationCounter allocation_counter;
+    TrajectoryPlanner planner;
+    EXPECT_EQ(allocation_counter.getNumAllocations(), 0);
+}
+
+TEST_F(TrajectoryPlannerTest, test_thread_local_planner_is_reused_within_a_thread)
+{
+    TrajectoryPlanner* planner = &TrajectoryPlanner::getThreadLocalPlanner();
+    EXPECT_EQ(&TrajectoryPlanner::getThreadLocalPlanner(), planner);
+
+    TrajectoryPlanner* other_thread_planner = nullptr;
+    std::thread other_thread(
+        [&]() { other_thread_planner = &TrajectoryPlanner::getThreadLocalPlanner(); });
+    other_thread.join();
+    EXPECT_NE(other_thread_planner, planner);
+}
+
+TEST_F(TrajectoryPlannerTest, DISABLED_findTrajectory_speed_test)
+{
+    const int num_queries = 200;
+
+    std::uniform_real_distribution x_distribution(-world->field().xLength() / 2,
+                                                  world->field().xLength() / 2);
+    std::uniform_real_distribution y_distribution(-world->field().yLength() / 2,
+                                                  world->field().yLength() / 2);
+    std::mt19937 random_num_gen;
+
+    std::vector<ObstaclePtr> obstacles = createCrowdedFieldObstacles(random_num_gen);
+
+    std::vector<std::pair<Point, Point>> queries;
+    for (int i = 0; i < num_queries; i++)
+    {
+        queries.emplace_back(
+            Point(x_distribution(random_num_gen), y_distribution(random_num_gen)),
+            Point(x_distribution(random_num_gen), y_distribution(random_num_gen)));
+    }
+
+    auto start_time = std::chrono::system_clock::now();
+    for (const auto& [start_pos, destination] : queries)
+    {
+        traj_planner.findTrajectory(start_pos, destination, Vector(), constraints,
+                                    obstacles, world->field().fieldBoundary());
+    }
+
+    double duration_ms = ::TestUtil::millisecondsSince(start_time);
+    double avg_ms      = duration_ms / static_cast<double>(num_queries);
+
+    std::cout << "Took " << duration_ms << "ms to run, average time of " << avg_ms << "ms"
+              << std::endl;
+}
+
+TEST_F(TrajectoryPlannerTest, DISABLED_findWarmStartedTrajectory_speed_test)
+{
+    const int num_queries      = 20;
+    const int num_ticks        = 30;
+    const double tick_period_s = 1.0 / 60.0;
+
+    std::uniform_real_distribution x_distribution(-world->field().xLength() / 2,
+                                                  world->field().xLength() / 2);
+    std::uniform_real_distribution y_distribution(-world->field().yLength() / 2,
+                                                  world->field().yLength() / 2);
+    std::mt19937 random_num_gen;
+
+    std::vector<ObstaclePtr> obstacles = createCrowdedFieldObstacles(random_num_gen);
+
+    // Plan the same queries over several ticks, with the robot following the
+    // trajectory path planned on the previous tick
+    std::vector<TrajectoryPath> traj_paths;
+    std::vector<Point> destinations;
+    for (int i = 0; i < num_queries; i++)
+    {
+        destinations.emplace_back(x_distribution(random_num_gen),
+                                  y_distribution(random_num_gen));
+        traj_paths.push_back(
+            traj_planner
+                .findTrajectory(
+                    Point(x_distribution(random_num_gen), y_distribution(random_num_gen)),
+                    destinations.back(), Vector(), constraints, obstacles,
+                    world->field().fieldBoundary())
+                .value());
+    }
+
+    unsigned int num_hits   = TrajectoryPlanner::getNumWarmStartHits();
+    unsigned int num_misses = TrajectoryPlanner::getNumWarmStartMisses();
+    double cold_duration_ms = 0.0;
+    double warm_duration_ms = 0.0;
+    for (int tick = 0; tick < num_ticks; tick++)
+    {
+        for (int i = 0; i < num_queries; i++)
+        {
+            const TrajectoryPath& prev_traj_path = traj_paths[i];
+            Point start_pos  = prev_traj_path.getPosition(tick_period_s);
+            Vector start_vel = prev_traj_path.getVelocity(tick_period_s);
+
+            auto start_time = std::chrono::system_clock::now();
+            traj_planner.findTrajectory(start_pos, destinations[i], start_vel,
+                                        constraints, obstacles,
+                                        world->field().fieldBoundary());
+            cold_duration_ms += ::TestUtil::millisecondsSince(start_time);
+
+            start_time     = std::chrono::system_clock::now();
+            auto traj_path = traj_planner.findWarmStartedTrajectory(
+                start_pos, destinations[i], start_vel, constraints, obstacles,
+                world->field().fieldBoundary(), prev_traj_path, tick_period_s);
+            warm_duration_ms += ::TestUtil::millisecondsSince(start_time);
+
+            traj_paths[i] = traj_path.value();
+        }
+    }
+
+    std::cout << "Took " << cold_duration_ms << "ms to run from scratch and "
+              << warm_duration_ms << "ms to run warm started, with "
+              << TrajectoryPlanner::getNumWarmStartHits() - num_hits << " hits and "
+              << TrajectoryPlanner::getNumWarmStartMisses() - num_misses << " misses"
+              << std::endl;
+}
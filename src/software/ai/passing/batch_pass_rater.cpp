@@ -0,0 +1,858 @@
+#include "software/ai/passing/batch_pass_rater.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "shared/constants.h"
+#include "software/ai/evaluation/evaluation_context.h"
+#include "software/ai/passing/cost_function.h"
+#include "software/geom/angular_sweep.h"
+#include "software/geom/geom_constants.h"
+
+namespace
+{
+    // The width of the sigmoids used by getStaticPositionQuality
+    constexpr double STATIC_POSITION_SIGMOID_WIDTH = 0.1;
+    // The width of the sigmoid used by ratePassFriendlyCapability
+    constexpr double FRIENDLY_CAPABILITY_SIGMOID_WIDTH = 0.4;
+    constexpr double ENEMY_ROBOT_INTERCEPTION_SPEED_METERS_PER_SECOND = 0.5;
+
+    /**
+     * Same as sigmoid in math_functions.h, but generic over the scalar type so that it
+     * can also be run on dual numbers and Eigen arrays
+     */
+    template <typename Scalar, typename Offset>
+    inline Scalar inlineSigmoid(const Scalar& v, const Offset& offset, double sig_width)
+    {
+        using std::exp;
+        return 1 / (1 + exp((8 / sig_width) * (offset - v)));
+    }
+
+    inline double valueOf(double scalar)
+    {
+        return scalar;
+    }
+
+    inline double valueOf(const BatchPassRater::DualScalar& scalar)
+    {
+        return scalar.value();
+    }
+
+    template <typename Scalar>
+    inline Scalar length(const Scalar& x, const Scalar& y)
+    {
+        using std::sqrt;
+        return sqrt(x * x + y * y);
+    }
+
+    /**
+     * Same as getTimeToTravelDistance in time_to_travel.h, but generic over the scalar
+     * type so that it can also be run on dual numbers
+     */
+    template <typename Scalar>
+    inline Scalar getSecondsToTravelDistance(const Scalar& distance, double max_velocity,
+                                             double max_acceleration,
+                                             const Scalar& initial_velocity,
+                                             double final_velocity)
+    {
+        using std::abs;
+        using std::sqrt;
+
+        const Scalar d_total = std::max(Scalar(0.0), distance);
+        const double v_max   = std::max(0.0, max_velocity);
+        const Scalar v_i =
+            std::clamp(initial_velocity, Scalar(-max_velocity), Scalar(max_velocity));
+        const double v_f   = std::clamp(final_velocity, 0.0, max_velocity);
+        const double a_max = std::max(1e-6, max_acceleration);
+
+        // The final velocity can not be reached within the distance
+        const Scalar dist_required_to_reach_v_f =
+            abs(v_f * v_f - v_i * v_i) / (2 * a_max);
+        const double a_max_signed = v_f < v_i ? -a_max : a_max;
+        const Scalar t_no_v_f =
+            (-v_i + sqrt(v_i * v_i + 2 * a_max_signed * d_total)) / a_max_signed;
+
+        // Accelerating, then decelerating as late as possible
+        const Scalar t_accel_decel =
+            -(v_i + v_f - sqrt(2 * (2 * a_max * d_total + v_i * v_i + v_f * v_f))) /
+            a_max;
+        const Scalar v_max_reached = (a_max * t_accel_decel + v_f + v_i) / 2;
+
+        // Accelerating, cruising at max velocity, then decelerating
+        const Scalar t_accel    = (v_max - v_i) / a_max;
+        const double t_decel    = (v_f - v_max) / -a_max;
+        const Scalar d_accel    = t_accel * (v_i + v_max) / 2;
+        const double d_decel    = t_decel * (v_f + v_max) / 2;
+        const Scalar t_cruising = (d_total - d_accel - d_decel) / v_max;
+        const Scalar t_accel_cruise_decel = t_accel + t_cruising + t_decel;
+
+        return dist_required_to_reach_v_f > d_total
+                   ? t_no_v_f
+                   : (v_max_reached > v_max ? t_accel_cruise_decel : t_accel_decel);
+    }
+
+    /**
+     * Same as getSecondsToTravelDistance above, but for arrays of distances and initial
+     * velocities. The branches are replaced with selects so that Eigen can vectorize it.
+     */
+    template <typename Array>
+    inline Array getSecondsToTravelDistances(const Array& distance, double max_velocity,
+                                             double max_acceleration,
+                                             const Array& initial_velocity,
+                                             double final_velocity)
+    {
+        const Array d_total = distance.max(0.0);
+        const double v_max  = std::max(0.0, max_velocity);
+        const Array v_i     = initial_velocity.max(-max_velocity).min(max_velocity);
+        const double v_f    = std::clamp(final_velocity, 0.0, max_velocity);
+        const double a_max  = std::max(1e-6, max_acceleration);
+
+        // The final velocity can not be reached within the distance
+        const Array dist_required_to_reach_v_f =
+            (v_f * v_f - v_i * v_i).abs() / (2 * a_max);
+        const Array a_max_signed =
+            (v_i > v_f).select(-a_max, Array::Constant(v_i.size(), a_max));
+        const Array t_no_v_f =
+            (-v_i + (v_i * v_i + 2 * a_max_signed * d_total).sqrt()) / a_max_signed;
+
+        // Accelerating, then decelerating as late as possible
+        const Array t_accel_decel =
+            -(v_i + v_f - (2 * (2 * a_max * d_total + v_i * v_i + v_f * v_f)).sqrt()) /
+            a_max;
+        const Array v_max_reached = (a_max * t_accel_decel + v_f + v_i) / 2;
+
+        // Accelerating, cruising at max velocity, then decelerating
+        const Array t_accel              = (v_max - v_i) / a_max;
+        const double t_decel             = (v_f - v_max) / -a_max;
+        const Array d_accel              = t_accel * (v_i + v_max) / 2;
+        const double d_decel             = t_decel * (v_f + v_max) / 2;
+        const Array t_cruising           = (d_total - d_accel - d_decel) / v_max;
+        const Array t_accel_cruise_decel = t_accel + t_cruising + t_decel;
+
+        return (dist_required_to_reach_v_f > d_total)
+            .select(t_no_v_f,
+                    (v_max_reached > v_max).select(t_accel_cruise_decel, t_accel_decel));
+    }
+
+    /**
+     * Gets the component of (velocity_x, velocity_y) in the direction of
+     * (direction_x, direction_y), as velocity.dot(direction.normalize()) does
+     */
+    template <typename Scalar>
+    inline Scalar getVelocityInDirection(double velocity_x, double velocity_y,
+                                         const Scalar& direction_x,
+                                         const Scalar& direction_y)
+    {
+        const Scalar direction_length = length(direction_x, direction_y);
+        return direction_length < 2 * FIXED_EPSILON
+                   ? Scalar(0.0)
+                   : (velocity_x * direction_x + velocity_y * direction_y) /
+                         direction_length;
+    }
+
+    /**
+     * Gets the orientation of the vector from (origin_x, origin_y) to the target, as
+     * Vector::orientation does
+     */
+    BatchPassRater::DualScalar getOrientation(const BatchPassRater::DualScalar& origin_x,
+                                              const BatchPassRater::DualScalar& origin_y,
+                                              const Point& target)
+    {
+        return atan2(target.y() - origin_y, target.x() - origin_x);
+    }
+}  // namespace
+
+BatchPassRater::PassArrays::PassArrays(const std::vector<Pass>& passes)
+    : size(passes.size()),
+      passer_x(size),
+      passer_y(size),
+      receiver_x(size),
+      receiver_y(size),
+      speed(size),
+      length(size)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        const Point passer_point   = passes[i].passerPoint();
+        const Point receiver_point = passes[i].receiverPoint();
+        passer_x[i]                = passer_point.x();
+        passer_y[i]                = passer_point.y();
+        receiver_x[i]              = receiver_point.x();
+        receiver_y[i]              = receiver_point.y();
+        speed[i]                   = passes[i].speed();
+    }
+    length = ((receiver_x - passer_x).square() + (receiver_y - passer_y).square()).sqrt();
+}
+
+BatchPassRater::SigmoidRectangle::SigmoidRectangle(const Rectangle& rectangle)
+    : centre_x(rectangle.centre().x()),
+      centre_y(rectangle.centre().y()),
+      half_x_length(rectangle.xLength() / 2),
+      half_y_length(rectangle.yLength() / 2)
+{
+}
+
+BatchPassRater::BatchPassRater(const WorldPtr& world_ptr,
+                               const TbotsProto::PassingConfig& passing_config)
+    : world(world_ptr),
+      passing_config(passing_config),
+      static_position_quality_grid(world_ptr->field(), passing_config),
+      shot_openness_map(EvaluationContext::get(world_ptr)->getShotOpennessMap(
+          TeamType::ENEMY, passing_config.shot_openness_map_resolution_meters())),
+      reduced_size_field(Rectangle(
+          Point(-world_ptr->field().xLength() / 2 +
+                    passing_config.static_field_position_quality_x_offset(),
+                -world_ptr->field().yLength() / 2 +
+                    passing_config.static_field_position_quality_y_offset()),
+          Point(world_ptr->field().xLength() / 2 -
+                    passing_config.static_field_position_quality_x_offset(),
+                world_ptr->field().yLength() / 2 -
+                    passing_config.static_field_position_quality_y_offset()))),
+      enemy_defense_area(world_ptr->field().enemyDefenseArea()),
+      friendly_goal_center_x(world_ptr->field().friendlyGoalCenter().x()),
+      friendly_goal_center_y(world_ptr->field().friendlyGoalCenter().y()),
+      friendly_goal_weight(
+          passing_config.static_field_position_quality_friendly_goal_distance_weight()),
+      backwards_pass_distance_meters(passing_config.backwards_pass_distance_meters()),
+      receiver_ideal_min_distance_meters(
+          passing_config.receiver_ideal_min_distance_meters()),
+      receiver_ideal_max_distance_meters(
+          passing_config.receiver_ideal_max_distance_meters()),
+      pass_delay_sec(passing_config.pass_delay_sec()),
+      friendly_time_to_receive_slack_sec(
+          passing_config.friendly_time_to_receive_slack_sec()),
+      enemy_proximity_importance(passing_config.enemy_proximity_importance()),
+      enemy_interception_time_multiplier(
+          passing_config.enemy_interception_time_multiplier()),
+      enemy_interception_risk_importance(
+          passing_config.enemy_interception_risk_importance()),
+      max_receive_speed_m_per_s(passing_config.max_receive_speed_m_per_s()),
+      min_pass_speed_m_per_s(passing_config.min_pass_speed_m_per_s()),
+      max_pass_speed_m_per_s(passing_config.max_pass_speed_m_per_s())
+{
+    for (const Robot& enemy : world_ptr->enemyTeam().getAllRobots())
+    {
+        enemies.position_x.push_back(enemy.position().x());
+        enemies.position_y.push_back(enemy.position().y());
+        enemies.velocity_x.push_back(enemy.velocity().x());
+        enemies.velocity_y.push_back(enemy.velocity().y());
+    }
+
+    for (const Robot& robot : world_ptr->friendlyTeam().getAllRobots())
+    {
+        const RobotConstants_t& robot_constants = robot.robotConstants();
+        friendlies.position_x.push_back(robot.position().x());
+        friendlies.position_y.push_back(robot.position().y());
+        friendlies.velocity_x.push_back(robot.velocity().x());
+        friendlies.velocity_y.push_back(robot.velocity().y());
+        friendlies.orientation_rad.push_back(robot.orientation().toRadians());
+        friendlies.angular_velocity_rad_per_s.push_back(
+            robot.angularVelocity().toRadians());
+        friendlies.timestamp_sec.push_back(robot.timestamp().toSeconds());
+        friendlies.max_speed_m_per_s.push_back(robot_constants.robot_max_speed_m_per_s);
+        friendlies.max_acceleration_m_per_s_2.push_back(
+            robot_constants.robot_max_acceleration_m_per_s_2);
+        friendlies.max_angular_speed_rad_per_s.push_back(
+            robot_constants.robot_max_ang_speed_rad_per_s);
+        friendlies.max_angular_acceleration_rad_per_s_2.push_back(
+            robot_constants.robot_max_ang_acceleration_rad_per_s_2);
+    }
+}
+
+void BatchPassRater::ratePasses(const std::vector<Pass>& passes,
+                                std::vector<double>& ratings) const
+{
+    const PassArrays pass_arrays(passes);
+    std::vector<double> static_pass_quality(pass_arrays.size);
+    std::vector<double> receiver_not_too_close_rating(pass_arrays.size);
+    std::vector<double> friendly_pass_rating(pass_arrays.size);
+    std::vector<double> pass_forward_rating(pass_arrays.size);
+    std::vector<double> enemy_pass_rating(pass_arrays.size);
+    std::vector<double> shoot_pass_rating(pass_arrays.size);
+
+    getStaticPositionQuality(pass_arrays, static_pass_quality.data());
+    ratePassNotTooClose(pass_arrays, receiver_not_too_close_rating.data());
+    ratePassFriendlyCapability(pass_arrays, friendly_pass_rating.data());
+    ratePassForwardQuality(pass_arrays, pass_forward_rating.data());
+    ratePassEnemyRisk(pass_arrays, enemy_pass_rating.data());
+    ratePassShootScore(passes, shoot_pass_rating.data());
+
+    ratings.resize(pass_arrays.size);
+    for (size_t i = 0; i < pass_arrays.size; i++)
+    {
+        ratings[i] = static_pass_quality[i] * receiver_not_too_close_rating[i] *
+                     friendly_pass_rating[i] * enemy_pass_rating[i] *
+                     pass_forward_rating[i] * shoot_pass_rating[i];
+    }
+}
+
+void BatchPassRater::rateReceivingPositions(const std::vector<Pass>& passes,
+                                            std::vector<double>& ratings) const
+{
+    const PassArrays pass_arrays(passes);
+    std::vector<double> static_recv_quality(pass_arrays.size);
+    std::vector<double> receiver_up_field_rating(pass_arrays.size);
+    std::vector<double> receiver_not_too_far_rating(pass_arrays.size);
+    std::vector<double> receiver_not_too_close_rating(pass_arrays.size);
+    std::vector<double> enemy_risk_rating(pass_arrays.size);
+    std::vector<double> pass_shoot_rating(pass_arrays.size);
+
+    getStaticPositionQuality(pass_arrays, static_recv_quality.data());
+    ratePassForwardQuality(pass_arrays, receiver_up_field_rating.data());
+    ratePassNotTooFar(pass_arrays, receiver_not_too_far_rating.data());
+    ratePassNotTooClose(pass_arrays, receiver_not_too_close_rating.data());
+    ratePassEnemyRisk(pass_arrays, enemy_risk_rating.data());
+    ratePassShootScore(passes, pass_shoot_rating.data());
+
+    ratings.resize(pass_arrays.size);
+    for (size_t i = 0; i < pass_arrays.size; i++)
+    {
+        ratings[i] = static_recv_quality[i] * receiver_up_field_rating[i] *
+                     receiver_not_too_far_rating[i] * receiver_not_too_close_rating[i] *
+                     enemy_risk_rating[i] * pass_shoot_rating[i];
+    }
+}
+
+BatchPassRater::DualScalar BatchPassRater::ratePass(
+    const Point& passer_point,
+    const std::array<DualScalar, NUM_PARAMS_TO_OPTIMIZE>& receiver_point) const
+{
+    using std::sqrt;
+
+    const double passer_x        = passer_point.x();
+    const double passer_y        = passer_point.y();
+    const DualScalar& receiver_x = receiver_point[0];
+    const DualScalar& receiver_y = receiver_point[1];
+    const DualScalar pass_length = length(receiver_x - passer_x, receiver_y - passer_y);
+
+    // Same as Pass::getPassSpeed
+    const double sq_friction_trans_factor =
+        FRICTION_TRANSITION_FACTOR * FRICTION_TRANSITION_FACTOR;
+    const double pass_speed_calc_constant =
+        sq_friction_trans_factor -
+        ((BALL_ROLLING_FRICTION_DECELERATION_METERS_PER_SECOND_SQUARED *
+          sq_friction_trans_factor) /
+         BALL_SLIDING_FRICTION_DECELERATION_METERS_PER_SECOND_SQUARED) +
+        (BALL_ROLLING_FRICTION_DECELERATION_METERS_PER_SECOND_SQUARED /
+         BALL_SLIDING_FRICTION_DECELERATION_METERS_PER_SECOND_SQUARED);
+    const DualScalar squared_pass_speed =
+        (max_receive_speed_m_per_s * max_receive_speed_m_per_s -
+         2 * BALL_ROLLING_FRICTION_DECELERATION_METERS_PER_SECOND_SQUARED *
+             pass_length) /
+        pass_speed_calc_constant;
+    const DualScalar speed =
+        std::clamp(sqrt(squared_pass_speed), DualScalar(min_pass_speed_m_per_s),
+                   DualScalar(max_pass_speed_m_per_s));
+
+    // The robot that receives the pass is picked by value, so the gradient is that of
+    // the rating for the current closest robot
+    DualScalar friendly_pass_rating = 0.0;
+    const size_t num_robots         = friendlies.position_x.size();
+    if (num_robots > 0)
+    {
+        unsigned int best_receiver = 0;
+        double best_distance       = std::numeric_limits<double>::infinity();
+        for (unsigned int robot = 0; robot < num_robots; robot++)
+        {
+            const double distance =
+                ::length(friendlies.position_x[robot] - receiver_x.value(),
+                         friendlies.position_y[robot] - receiver_y.value());
+            if (distance < best_distance)
+            {
+                best_distance = distance;
+                best_receiver = robot;
+            }
+        }
+        friendly_pass_rating =
+            friendlyCapability(best_receiver, passer_x, passer_y, receiver_x,
+                               receiver_y, pass_length, speed);
+    }
+
+    DualScalar enemy_pass_rating = 1.0;
+    if (!enemies.position_x.empty())
+    {
+        DualScalar proximity_risk = 0.0;
+        DualScalar intercept_risk = 0.0;
+        for (size_t enemy = 0; enemy < enemies.position_x.size(); enemy++)
+        {
+            proximity_risk += enemyProximityRisk(enemy, receiver_x, receiver_y);
+            intercept_risk = std::max(
+                intercept_risk, enemyInterceptRisk(enemy, passer_x, passer_y, receiver_x,
+                                                   receiver_y, speed));
+        }
+        enemy_pass_rating =
+            1 - std::max(intercept_risk, inlineSigmoid(proximity_risk, 1, 2));
+    }
+
+    return staticPositionQuality(receiver_x, receiver_y) *
+           notTooCloseQuality(pass_length) * friendly_pass_rating * enemy_pass_rating *
+           forwardQuality(passer_x, receiver_x) * shootScore(receiver_x, receiver_y);
+}
+
+void BatchPassRater::getStaticPositionQuality(const PassArrays& passes,
+                                              double* out) const
+{
+    for (size_t i = 0; i < passes.size; i++)
+    {
+        out[i] = staticPositionQuality(passes.receiver_x[i], passes.receiver_y[i]);
+    }
+}
+
+void BatchPassRater::ratePassNotTooClose(const PassArrays& passes, double* out) const
+{
+    Eigen::Map<Eigen::ArrayXd>(out, passes.size) = notTooCloseQuality(passes.length);
+}
+
+void BatchPassRater::ratePassNotTooFar(const PassArrays& passes, double* out) const
+{
+    Eigen::Map<Eigen::ArrayXd>(out, passes.size) = notTooFarQuality(passes.length);
+}
+
+void BatchPassRater::ratePassForwardQuality(const PassArrays& passes, double* out) const
+{
+    // Same as forwardQuality, with the offset of the sigmoid differing between passes
+    Eigen::Map<Eigen::ArrayXd>(out, passes.size) = inlineSigmoid(
+        passes.receiver_x, passes.passer_x.min(0.0) + backwards_pass_distance_meters,
+        4.0);
+}
+
+void BatchPassRater::ratePassFriendlyCapability(const PassArrays& passes,
+                                                double* out) const
+{
+    // We need at least one robot to pass to
+    const size_t num_robots = friendlies.position_x.size();
+    if (num_robots == 0)
+    {
+        std::fill(out, out + passes.size, 0.0);
+        return;
+    }
+
+    // Find the robot that is closest to where each pass would be received. Ties go to
+    // the first robot, as in the scalar cost function.
+    const Eigen::Index num_passes = passes.receiver_x.size();
+    for (Eigen::Index start = 0; start < num_passes; start += PASS_BLOCK_SIZE)
+    {
+        const Eigen::Index count   = std::min(PASS_BLOCK_SIZE, num_passes - start);
+        const PassBlock receiver_x = passes.receiver_x.segment(start, count);
+        const PassBlock receiver_y = passes.receiver_y.segment(start, count);
+
+        // The robot indices are stored as doubles so that the selects vectorize
+        PassBlock best_receivers = PassBlock::Zero(count);
+        PassBlock best_distances =
+            PassBlock::Constant(count, std::numeric_limits<double>::infinity());
+        for (unsigned int robot = 0; robot < num_robots; robot++)
+        {
+            const PassBlock distances =
+                ((friendlies.position_x[robot] - receiver_x).square() +
+                 (friendlies.position_y[robot] - receiver_y).square())
+                    .sqrt();
+            best_receivers = (distances < best_distances)
+                                 .select(static_cast<double>(robot), best_receivers);
+            best_distances = best_distances.min(distances);
+        }
+
+        // Same as friendlyCapability, with the sigmoids taken over the whole block
+        PassBlock receive_time_margins(count);
+        for (Eigen::Index i = 0; i < count; i++)
+        {
+            receive_time_margins[i] = friendlyReceiveTimeMargin(
+                static_cast<unsigned int>(best_receivers[i]),
+                passes.passer_x[start + i], passes.passer_y[start + i], receiver_x[i],
+                receiver_y[i], passes.length[start + i], passes.speed[start + i]);
+        }
+        Eigen::Map<Eigen::ArrayXd>(out + start, count) =
+            (passes.speed.segment(start, count) == 0.0)
+                .select(0.0, inlineSigmoid(receive_time_margins,
+                                           friendly_time_to_receive_slack_sec,
+                                           FRIENDLY_CAPABILITY_SIGMOID_WIDTH));
+    }
+}
+
+void BatchPassRater::ratePassEnemyRisk(const PassArrays& passes, double* out) const
+{
+    const size_t num_enemies = enemies.position_x.size();
+    if (num_enemies == 0)
+    {
+        std::fill(out, out + passes.size, 1.0);
+        return;
+    }
+
+    const Eigen::Index num_passes = passes.receiver_x.size();
+    for (Eigen::Index start = 0; start < num_passes; start += PASS_BLOCK_SIZE)
+    {
+        const Eigen::Index count   = std::min(PASS_BLOCK_SIZE, num_passes - start);
+        const PassBlock passer_x   = passes.passer_x.segment(start, count);
+        const PassBlock passer_y   = passes.passer_y.segment(start, count);
+        const PassBlock receiver_x = passes.receiver_x.segment(start, count);
+        const PassBlock receiver_y = passes.receiver_y.segment(start, count);
+        const PassBlock speed      = passes.speed.segment(start, count);
+
+        PassBlock proximity_risks = PassBlock::Zero(count);
+        PassBlock intercept_risks = PassBlock::Zero(count);
+        for (size_t enemy = 0; enemy < num_enemies; enemy++)
+        {
+            proximity_risks += enemyProximityRisks(enemy, receiver_x, receiver_y);
+            intercept_risks = intercept_risks.max(enemyInterceptRisks(
+                enemy, passer_x, passer_y, receiver_x, receiver_y, speed));
+        }
+
+        // We want to rate a pass more highly if it is lower risk, so subtract from 1
+        Eigen::Map<Eigen::ArrayXd>(out + start, count) =
+            1 - intercept_risks.max(inlineSigmoid(proximity_risks, 1, 2));
+    }
+}
+
+void BatchPassRater::ratePassShootScore(const std::vector<Pass>& passes,
+                                        double* out) const
+{
+    // Look up the open angle from the shot openness map, and only fall back to the
+    // angular sweep over the enemy robots for points off the field
+    const double min_pass_shoot_score = passing_config.min_pass_shoot_score();
+    for (size_t i = 0; i < passes.size(); i++)
+    {
+        const Point& receiver_point = passes[i].receiverPoint();
+        if (!shot_openness_map->contains(receiver_point.x(), receiver_point.y()))
+        {
+            out[i] = ::ratePassShootScore(world->field(), world->enemyTeam(), passes[i],
+                                          passing_config);
+            continue;
+        }
+
+        const double shot_score = rateOpenAngleToGoal(
+            shot_openness_map->getOpenAngleDegrees(receiver_point.x(),
+                                                   receiver_point.y()),
+            passing_config);
+        out[i] = normalizeValueToRange(shot_score, 0.0, 1.0, min_pass_shoot_score, 1.0);
+    }
+}
+
+template <typename Scalar>
+Scalar BatchPassRater::staticPositionQuality(const Scalar& receiver_x,
+                                             const Scalar& receiver_y) const
+{
+    using std::exp;
+    using std::pow;
+
+    // Interpolate the quality from the grid where it covers the point, and only
+    // calculate it outside of the field boundary
+    if (static_position_quality_grid.contains(valueOf(receiver_x), valueOf(receiver_y)))
+    {
+        return static_position_quality_grid.interpolate(receiver_x, receiver_y);
+    }
+
+    const double sig_width        = STATIC_POSITION_SIGMOID_WIDTH;
+    const SigmoidRectangle& field = reduced_size_field;
+    const SigmoidRectangle& area  = enemy_defense_area;
+    const Scalar& x               = receiver_x;
+    const Scalar& y               = receiver_y;
+
+    const Scalar on_field_quality =
+        std::min(inlineSigmoid(x, field.centre_x + field.half_x_length, -sig_width),
+                 inlineSigmoid(x, field.centre_x - field.half_x_length, sig_width)) *
+        std::min(inlineSigmoid(y, field.centre_y + field.half_y_length, -sig_width),
+                 inlineSigmoid(y, field.centre_y - field.half_y_length, sig_width));
+
+    const Scalar distance_to_friendly_goal =
+        length(friendly_goal_center_x - x, friendly_goal_center_y - y);
+    const Scalar near_friendly_goal_quality =
+        1 - exp(-friendly_goal_weight * pow(5.0, -2 + distance_to_friendly_goal));
+
+    const Scalar in_enemy_defense_area_quality =
+        1 - std::min(inlineSigmoid(x, area.centre_x + area.half_x_length, -sig_width),
+                     inlineSigmoid(x, area.centre_x - area.half_x_length, sig_width)) *
+                std::min(inlineSigmoid(y, area.centre_y + area.half_y_length, -sig_width),
+                         inlineSigmoid(y, area.centre_y - area.half_y_length, sig_width));
+
+    return on_field_quality * near_friendly_goal_quality * in_enemy_defense_area_quality;
+}
+
+template <typename Scalar>
+Scalar BatchPassRater::notTooCloseQuality(const Scalar& pass_length) const
+{
+    return 1 - inlineSigmoid(pass_length, receiver_ideal_min_distance_meters, -2.0);
+}
+
+template <typename Scalar>
+Scalar BatchPassRater::notTooFarQuality(const Scalar& pass_length) const
+{
+    return inlineSigmoid(pass_length, receiver_ideal_max_distance_meters, -2.0);
+}
+
+template <typename Scalar>
+Scalar BatchPassRater::forwardQuality(double passer_x, const Scalar& receiver_x) const
+{
+    return inlineSigmoid(receiver_x,
+                         std::min(0.0, passer_x) + backwards_pass_distance_meters, 4.0);
+}
+
+template <typename Scalar>
+Scalar BatchPassRater::friendlyCapability(unsigned int robot, double passer_x,
+                                          double passer_y, const Scalar& receiver_x,
+                                          const Scalar& receiver_y,
+                                          const Scalar& pass_length,
+                                          const Scalar& speed) const
+{
+    // Special case where pass speed is 0
+    return speed == 0 ? Scalar(0.0)
+                      : inlineSigmoid(friendlyReceiveTimeMargin(robot, passer_x, passer_y,
+                                                                receiver_x, receiver_y,
+                                                                pass_length, speed),
+                                      friendly_time_to_receive_slack_sec,
+                                      FRIENDLY_CAPABILITY_SIGMOID_WIDTH);
+}
+
+template <typename Scalar>
+Scalar BatchPassRater::friendlyReceiveTimeMargin(unsigned int robot, double passer_x,
+                                                 double passer_y,
+                                                 const Scalar& receiver_x,
+                                                 const Scalar& receiver_y,
+                                                 const Scalar& pass_length,
+                                                 const Scalar& speed) const
+{
+    const double robot_x   = friendlies.position_x[robot];
+    const double robot_y   = friendlies.position_y[robot];
+    const double timestamp = friendlies.timestamp_sec[robot];
+
+    // Figure out what time the robot would have to receive the ball at
+    const Scalar receive_time = timestamp + (pass_length / speed + pass_delay_sec);
+
+    // Figure out how long it would take our robot to get there
+    const Scalar to_receiver_x         = receiver_x - robot_x;
+    const Scalar to_receiver_y         = receiver_y - robot_y;
+    const Scalar min_robot_travel_time = getSecondsToTravelDistance(
+        length(to_receiver_x, to_receiver_y), friendlies.max_speed_m_per_s[robot],
+        friendlies.max_acceleration_m_per_s_2[robot],
+        getVelocityInDirection(friendlies.velocity_x[robot], friendlies.velocity_y[robot],
+                               to_receiver_x, to_receiver_y),
+        0.0);
+
+    // Figure out what angle the robot would have to be at to receive the ball
+    const Angle receive_angle =
+        Angle::fromRadians(std::atan2(passer_y - robot_y, passer_x - robot_x));
+    const double time_to_receive_angle = getSecondsToTravelDistance(
+        Angle::fromRadians(friendlies.orientation_rad[robot])
+            .minDiff(receive_angle)
+            .toRadians(),
+        friendlies.max_angular_speed_rad_per_s[robot],
+        friendlies.max_angular_acceleration_rad_per_s_2[robot],
+        friendlies.angular_velocity_rad_per_s[robot], 0.0);
+
+    const Scalar latest_time_to_receiver_state =
+        timestamp + std::max(Scalar(time_to_receive_angle), min_robot_travel_time);
+
+    return receive_time - latest_time_to_receiver_state;
+}
+
+template <typename Scalar>
+Scalar BatchPassRater::enemyProximityRisk(size_t enemy, const Scalar& receiver_x,
+                                          const Scalar& receiver_y) const
+{
+    using std::exp;
+
+    // Risk based on how close the enemy is to the receiver point
+    const Scalar dist_to_enemy =
+        std::max(Scalar(0.0), length(receiver_x - enemies.position_x[enemy],
+                                     receiver_y - enemies.position_y[enemy]) -
+                                  ROBOT_MAX_RADIUS_METERS);
+    return exp((-dist_to_enemy * dist_to_enemy) / enemy_proximity_importance);
+}
+
+template <typename Scalar>
+Scalar BatchPassRater::enemyInterceptRisk(size_t enemy, double passer_x,
+                                          double passer_y, const Scalar& receiver_x,
+                                          const Scalar& receiver_y,
+                                          const Scalar& speed) const
+{
+    const double enemy_x = enemies.position_x[enemy];
+    const double enemy_y = enemies.position_y[enemy];
+
+    // Risk that the enemy gets to the closest point on the pass before the ball
+    const Scalar pass_x              = receiver_x - passer_x;
+    const Scalar pass_y              = receiver_y - passer_y;
+    const Scalar pass_length_squared = pass_x * pass_x + pass_y * pass_y;
+    const Scalar projection =
+        pass_length_squared < FIXED_EPSILON * FIXED_EPSILON
+            ? Scalar(0.0)
+            : std::clamp(
+                  ((enemy_x - passer_x) * pass_x + (enemy_y - passer_y) * pass_y) /
+                      pass_length_squared,
+                  Scalar(0.0), Scalar(1.0));
+    const Scalar interception_x    = passer_x + projection * pass_x;
+    const Scalar interception_y    = passer_y + projection * pass_y;
+    const Scalar to_interception_x = interception_x - enemy_x;
+    const Scalar to_interception_y = interception_y - enemy_y;
+    const Scalar min_interception_distance =
+        std::max(Scalar(0.0),
+                 length(to_interception_x, to_interception_y) - ROBOT_MAX_RADIUS_METERS);
+
+    const Scalar enemy_time_to_interception_point =
+        getSecondsToTravelDistance(
+            min_interception_distance, ENEMY_ROBOT_MAX_SPEED_METERS_PER_SECOND,
+            ENEMY_ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED,
+            getVelocityInDirection(enemies.velocity_x[enemy], enemies.velocity_y[enemy],
+                                   to_interception_x, to_interception_y),
+            ENEMY_ROBOT_INTERCEPTION_SPEED_METERS_PER_SECOND) *
+        enemy_interception_time_multiplier;
+    const Scalar ball_time_to_interception_point =
+        length(interception_x - passer_x, interception_y - passer_y) / speed +
+        pass_delay_sec;
+
+    // Return early to avoid division by zero
+    return speed == 0 ? Scalar(1.0)
+                      : std::clamp((ball_time_to_interception_point -
+                                    enemy_time_to_interception_point) *
+                                       enemy_interception_risk_importance,
+                                   Scalar(0.0), Scalar(1.0));
+}
+
+BatchPassRater::PassBlock BatchPassRater::enemyProximityRisks(
+    size_t enemy, const PassBlock& receiver_x, const PassBlock& receiver_y) const
+{
+    const PassBlock dist_to_enemy =
+        (((receiver_x - enemies.position_x[enemy]).square() +
+          (receiver_y - enemies.position_y[enemy]).square())
+             .sqrt() -
+         ROBOT_MAX_RADIUS_METERS)
+            .max(0.0);
+    return ((-dist_to_enemy * dist_to_enemy) / enemy_proximity_importance).exp();
+}
+
+BatchPassRater::PassBlock BatchPassRater::enemyInterceptRisks(
+    size_t enemy, const PassBlock& passer_x, const PassBlock& passer_y,
+    const PassBlock& receiver_x, const PassBlock& receiver_y,
+    const PassBlock& speed) const
+{
+    const double enemy_x = enemies.position_x[enemy];
+    const double enemy_y = enemies.position_y[enemy];
+
+    const PassBlock pass_x              = receiver_x - passer_x;
+    const PassBlock pass_y              = receiver_y - passer_y;
+    const PassBlock pass_length_squared = pass_x * pass_x + pass_y * pass_y;
+    const PassBlock projection =
+        (pass_length_squared < FIXED_EPSILON * FIXED_EPSILON)
+            .select(0.0,
+                    (((enemy_x - passer_x) * pass_x + (enemy_y - passer_y) * pass_y) /
+                     pass_length_squared)
+                        .max(0.0)
+                        .min(1.0));
+    const PassBlock to_interception_x = passer_x + projection * pass_x - enemy_x;
+    const PassBlock to_interception_y = passer_y + projection * pass_y - enemy_y;
+    const PassBlock to_interception_length =
+        (to_interception_x * to_interception_x + to_interception_y * to_interception_y)
+            .sqrt();
+    const PassBlock enemy_velocity_to_interception =
+        (to_interception_length < 2 * FIXED_EPSILON)
+            .select(0.0, (enemies.velocity_x[enemy] * to_interception_x +
+                          enemies.velocity_y[enemy] * to_interception_y) /
+                             to_interception_length);
+
+    const PassBlock min_interception_distance =
+        (to_interception_length - ROBOT_MAX_RADIUS_METERS).max(0.0);
+    const PassBlock enemy_time_to_interception_point =
+        getSecondsToTravelDistances(
+            min_interception_distance, ENEMY_ROBOT_MAX_SPEED_METERS_PER_SECOND,
+            ENEMY_ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED,
+            enemy_velocity_to_interception,
+            ENEMY_ROBOT_INTERCEPTION_SPEED_METERS_PER_SECOND) *
+        enemy_interception_time_multiplier;
+    // The interception point is along the pass, so its distance from the passer is
+    // the projection times the length of the pass
+    const PassBlock ball_time_to_interception_point =
+        projection * pass_length_squared.sqrt() / speed + pass_delay_sec;
+
+    // Same as enemyInterceptRisk, including the risk of 1 for passes with no speed
+    return (speed == 0.0)
+        .select(1.0, ((ball_time_to_interception_point -
+                       enemy_time_to_interception_point) *
+                      enemy_interception_risk_importance)
+                         .max(0.0)
+                         .min(1.0));
+}
+
+BatchPassRater::DualScalar BatchPassRater::shootScore(const DualScalar& receiver_x,
+                                                      const DualScalar& receiver_y) const
+{
+    // Off the field, the open angle is found the same way as calcBestShotOnGoal finds
+    // it. Each edge of the biggest open angle is either a goalpost or an edge of an
+    // enemy robot, so once we know which ones, only those edges need to be
+    // differentiated.
+    const Point shot_origin(receiver_x.value(), receiver_y.value());
+    const Point pos_post = world->field().enemyGoalpostPos();
+    const Point neg_post = world->field().enemyGoalpostNeg();
+
+    DualScalar open_angle_to_goal_deg = 0.0;
+    if (shot_openness_map->contains(shot_origin.x(), shot_origin.y()))
+    {
+        open_angle_to_goal_deg =
+            shot_openness_map->getOpenAngleDegrees(receiver_x, receiver_y);
+    }
+    else if (shot_origin.x() <= pos_post.x())
+    {
+        const std::vector<Robot>& enemy_robots = world->enemyTeam().getAllRobots();
+        AngularSweep& sweep = AngularSweep::getThreadLocalSweep();
+        sweep.reset((pos_post - shot_origin).orientation().toRadians(),
+                    (neg_post - shot_origin).orientation().toRadians());
+        for (const Robot& enemy_robot : enemy_robots)
+        {
+            double top_angle    = 0.0;
+            double bottom_angle = 0.0;
+            AngularSweep::calculateObstacleEdges(
+                shot_origin.x(), shot_origin.y(), enemy_robot.position().x(),
+                enemy_robot.position().y(), ROBOT_MAX_RADIUS_METERS, top_angle,
+                bottom_angle);
+            sweep.addBlockedInterval(top_angle, bottom_angle);
+        }
+
+        // Differentiates the orientation of an edge of the biggest open angle, which is
+        // either the given goalpost, or an edge of the enemy robot with the given index
+        auto get_edge_orientation = [&](const std::optional<size_t>& robot_index,
+                                        const Point& goalpost, double side) {
+            if (!robot_index)
+            {
+                return getOrientation(receiver_x, receiver_y, goalpost);
+            }
+
+            // Same as (enemy_robot_pos - shot_origin).perpendicular().normalize()
+            const Point enemy_robot_pos      = enemy_robots[*robot_index].position();
+            const DualScalar to_enemy_x      = enemy_robot_pos.x() - receiver_x;
+            const DualScalar to_enemy_y      = enemy_robot_pos.y() - receiver_y;
+            const DualScalar to_enemy_length = length(to_enemy_x, to_enemy_y);
+            if (to_enemy_length < 2 * FIXED_EPSILON)
+            {
+                return getOrientation(receiver_x, receiver_y, enemy_robot_pos);
+            }
+            const DualScalar end_x =
+                to_enemy_x -
+                side * ROBOT_MAX_RADIUS_METERS * to_enemy_y / to_enemy_length;
+            const DualScalar end_y =
+                to_enemy_y +
+                side * ROBOT_MAX_RADIUS_METERS * to_enemy_x / to_enemy_length;
+            return atan2(end_y, end_x);
+        };
+
+        const OpenAngularInterval biggest_interval = sweep.getBiggestOpenInterval();
+        if (biggest_interval.size() != 0)
+        {
+            // The top of the open angle is the bottom edge of a robot, and the bottom of
+            // the open angle is the top edge of a robot
+            const DualScalar delta_rad =
+                abs(get_edge_orientation(biggest_interval.bottom_edge_index, neg_post,
+                                         1.0) -
+                    get_edge_orientation(biggest_interval.top_edge_index, pos_post,
+                                         -1.0));
+            open_angle_to_goal_deg =
+                DualScalar(biggest_interval.size() * (180.0 / M_PI),
+                           (delta_rad * (180.0 / M_PI)).gradient());
+        }
+    }
+
+    // Same as rateShot and ratePassShootScore
+    const double min_ideal_angle =
+        passing_config.min_ideal_pass_shoot_goal_open_angle_deg();
+    const DualScalar shot_score =
+        std::clamp(open_angle_to_goal_deg, DualScalar(0.0), DualScalar(min_ideal_angle)) /
+        min_ideal_angle;
+    const double min_pass_shoot_score = passing_config.min_pass_shoot_score();
+    return (1.0 - min_pass_shoot_score) * (shot_score - 1.0) + 1.0;
+}
@@ -0,0 +1,236 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "proto/parameters.pb.h"
+#include "software/ai/evaluation/shot_openness_map.h"
+#include "software/ai/passing/pass.h"
+#include "software/ai/passing/static_position_quality_grid.h"
+#include "software/optimization/dual_number.hpp"
+#include "software/world/world.h"
+
+/**
+ * Rates many passes against the same world in one call.
+ *
+ * When the rater is built, the robots of both teams are packed into a structure of
+ * arrays, and the parts of the passing config and field that the cost functions need
+ * are read out once. Each cost term is then computed for all passes, with the robots in
+ * the outer loop, so that each robot is loaded once per cost term (or block of passes)
+ * rather than once per pass. The terms that call exp and sqrt on every pass (the
+ * sigmoids, the enemy risk and the search for the closest friendly robot) are written
+ * as Eigen array expressions, which Eigen evaluates with SIMD instructions. The
+ * compiler does not vectorize plain loops over those calls.
+ *
+ * The ratings match those of ratePass and rateReceivingPosition up to floating point
+ * rounding, except for the static position quality and the shoot score, which are
+ * interpolated. The static position quality is interpolated from a
+ * StaticPositionQualityGrid that the rater builds for the field. Instead of sweeping
+ * over the enemy robots for every pass, the open angle to the enemy goal is
+ * interpolated from the world's ShotOpennessMap, which is built once per world and
+ * shared by every rater for it.
+ *
+ * The rater can also rate a single pass on dual numbers, which gives the gradient of
+ * the rating with respect to the receiver point for gradient descent.
+ */
+class BatchPassRater
+{
+   public:
+    using DualScalar = DualNumber<NUM_PARAMS_TO_OPTIMIZE>;
+
+    BatchPassRater() = delete;
+
+    /**
+     * Creates a rater for passes in the given world
+     *
+     * @param world_ptr The world in which to rate passes
+     * @param passing_config The passing config used for tuning
+     */
+    explicit BatchPassRater(const WorldPtr& world_ptr,
+                            const TbotsProto::PassingConfig& passing_config);
+
+    /**
+     * Calculates the quality of each of the given passes, as ratePass does
+     *
+     * @param passes The passes to rate
+     * @param ratings Is resized to hold the rating of each pass, with the rating of
+     * passes[i] written to ratings[i]
+     */
+    void ratePasses(const std::vector<Pass>& passes, std::vector<double>& ratings) const;
+
+    /**
+     * Rates each of the given passes based on the quality of its receiving position, as
+     * rateReceivingPosition does
+     *
+     * @param passes The passes to rate
+     * @param ratings Is resized to hold the rating of each pass, with the rating of
+     * passes[i] written to ratings[i]
+     */
+    void rateReceivingPositions(const std::vector<Pass>& passes,
+                                std::vector<double>& ratings) const;
+
+    /**
+     * Calculates the quality of the pass that Pass::fromDestReceiveSpeed would create
+     * to the given receiver point, as ratePass does, along with the gradient of the
+     * rating with respect to the receiver point
+     *
+     * @param passer_point The point the pass is made from
+     * @param receiver_point The x and y coordinates of the receiver point, whose
+     * gradients are the ones carried through to the rating
+     *
+     * @return The rating of the pass, carrying its gradient
+     */
+    DualScalar ratePass(
+        const Point& passer_point,
+        const std::array<DualScalar, NUM_PARAMS_TO_OPTIMIZE>& receiver_point) const;
+
+   private:
+    // The array expressions are evaluated over blocks of this many passes at a time, so
+    // that their temporaries stay on the stack and in the L1 cache
+    static constexpr Eigen::Index PASS_BLOCK_SIZE = 64;
+    using PassBlock = Eigen::Array<double, Eigen::Dynamic, 1, Eigen::ColMajor,
+                                   PASS_BLOCK_SIZE, 1>;
+
+    // The passes being rated, unpacked into arrays
+    struct PassArrays
+    {
+        explicit PassArrays(const std::vector<Pass>& passes);
+
+        size_t size;
+        Eigen::ArrayXd passer_x;
+        Eigen::ArrayXd passer_y;
+        Eigen::ArrayXd receiver_x;
+        Eigen::ArrayXd receiver_y;
+        Eigen::ArrayXd speed;
+        Eigen::ArrayXd length;
+    };
+
+    struct EnemyArrays
+    {
+        std::vector<double> position_x;
+        std::vector<double> position_y;
+        std::vector<double> velocity_x;
+        std::vector<double> velocity_y;
+    };
+
+    struct FriendlyArrays
+    {
+        std::vector<double> position_x;
+        std::vector<double> position_y;
+        std::vector<double> velocity_x;
+        std::vector<double> velocity_y;
+        std::vector<double> orientation_rad;
+        std::vector<double> angular_velocity_rad_per_s;
+        std::vector<double> timestamp_sec;
+        std::vector<double> max_speed_m_per_s;
+        std::vector<double> max_acceleration_m_per_s_2;
+        std::vector<double> max_angular_speed_rad_per_s;
+        std::vector<double> max_angular_acceleration_rad_per_s_2;
+    };
+
+    // An axis-aligned rectangle used by rectangleSigmoid
+    struct SigmoidRectangle
+    {
+        explicit SigmoidRectangle(const Rectangle& rectangle);
+
+        double centre_x;
+        double centre_y;
+        double half_x_length;
+        double half_y_length;
+    };
+
+    /**
+     * Each of the functions below calculates one cost term for all passes, writing the
+     * term for passes[i] to out[i]. See the scalar cost function of the same name in
+     * cost_function.h for details.
+     */
+    void getStaticPositionQuality(const PassArrays& passes, double* out) const;
+    void ratePassNotTooClose(const PassArrays& passes, double* out) const;
+    void ratePassNotTooFar(const PassArrays& passes, double* out) const;
+    void ratePassForwardQuality(const PassArrays& passes, double* out) const;
+    void ratePassFriendlyCapability(const PassArrays& passes, double* out) const;
+    void ratePassEnemyRisk(const PassArrays& passes, double* out) const;
+    void ratePassShootScore(const std::vector<Pass>& passes, double* out) const;
+
+    /**
+     * Each of the functions below calculates one cost term, or part of one, for a
+     * single pass. They are generic over the scalar type so that the functions above
+     * can run them on doubles or Eigen arrays, and ratePass can run them on dual
+     * numbers.
+     */
+    template <typename Scalar>
+    Scalar staticPositionQuality(const Scalar& receiver_x,
+                                 const Scalar& receiver_y) const;
+    template <typename Scalar>
+    Scalar notTooCloseQuality(const Scalar& pass_length) const;
+    template <typename Scalar>
+    Scalar notTooFarQuality(const Scalar& pass_length) const;
+    template <typename Scalar>
+    Scalar forwardQuality(double passer_x, const Scalar& receiver_x) const;
+    template <typename Scalar>
+    Scalar friendlyCapability(unsigned int robot, double passer_x, double passer_y,
+                              const Scalar& receiver_x, const Scalar& receiver_y,
+                              const Scalar& pass_length, const Scalar& speed) const;
+    template <typename Scalar>
+    Scalar friendlyReceiveTimeMargin(unsigned int robot, double passer_x,
+                                     double passer_y, const Scalar& receiver_x,
+                                     const Scalar& receiver_y, const Scalar& pass_length,
+                                     const Scalar& speed) const;
+    template <typename Scalar>
+    Scalar enemyProximityRisk(size_t enemy, const Scalar& receiver_x,
+                              const Scalar& receiver_y) const;
+    template <typename Scalar>
+    Scalar enemyInterceptRisk(size_t enemy, double passer_x, double passer_y,
+                              const Scalar& receiver_x, const Scalar& receiver_y,
+                              const Scalar& speed) const;
+
+    /**
+     * Same as enemyProximityRisk and enemyInterceptRisk, but for a block of passes at
+     * once, as Eigen array expressions
+     */
+    PassBlock enemyProximityRisks(size_t enemy, const PassBlock& receiver_x,
+                                  const PassBlock& receiver_y) const;
+    PassBlock enemyInterceptRisks(size_t enemy, const PassBlock& passer_x,
+                                  const PassBlock& passer_y, const PassBlock& receiver_x,
+                                  const PassBlock& receiver_y,
+                                  const PassBlock& speed) const;
+
+    /**
+     * Calculates the shoot score term for the pass to the given receiver point, as
+     * ratePassShootScore does, along with its gradient
+     *
+     * @param receiver_x The x coordinate of the receiver point
+     * @param receiver_y The y coordinate of the receiver point
+     *
+     * @return The shoot score, carrying its gradient
+     */
+    DualScalar shootScore(const DualScalar& receiver_x,
+                          const DualScalar& receiver_y) const;
+
+    WorldPtr world;
+    TbotsProto::PassingConfig passing_config;
+    StaticPositionQualityGrid static_position_quality_grid;
+    std::shared_ptr<const ShotOpennessMap> shot_openness_map;
+
+    EnemyArrays enemies;
+    FriendlyArrays friendlies;
+
+    SigmoidRectangle reduced_size_field;
+    SigmoidRectangle enemy_defense_area;
+    double friendly_goal_center_x;
+    double friendly_goal_center_y;
+
+    double friendly_goal_weight;
+    double backwards_pass_distance_meters;
+    double receiver_ideal_min_distance_meters;
+    double receiver_ideal_max_distance_meters;
+    double pass_delay_sec;
+    double friendly_time_to_receive_slack_sec;
+    double enemy_proximity_importance;
+    double enemy_interception_time_multiplier;
+    double enemy_interception_risk_importance;
+    double max_receive_speed_m_per_s;
+    double min_pass_speed_m_per_s;
+    double max_pass_speed_m_per_s;
+};
@@ -0,0 +1,328 @@
+#include "software/ai/passing/batch_pass_rater.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+#include "proto/parameters.pb.h"
+#include "software/ai/evaluation/evaluation_context.h"
+#include "software/ai/passing/cost_function.h"
+#include "software/math/math_functions.h"
+#include "software/test_util/test_util.h"
+
+class BatchPassRaterTest : public testing::Test
+{
+   protected:
+    BatchPassRaterTest()
+        : world(::TestUtil::createBlankTestingWorld()), random_num_gen(42)
+    {
+    }
+
+    /**
+     * Creates a team of robots at random positions, moving in random directions
+     *
+     * @param num_robots The number of robots on the team
+     *
+     * @return The team
+     */
+    Team createRandomTeam(unsigned int num_robots)
+    {
+        std::uniform_real_distribution x_distribution(-world->field().xLength() / 2,
+                                                      world->field().xLength() / 2);
+        std::uniform_real_distribution y_distribution(-world->field().yLength() / 2,
+                                                      world->field().yLength() / 2);
+        std::uniform_real_distribution velocity_distribution(-2.0, 2.0);
+
+        std::vector<Robot> robots;
+        for (unsigned int id = 0; id < num_robots; id++)
+        {
+            const Point position(x_distribution(random_num_gen),
+                                 y_distribution(random_num_gen));
+            const Vector velocity(velocity_distribution(random_num_gen),
+                                  velocity_distribution(random_num_gen));
+            robots.emplace_back(
+                id, position, velocity,
+                Angle::fromRadians(velocity_distribution(random_num_gen)),
+                AngularVelocity::fromRadians(velocity_distribution(random_num_gen)),
+                Timestamp::fromSeconds(0));
+        }
+        return Team(robots, Duration::fromSeconds(10));
+    }
+
+    /**
+     * Creates passes between random points on the field, including passes with no
+     * speed and passes with no length
+     *
+     * @param num_passes The number of random passes to create
+     *
+     * @return The passes
+     */
+    std::vector<Pass> createRandomPasses(unsigned int num_passes)
+    {
+        std::uniform_real_distribution x_distribution(-world->field().xLength() / 2,
+                                                      world->field().xLength() / 2);
+        std::uniform_real_distribution y_distribution(-world->field().yLength() / 2,
+                                                      world->field().yLength() / 2);
+        std::uniform_real_distribution speed_distribution(
+            passing_config.min_pass_speed_m_per_s(),
+            passing_config.max_pass_speed_m_per_s());
+
+        std::vector<Pass> passes = {Pass(Point(1, 1), Point(2, 2), 0.0),
+                                    Pass(Point(1, 1), Point(1, 1), 3.0)};
+        for (unsigned int i = 0; i < num_passes; i++)
+        {
+            const Point passer_point(x_distribution(random_num_gen),
+                                     y_distribution(random_num_gen));
+            const Point receiver_point(x_distribution(random_num_gen),
+                                       y_distribution(random_num_gen));
+            passes.emplace_back(passer_point, receiver_point,
+                                speed_distribution(random_num_gen));
+        }
+        return passes;
+    }
+
+    /**
+     * Gets the shoot score of the given pass the way the batch rater calculates it,
+     * from the open angle in the shot openness map for the world
+     *
+     * @param pass The pass to rate
+     *
+     * @return The interpolated shoot score
+     */
+    double getInterpolatedShootScore(const Pass& pass)
+    {
+        const std::shared_ptr<const ShotOpennessMap> shot_openness_map =
+            EvaluationContext::get(world)->getShotOpennessMap(
+                TeamType::ENEMY, passing_config.shot_openness_map_resolution_meters());
+        const Point& receiver_point = pass.receiverPoint();
+        if (!shot_openness_map->contains(receiver_point.x(), receiver_point.y()))
+        {
+            return ratePassShootScore(world->field(), world->enemyTeam(), pass,
+                                      passing_config);
+        }
+        return normalizeValueToRange(
+            rateOpenAngleToGoal(shot_openness_map->getOpenAngleDegrees(
+                                    receiver_point.x(), receiver_point.y()),
+                                passing_config),
+            0.0, 1.0, passing_config.min_pass_shoot_score(), 1.0);
+    }
+
+    /**
+     * Gets the static position quality of the receiver point of the given pass the way
+     * the batch rater calculates it, from a grid for the field
+     *
+     * @param pass The pass to rate
+     *
+     * @return The interpolated static position quality
+     */
+    double getInterpolatedStaticPositionQuality(const Pass& pass)
+    {
+        const StaticPositionQualityGrid grid(world->field(), passing_config);
+        const Point& receiver_point = pass.receiverPoint();
+        if (!grid.contains(receiver_point.x(), receiver_point.y()))
+        {
+            return getStaticPositionQuality(world->field(), receiver_point,
+                                            passing_config);
+        }
+        return grid.interpolate(receiver_point.x(), receiver_point.y());
+    }
+
+    /**
+     * Checks that the batch ratings of the given passes match the scalar ratings, with
+     * the exact static position quality and shoot score of the scalar ratings swapped
+     * for the interpolated ones
+     *
+     * @param passes The passes to rate
+     */
+    void expectRatingsMatchScalarCostFunctions(const std::vector<Pass>& passes)
+    {
+        BatchPassRater rater(world, passing_config);
+        std::vector<double> pass_ratings;
+        std::vector<double> receiving_position_ratings;
+        rater.ratePasses(passes, pass_ratings);
+        rater.rateReceivingPositions(passes, receiving_position_ratings);
+
+        ASSERT_EQ(pass_ratings.size(), passes.size());
+        ASSERT_EQ(receiving_position_ratings.size(), passes.size());
+        for (size_t i = 0; i < passes.size(); i++)
+        {
+            // The static position quality and shoot score are factors of both ratings.
+            // The shoot score is never 0, and the static position quality is only 0
+            // well inside the enemy defense area, where both of the ratings are 0.
+            const double static_position_quality = getStaticPositionQuality(
+                world->field(), passes[i].receiverPoint(), passing_config);
+            const double static_position_quality_ratio =
+                static_position_quality > 0
+                    ? getInterpolatedStaticPositionQuality(passes[i]) /
+                          static_position_quality
+                    : 1.0;
+            const double interpolation_ratio =
+                static_position_quality_ratio * getInterpolatedShootScore(passes[i]) /
+                ratePassShootScore(world->field(), world->enemyTeam(), passes[i],
+                                   passing_config);
+            EXPECT_NEAR(pass_ratings[i],
+                        ratePass(*world, passes[i], passing_config) * interpolation_ratio,
+                        1e-9)
+                << passes[i];
+            EXPECT_NEAR(receiving_position_ratings[i],
+                        rateReceivingPosition(*world, passes[i], passing_config) *
+                            interpolation_ratio,
+                        1e-9)
+                << passes[i];
+        }
+    }
+
+    std::shared_ptr<World> world;
+    TbotsProto::PassingConfig passing_config;
+    std::mt19937 random_num_gen;
+};
+
+TEST_F(BatchPassRaterTest, rates_no_passes)
+{
+    BatchPassRater rater(world, passing_config);
+    std::vector<double> ratings = {1.0, 2.0};
+
+    rater.ratePasses({}, ratings);
+
+    EXPECT_TRUE(ratings.empty());
+}
+
+TEST_F(BatchPassRaterTest, matches_scalar_ratings_with_no_robots)
+{
+    expectRatingsMatchScalarCostFunctions(createRandomPasses(200));
+}
+
+TEST_F(BatchPassRaterTest, matches_scalar_ratings_with_no_enemies)
+{
+    world->updateFriendlyTeamState(createRandomTeam(6));
+
+    expectRatingsMatchScalarCostFunctions(createRandomPasses(200));
+}
+
+TEST_F(BatchPassRaterTest, matches_scalar_ratings_with_no_friendlies)
+{
+    world->updateEnemyTeamState(createRandomTeam(6));
+
+    expectRatingsMatchScalarCostFunctions(createRandomPasses(200));
+}
+
+TEST_F(BatchPassRaterTest, matches_scalar_ratings_with_both_teams)
+{
+    world->updateFriendlyTeamState(createRandomTeam(6));
+    world->updateEnemyTeamState(createRandomTeam(6));
+
+    expectRatingsMatchScalarCostFunctions(createRandomPasses(1000));
+}
+
+TEST_F(BatchPassRaterTest, matches_scalar_ratings_with_pass_delay)
+{
+    passing_config.set_pass_delay_sec(0.3);
+    world->updateFriendlyTeamState(createRandomTeam(6));
+    world->updateEnemyTeamState(createRandomTeam(6));
+
+    expectRatingsMatchScalarCostFunctions(createRandomPasses(200));
+}
+
+TEST_F(BatchPassRaterTest, ratings_with_interpolated_qualities_are_close_to_exact)
+{
+    world->updateFriendlyTeamState(createRandomTeam(6));
+    world->updateEnemyTeamState(createRandomTeam(6));
+    const std::vector<Pass> passes = createRandomPasses(2000);
+
+    BatchPassRater rater(world, passing_config);
+    std::vector<double> ratings;
+    rater.ratePasses(passes, ratings);
+
+    // The interpolated open angle can be a few degrees off next to the edges of the
+    // enemy robots, so only the average error is expected to be small
+    double total_error = 0.0;
+    double max_error   = 0.0;
+    for (size_t i = 0; i < passes.size(); i++)
+    {
+        const double error =
+            std::abs(ratings[i] - ratePass(*world, passes[i], passing_config));
+        total_error += error;
+        max_error = std::max(max_error, error);
+    }
+    EXPECT_LT(total_error / passes.size(), 1e-4);
+    EXPECT_LT(max_error, 0.05);
+}
+
+TEST_F(BatchPassRaterTest, dual_rating_matches_batch_rating_and_its_gradient)
+{
+    world->updateFriendlyTeamState(createRandomTeam(6));
+    world->updateEnemyTeamState(createRandomTeam(6));
+    BatchPassRater rater(world, passing_config);
+
+    const Point passer_point(-1.0, 0.5);
+    std::vector<double> ratings;
+    auto rate_pass_to = [&](double x, double y) {
+        rater.ratePasses(
+            {Pass::fromDestReceiveSpeed(passer_point, Point(x, y), passing_config)},
+            ratings);
+        return ratings[0];
+    };
+
+    std::uniform_real_distribution x_distribution(-world->field().xLength() / 2,
+                                                  world->field().xLength() / 2);
+    std::uniform_real_distribution y_distribution(-world->field().yLength() / 2,
+                                                  world->field().yLength() / 2);
+    const double step = 1e-7;
+    for (unsigned int i = 0; i < 500; i++)
+    {
+        const double x = x_distribution(random_num_gen);
+        const double y = y_distribution(random_num_gen);
+
+        const BatchPassRater::DualScalar rating = rater.ratePass(
+            passer_point, {BatchPassRater::DualScalar::parameter(x, 0),
+                           BatchPassRater::DualScalar::parameter(y, 1)});
+
+        EXPECT_NEAR(rating.value(), rate_pass_to(x, y), 1e-9) << Point(x, y);
+        EXPECT_NEAR(rating.gradient()[0],
+                    (rate_pass_to(x + step, y) - rate_pass_to(x - step, y)) / (2 * step),
+                    1e-4)
+            << Point(x, y);
+        EXPECT_NEAR(rating.gradient()[1],
+                    (rate_pass_to(x, y + step) - rate_pass_to(x, y - step)) / (2 * step),
+                    1e-4)
+            << Point(x, y);
+    }
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST_F(BatchPassRaterTest, DISABLED_ratePasses_speed_test)
+{
+    // This test does not assert anything. Rather, it compares how many passes per
+    // millisecond ratePass and BatchPassRater can rate in the same world
+
+    world->updateFriendlyTeamState(createRandomTeam(6));
+    world->updateEnemyTeamState(createRandomTeam(6));
+    const std::vector<Pass> passes = createRandomPasses(10000);
+
+    auto start_time = std::chrono::system_clock::now();
+    for (const Pass& pass : passes)
+    {
+        ratePass(*world, pass, passing_config);
+    }
+    double scalar_duration_ms = ::TestUtil::millisecondsSince(start_time);
+
+    start_time = std::chrono::system_clock::now();
+    BatchPassRater rater(world, passing_config);
+    double construction_duration_ms = ::TestUtil::millisecondsSince(start_time);
+    start_time                      = std::chrono::system_clock::now();
+    std::vector<double> ratings;
+    rater.ratePasses(passes, ratings);
+    double rate_passes_duration_ms = ::TestUtil::millisecondsSince(start_time);
+
+    std::cout << "ratePass rated "
+              << static_cast<double>(passes.size()) / scalar_duration_ms
+              << " passes/ms, BatchPassRater rated "
+              << static_cast<double>(passes.size()) /
+                     (construction_duration_ms + rate_passes_duration_ms)
+              << " passes/ms including construction, and "
+              << static_cast<double>(passes.size()) / rate_passes_duration_ms
+              << " passes/ms in ratePasses" << std::endl;
+}
@@ -93,13 +93,19 @@ double rateShot(const Point& shot_origin, const Field& field, const Team& enemy_
         open_angle_to_goal = shot_opt.value().getOpenAngle();
     }
 
+    return rateOpenAngleToGoal(open_angle_to_goal.toDegrees(), passing_config);
+}
+
+double rateOpenAngleToGoal(double open_angle_to_goal_deg,
+                           const TbotsProto::PassingConfig& passing_config)
+{
     const double min_ideal_angle =
         passing_config.min_ideal_pass_shoot_goal_open_angle_deg();
-    double open_angle_to_goal_score = open_angle_to_goal.toDegrees();
 
     // Clamp angle to [0, min_ideal_angle], where all angle >=min_ideal_angle are given
     // a score of 1.0.
-    open_angle_to_goal_score = std::clamp(open_angle_to_goal_score, 0.0, min_ideal_angle);
+    double open_angle_to_goal_score =
+        std::clamp(open_angle_to_goal_deg, 0.0, min_ideal_angle);
 
     // Linearly scale score to [0.0, 1.0]
     return open_angle_to_goal_score / min_ideal_angle;
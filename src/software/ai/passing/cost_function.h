@@ -50,6 +50,17 @@ double rateReceivingPosition(const World& world, const Pass& pass,
 double rateShot(const Point& shot_origin, const Field& field, const Team& enemy_team,
                 const TbotsProto::PassingConfig& passing_config);
 
+/**
+ * Rate the open angle to the enemy goal from a point to shoot from
+ *
+ * @param open_angle_to_goal_deg The largest open angle to the enemy goal, in degrees
+ * @param passing_config The passing config used for tuning
+ * @return A value in [0,1] representing the quality of the shot, the same way as
+ *       rateShot does
+ */
+double rateOpenAngleToGoal(double open_angle_to_goal_deg,
+                           const TbotsProto::PassingConfig& passing_config);
+
 /**
  * Rate pass based on the probability of scoring once we receive the pass
  *
@@ -1,22 +1,44 @@
 #include "software/ai/passing/pass_generator.h"
 
+#include <Tracy.hpp>
+#include <atomic>
+#include <future>
 #include <iomanip>
+#include <numeric>
 
 #include "software/geom/algorithms/contains.h"
 #include "software/logger/logger.h"
 
 PassGenerator::PassGenerator(const TbotsProto::PassingConfig& passing_config)
     : optimizer_(optimizer_param_weights),
-      random_num_gen_(RNG_SEED),
+      num_iterations_(0),
+      thread_pool_(passing_config.pass_gen_num_threads() > 1
+                       ? std::make_shared<ThreadPool>(
+                             passing_config.pass_gen_num_threads() - 1)
+                       : nullptr),
       passing_config_(passing_config)
 {
 }
 
-PassWithRating PassGenerator::getBestPass(const World& world,
+PassWithRating PassGenerator::getBestPass(const WorldPtr& world_ptr,
                                           const std::vector<RobotId>& robots_to_ignore)
 {
+    const World& world    = *world_ptr;
+    const auto start_time = std::chrono::steady_clock::now();
+    const auto deadline =
+        start_time + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                         std::chrono::duration<double, std::milli>(
+                             passing_config_.pass_gen_time_budget_ms()));
+    statistics_ = SamplingStatistics();
+
     auto receiving_positions_map =
         sampleReceivingPositionsPerRobot(world, robots_to_ignore);
+    num_iterations_++;
+    for (const auto& [robot_id, receiving_positions] : receiving_positions_map)
+    {
+        statistics_.num_positions_sampled +=
+            static_cast<unsigned int>(receiving_positions.size());
+    }
 
     // if there are no friendly robots, return early
     if (receiving_positions_map.empty())
@@ -26,7 +48,19 @@ PassWithRating PassGenerator::getBestPass(const World& world,
     }
 
     // Optimize the receiving positions for each robot and get the best pass
-    PassWithRating best_pass = optimizeReceivingPositions(world, receiving_positions_map);
+    PassWithRating best_pass =
+        optimizeReceivingPositions(world_ptr, receiving_positions_map, deadline);
+    statistics_.duration_ms = std::chrono::duration<double, std::milli>(
+                                  std::chrono::steady_clock::now() - start_time)
+                                  .count();
+    TracyPlot("PassGenerator: Positions Sampled",
+              static_cast<int64_t>(statistics_.num_positions_sampled));
+    TracyPlot("PassGenerator: Passes Rated",
+              static_cast<int64_t>(statistics_.num_passes_rated));
+    TracyPlot("PassGenerator: Gradient Descent Steps",
+              static_cast<int64_t>(statistics_.num_gradient_descent_steps));
+    TracyPlot("PassGenerator: Rounds", static_cast<int64_t>(statistics_.num_rounds));
+    TracyPlot("PassGenerator: Duration ms", statistics_.duration_ms);
 
     // Visualize the sampled passes and the best pass
     if (passing_config_.pass_gen_vis_config().visualize_sampled_passes())
@@ -59,6 +93,11 @@ PassWithRating PassGenerator::getBestPass(const World& world,
     return best_pass;
 }
 
+const SamplingStatistics& PassGenerator::getStatistics() const
+{
+    return statistics_;
+}
+
 std::map<RobotId, std::vector<Point>> PassGenerator::sampleReceivingPositionsPerRobot(
     const World& world, const std::vector<RobotId>& robots_to_ignore)
 {
@@ -102,11 +141,16 @@ std::map<RobotId, std::vector<Point>> PassGenerator::sampleReceivingPositionsPer
         std::normal_distribution x_normal_distribution{sampling_center.x(), std_dev};
         std::normal_distribution y_normal_distribution{sampling_center.y(), std_dev};
 
+        // Each robot samples from a random number stream of its own, so that the
+        // samples for a robot don't depend on which other robots were sampled
+        std::seed_seq seed{RNG_SEED, num_iterations_, robot.id()};
+        std::mt19937 random_num_gen(seed);
+
         for (unsigned int i = 0; i < passing_config_.pass_gen_num_samples_per_robot();
              i++)
         {
-            auto point = Point(x_normal_distribution(random_num_gen_),
-                               y_normal_distribution(random_num_gen_));
+            auto point = Point(x_normal_distribution(random_num_gen),
+                               y_normal_distribution(random_num_gen));
             // Only consider points within the playing area
             if (contains(world.field().fieldLines(), point))
             {
@@ -119,41 +163,71 @@ std::map<RobotId, std::vector<Point>> PassGenerator::sampleReceivingPositionsPer
 }
 
 PassWithRating PassGenerator::optimizeReceivingPositions(
-    const World& world,
-    const std::map<RobotId, std::vector<Point>>& receiving_positions_map)
+    const WorldPtr& world_ptr,
+    const std::map<RobotId, std::vector<Point>>& receiving_positions_map,
+    std::chrono::steady_clock::time_point deadline)
 {
-    // The objective function we minimize in gradient descent to improve each pass
-    // that we're optimizing
-    const auto objective_function =
-        [this, &world](const std::array<double, NUM_PARAMS_TO_OPTIMIZE>& pass_array) {
-            // get a pass with the new appropriate speed using the new destination
-            return ratePass(world,
-                            Pass::fromDestReceiveSpeed(
-                                world.ball().position(),
-                                Point(pass_array[0], pass_array[1]), passing_config_),
-                            passing_config_);
-        };
+    const World& world = *world_ptr;
 
-    PassWithRating best_pass{Pass(Point(), Point(), 1.0), -1.0};
-    for (const auto& [robot_id, receiving_positions] : receiving_positions_map)
+    // Flatten the receiving positions of all robots, so that they can be split evenly
+    // between threads no matter how many positions each robot has
+    std::vector<Point> receiving_positions;
+    std::vector<size_t> robot_indices;
+    size_t robot_index = 0;
+    for (const auto& [robot_id, robot_receiving_positions] : receiving_positions_map)
     {
-        PassWithRating best_pass_for_robot{Pass(Point(), Point(), 1.0), -1.0};
-        for (const Point& receiving_position : receiving_positions)
+        robot_indices.insert(robot_indices.end(), robot_receiving_positions.size(),
+                             robot_index++);
+        receiving_positions.insert(receiving_positions.end(),
+                                   robot_receiving_positions.begin(),
+                                   robot_receiving_positions.end());
+    }
+
+    const BatchPassRater pass_rater(world_ptr, passing_config_);
+    std::vector<Pass> optimized_passes;
+    std::vector<double> ratings;
+    if (passing_config_.pass_gen_time_budget_ms() > 0)
+    {
+        refineWithinTimeBudget(world, pass_rater, receiving_positions, robot_indices,
+                               deadline, optimized_passes, ratings);
+    }
+    else
+    {
+        const std::vector<Point> optimized_receiving_positions =
+            optimizeInParallel(world, pass_rater, receiving_positions);
+
+        // get passes with the new appropriate speed using the optimized destinations
+        optimized_passes.reserve(optimized_receiving_positions.size());
+        for (const Point& optimized_receiving_position : optimized_receiving_positions)
         {
-            auto optimized_receiving_pos_array = optimizer_.maximize(
-                objective_function, {receiving_position.x(), receiving_position.y()},
-                passing_config_.number_of_gradient_descent_steps_per_iter());
+            optimized_passes.push_back(Pass::fromDestReceiveSpeed(
+                world.ball().position(), optimized_receiving_position, passing_config_));
+        }
+
+        // Rate all the optimized passes at once
+        pass_rater.ratePasses(optimized_passes, ratings);
 
-            // get a pass with the new appropriate speed using the optimized destination
-            Pass optimized_pass = Pass::fromDestReceiveSpeed(
-                world.ball().position(),
-                Point(optimized_receiving_pos_array[0], optimized_receiving_pos_array[1]),
-                passing_config_);
-            double score = ratePass(world, optimized_pass, passing_config_);
+        statistics_.num_rounds = 1;
+        statistics_.num_gradient_descent_steps =
+            static_cast<unsigned int>(receiving_positions.size()) *
+            passing_config_.number_of_gradient_descent_steps_per_iter();
+        statistics_.num_passes_rated = static_cast<unsigned int>(ratings.size());
+    }
 
-            if (score > best_pass_for_robot.rating)
+    // Reduce the ratings to the best pass for each robot, and the best pass overall.
+    // This goes through the passes in the same order they were sampled in, so ties
+    // are broken the same way no matter how the work was split between threads.
+    PassWithRating best_pass{Pass(Point(), Point(), 1.0), -1.0};
+    size_t pass_index = 0;
+    for (const auto& [robot_id, robot_receiving_positions] : receiving_positions_map)
+    {
+        PassWithRating best_pass_for_robot{Pass(Point(), Point(), 1.0), -1.0};
+        for (size_t i = 0; i < robot_receiving_positions.size(); i++, pass_index++)
+        {
+            if (ratings[pass_index] > best_pass_for_robot.rating)
             {
-                best_pass_for_robot = PassWithRating{optimized_pass, score};
+                best_pass_for_robot =
+                    PassWithRating{optimized_passes[pass_index], ratings[pass_index]};
             }
         }
 
@@ -177,3 +251,194 @@ PassWithRating PassGenerator::optimizeReceivingPositions(
 
     return best_pass;
 }
+
+std::vector<Point> PassGenerator::optimizeInParallel(
+    const World& world, const BatchPassRater& pass_rater,
+    const std::vector<Point>& receiving_positions)
+{
+    using DualParamArray =
+        GradientDescentOptimizer<NUM_PARAMS_TO_OPTIMIZE>::DualParamArray;
+
+    // The objective function we maximize in gradient descent to improve each pass
+    // that we're optimizing. It rates the pass with the appropriate speed for the new
+    // destination, and calculates the gradient of the rating along with it.
+    const Point passer_point      = world.ball().position();
+    const auto objective_function = [&pass_rater,
+                                     &passer_point](const DualParamArray& pass_array) {
+        return pass_rater.ratePass(passer_point, pass_array);
+    };
+
+    // Each thread writes to its own range of this vector. The optimizer only keeps its
+    // state on the stack while it runs, so it can be shared between threads.
+    std::vector<Point> optimized_receiving_positions(receiving_positions.size());
+    const auto optimize_range = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+        {
+            auto optimized_receiving_pos_array = optimizer_.maximize(
+                objective_function,
+                {receiving_positions[i].x(), receiving_positions[i].y()},
+                passing_config_.number_of_gradient_descent_steps_per_iter());
+            optimized_receiving_positions[i] =
+                Point(optimized_receiving_pos_array[0], optimized_receiving_pos_array[1]);
+        }
+    };
+
+    // Split the receiving positions into one contiguous range per thread. The calling
+    // thread optimizes the first range while the worker threads optimize the rest.
+    const size_t num_ranges = thread_pool_ ? thread_pool_->size() + 1 : 1;
+    auto range_begin        = [&](size_t range) {
+        return range * receiving_positions.size() / num_ranges;
+    };
+
+    std::vector<std::future<void>> optimized_ranges;
+    optimized_ranges.reserve(num_ranges - 1);
+    for (size_t range = 1; range < num_ranges; range++)
+    {
+        const size_t begin = range_begin(range);
+        const size_t end   = range_begin(range + 1);
+        optimized_ranges.emplace_back(thread_pool_->submit(
+            [&optimize_range, begin, end]() { optimize_range(begin, end); }));
+    }
+    optimize_range(range_begin(0), range_begin(1));
+
+    for (std::future<void>& optimized_range : optimized_ranges)
+    {
+        optimized_range.get();
+    }
+
+    return optimized_receiving_positions;
+}
+
+void PassGenerator::refineWithinTimeBudget(const World& world,
+                                           const BatchPassRater& pass_rater,
+                                           const std::vector<Point>& receiving_positions,
+                                           const std::vector<size_t>& robot_indices,
+                                           std::chrono::steady_clock::time_point deadline,
+                                           std::vector<Pass>& passes,
+                                           std::vector<double>& ratings)
+{
+    using OptimizerState = GradientDescentOptimizer<NUM_PARAMS_TO_OPTIMIZE>::State;
+    using DualParamArray =
+        GradientDescentOptimizer<NUM_PARAMS_TO_OPTIMIZE>::DualParamArray;
+
+    // Same objective function as optimizeInParallel
+    const Point passer_point      = world.ball().position();
+    const auto objective_function = [&pass_rater,
+                                     &passer_point](const DualParamArray& pass_array) {
+        return pass_rater.ratePass(passer_point, pass_array);
+    };
+    const auto get_pass = [&](const OptimizerState& state) {
+        return Pass::fromDestReceiveSpeed(
+            passer_point, Point(state.params[0], state.params[1]), passing_config_);
+    };
+
+    // Rate the receiving positions before refining any of them, so that there is a
+    // pass to return even if the time budget has already run out
+    std::vector<OptimizerState> states;
+    states.reserve(receiving_positions.size());
+    passes.clear();
+    passes.reserve(receiving_positions.size());
+    for (const Point& receiving_position : receiving_positions)
+    {
+        states.push_back(
+            OptimizerState({receiving_position.x(), receiving_position.y()}));
+        passes.push_back(get_pass(states.back()));
+    }
+    pass_rater.ratePasses(passes, ratings);
+    statistics_.num_passes_rated += static_cast<unsigned int>(passes.size());
+
+    const unsigned int num_steps_per_round = static_cast<unsigned int>(
+        std::max(0, passing_config_.number_of_gradient_descent_steps_per_iter()));
+    const size_t num_robots =
+        robot_indices.empty()
+            ? 0
+            : *std::max_element(robot_indices.begin(), robot_indices.end()) + 1;
+
+    // The indices of the receiving positions that are still being refined
+    std::vector<size_t> candidates(receiving_positions.size());
+    std::iota(candidates.begin(), candidates.end(), 0);
+    const auto sort_candidates_best_first = [&]() {
+        std::stable_sort(candidates.begin(), candidates.end(),
+                         [&](size_t a, size_t b) { return ratings[a] > ratings[b]; });
+    };
+
+    std::vector<Pass> refined_passes;
+    std::vector<double> refined_ratings;
+    while (num_steps_per_round > 0 && !candidates.empty() &&
+           std::chrono::steady_clock::now() < deadline)
+    {
+        // Refine the best candidates first, so that if the time budget runs out part
+        // way through the round, the candidates left unrefined are the least promising
+        sort_candidates_best_first();
+
+        // Candidates are handed out one at a time to the calling thread and the worker
+        // threads. A candidate is only handed out before the deadline and is always
+        // refined once it has been, so the refined candidates are the first ones.
+        std::atomic<size_t> next_candidate = 0;
+        const auto refine_candidates       = [&]() {
+            while (std::chrono::steady_clock::now() < deadline)
+            {
+                const size_t i = next_candidate++;
+                if (i >= candidates.size())
+                {
+                    return;
+                }
+                optimizer_.maximize(objective_function, states[candidates[i]],
+                                    num_steps_per_round);
+            }
+        };
+        std::vector<std::future<void>> workers;
+        for (size_t worker = 0; thread_pool_ && worker < thread_pool_->size(); worker++)
+        {
+            workers.emplace_back(thread_pool_->submit(refine_candidates));
+        }
+        refine_candidates();
+        for (std::future<void>& worker : workers)
+        {
+            worker.get();
+        }
+        const size_t num_refined = std::min(next_candidate.load(), candidates.size());
+
+        // Rate the refined candidates at once
+        refined_passes.clear();
+        for (size_t i = 0; i < num_refined; i++)
+        {
+            refined_passes.push_back(get_pass(states[candidates[i]]));
+        }
+        // Only keep a refined pass if it is better than the best pass found for the
+        // candidate so far, so that where the time budget cuts the refinement off
+        // never makes the returned pass worse
+        pass_rater.ratePasses(refined_passes, refined_ratings);
+        for (size_t i = 0; i < num_refined; i++)
+        {
+            if (refined_ratings[i] > ratings[candidates[i]])
+            {
+                passes[candidates[i]]  = refined_passes[i];
+                ratings[candidates[i]] = refined_ratings[i];
+            }
+        }
+
+        statistics_.num_rounds++;
+        statistics_.num_gradient_descent_steps +=
+            static_cast<unsigned int>(num_refined) * num_steps_per_round;
+        statistics_.num_passes_rated += static_cast<unsigned int>(num_refined);
+
+        // Keep the better half of the candidates for the next round, along with the
+        // best candidate of each robot so that every robot's best receiving position
+        // carried over to the next call is refined as far as possible
+        sort_candidates_best_first();
+        const size_t num_to_keep = (candidates.size() + 1) / 2;
+        std::vector<bool> robot_has_candidate(num_robots, false);
+        std::vector<size_t> remaining_candidates;
+        for (size_t i = 0; i < candidates.size(); i++)
+        {
+            const size_t robot_index = robot_indices[candidates[i]];
+            if (i < num_to_keep || !robot_has_candidate[robot_index])
+            {
+                remaining_candidates.push_back(candidates[i]);
+                robot_has_candidate[robot_index] = true;
+            }
+        }
+        candidates = std::move(remaining_candidates);
+    }
+}
@@ -1,15 +1,33 @@
 #pragma once
 
+#include <chrono>
+#include <memory>
 #include <random>
 
 #include "proto/parameters.pb.h"
+#include "software/ai/passing/batch_pass_rater.h"
 #include "software/ai/passing/cost_function.h"
 #include "software/ai/passing/pass_with_rating.h"
+#include "software/ai/passing/sampling_statistics.h"
+#include "software/multithreading/thread_pool.hpp"
 #include "software/optimization/gradient_descent_optimizer.hpp"
 #include "software/world/world.h"
 
 /**
  * This class is responsible for generating passes using a random sampling method
+ *
+ * The sampled receiving positions can be optimized on several threads (see
+ * pass_gen_num_threads in the passing config). Each robot's positions are sampled from
+ * a random number stream of its own, and the best pass is picked in the same order no
+ * matter which thread optimized it, so the generated passes for a given world only
+ * depend on the seed and not on the number of threads.
+ *
+ * If pass_gen_time_budget_ms in the passing config is above 0, the generator runs in
+ * an anytime mode instead. The sampled receiving positions are refined in rounds,
+ * best first, and only the better half of them (along with the best position of each
+ * robot) is kept for the next round, until the time budget runs out. The best pass
+ * found by then is returned. Since how far the refinement gets depends on timing, the
+ * generated passes are not reproducible in this mode.
  */
 class PassGenerator
 {
@@ -24,14 +42,21 @@ class PassGenerator
     /**
      * Generates the best pass based on the state of the world
      *
-     * @param world The state of the world
+     * @param world_ptr The state of the world
      * @param robots_to_ignore A list of robot ids to ignore when generating passes
      *
      * @return The best pass that can be made and its rating
      */
-    PassWithRating getBestPass(const World& world,
+    PassWithRating getBestPass(const WorldPtr& world_ptr,
                                const std::vector<RobotId>& robots_to_ignore = {});
 
+    /**
+     * Gets the counters for the work done by the last call to getBestPass
+     *
+     * @return The counters for the last call to getBestPass
+     */
+    const SamplingStatistics& getStatistics() const;
+
    private:
     /**
      * Randomly sample receiving points around friendly robots not included in the ignore
@@ -54,8 +79,45 @@ class PassGenerator
      * @returns Best optimized pass
      */
     PassWithRating optimizeReceivingPositions(
-        const World& world,
-        const std::map<RobotId, std::vector<Point>>& receiving_positions_map);
+        const WorldPtr& world_ptr,
+        const std::map<RobotId, std::vector<Point>>& receiving_positions_map,
+        std::chrono::steady_clock::time_point deadline);
+
+    /**
+     * Refines the given receiving positions in rounds until the deadline, best first,
+     * keeping the better half of the positions and the best position of each robot
+     * after each round
+     *
+     * @param world The world
+     * @param pass_rater The rater for passes in the world
+     * @param receiving_positions The receiving positions to start from
+     * @param robot_indices The index of the robot that each receiving position was
+     * sampled for
+     * @param deadline The time by which refining should stop
+     * @param passes Is set to the passes to the refined receiving positions, where the
+     * i'th one was refined from receiving_positions[i]
+     * @param ratings Is set to the rating of each of the passes
+     */
+    void refineWithinTimeBudget(const World& world, const BatchPassRater& pass_rater,
+                                const std::vector<Point>& receiving_positions,
+                                const std::vector<size_t>& robot_indices,
+                                std::chrono::steady_clock::time_point deadline,
+                                std::vector<Pass>& passes, std::vector<double>& ratings);
+
+    /**
+     * Runs gradient descent from each of the given receiving positions, splitting the
+     * receiving positions evenly between the calling thread and the thread pool
+     *
+     * @param world The world
+     * @param pass_rater The rater for passes in the world
+     * @param receiving_positions The receiving positions to start from
+     *
+     * @return The optimized receiving positions, where the i'th one was optimized
+     * from receiving_positions[i]
+     */
+    std::vector<Point> optimizeInParallel(const World& world,
+                                          const BatchPassRater& pass_rater,
+                                          const std::vector<Point>& receiving_positions);
 
     // Weights used to normalize the parameters that we pass to GradientDescent
     // (see the GradientDescent documentation for details)
@@ -72,11 +134,20 @@ class PassGenerator
 
     std::map<RobotId, Point> previous_best_receiving_positions_;
 
-    // the random seed used to initialize the random number generator
-    static constexpr int RNG_SEED = 1010;
+    // the random seed used to initialize the random number generators
+    static constexpr unsigned int RNG_SEED = 1010;
+
+    // The number of times getBestPass has been called. Each robot's random number
+    // generator is seeded with this, so that every call samples new positions.
+    unsigned int num_iterations_;
+
+    // The worker threads that help the calling thread optimize receiving positions.
+    // This is null when passes are generated on a single thread, and is shared between
+    // copies of this pass generator.
+    std::shared_ptr<ThreadPool> thread_pool_;
 
-    // A random number generator for use across the class
-    std::mt19937 random_num_gen_;
+    // The counters for the work done by the last call to getBestPass
+    SamplingStatistics statistics_;
 
     // Passing configuration
     TbotsProto::PassingConfig passing_config_;
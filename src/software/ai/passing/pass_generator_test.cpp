@@ -3,6 +3,8 @@
 #include <gtest/gtest.h>
 #include <string.h>
 
+#include <chrono>
+
 #include "software/ai/passing/cost_function.h"
 #include "software/ai/passing/eighteen_zone_pitch_division.h"
 #include "software/geom/algorithms/contains.h"
@@ -33,7 +35,7 @@ class PassGeneratorTest : public testing::Test
      * @param world The world to evaluate passes on
      * @param max_iters The maximum number of iterations of the PassGenerator to run
      */
-    static void stepPassGenerator(PassGenerator pass_generator, const World& world,
+    static void stepPassGenerator(PassGenerator pass_generator, const WorldPtr& world,
                                   int max_iters)
     {
         for (int i = 0; i < max_iters; i++)
@@ -42,6 +44,29 @@ class PassGeneratorTest : public testing::Test
         }
     }
 
+    /**
+     * Sets up a world with a full team of friendly and enemy robots spread across the
+     * field, with the ball in the friendly half
+     */
+    void setUpFullWorld()
+    {
+        Team friendly_team(Duration::fromSeconds(10));
+        Team enemy_team(Duration::fromSeconds(10));
+        for (RobotId id = 0; id < 6; id++)
+        {
+            const double x = -3.0 + 1.2 * id;
+            friendly_team.updateRobots({Robot(
+                id, {x, (id % 2 == 0) ? 1.5 : -1.5}, {0.5, -0.2}, Angle::zero(),
+                AngularVelocity::zero(), Timestamp::fromSeconds(0))});
+            enemy_team.updateRobots({Robot(
+                id, {x + 0.6, (id % 2 == 0) ? -0.5 : 0.8}, {-0.3, 0.4}, Angle::zero(),
+                AngularVelocity::zero(), Timestamp::fromSeconds(0))});
+        }
+        world->updateFriendlyTeamState(friendly_team);
+        world->updateEnemyTeamState(enemy_team);
+        world->updateBall(Ball({-2.5, 0}, {0, 0}, Timestamp::fromSeconds(0)));
+    }
+
     std::shared_ptr<World> world = ::TestUtil::createBlankTestingWorld();
     TbotsProto::PassingConfig passing_config;
     PassGenerator pass_generator;
@@ -84,15 +109,15 @@ TEST_F(PassGeneratorTest, check_pass_converges)
     world->updateEnemyTeamState(enemy_team);
 
     // call generate evaluation 100 times on the given world
-    stepPassGenerator(pass_generator, *world, 100);
+    stepPassGenerator(pass_generator, world, 100);
 
-    auto [best_pass, score] = pass_generator.getBestPass(*world);
+    auto [best_pass, score] = pass_generator.getBestPass(world);
 
     // After 100 iterations on the same world, we should "converge"
     // to the same pass.
     for (int i = 0; i < 7; i++)
     {
-        auto [pass, score] = pass_generator.getBestPass(*world);
+        auto [pass, score] = pass_generator.getBestPass(world);
 
         EXPECT_LE((best_pass.receiverPoint() - pass.receiverPoint()).length(), 0.7);
         EXPECT_LE(abs(best_pass.speed() - pass.speed()), 0.7);
@@ -134,10 +159,10 @@ TEST_F(PassGeneratorTest, check_pass_does_not_converge_to_self_pass)
     world->updateEnemyTeamState(enemy_team);
 
     // call generate evaluation 100 times on the given world
-    stepPassGenerator(pass_generator, *world, 100);
+    stepPassGenerator(pass_generator, world, 100);
 
     // Find what pass we converged to
-    auto [converged_pass, converged_score] = pass_generator.getBestPass(*world);
+    auto [converged_pass, converged_score] = pass_generator.getBestPass(world);
 
     // We expect to have converged to a point near robot 2. The tolerance is fairly
     // generous here because the enemies on the field can "force" the point slightly
@@ -185,10 +210,10 @@ TEST_F(PassGeneratorTest, test_passer_point_changes_are_respected)
         Ball(BallState(Point(3, 1), Vector(0, 0)), Timestamp::fromSeconds(0)));
 
     // call generate evaluation 100 times on the given world
-    stepPassGenerator(pass_generator, *world, 100);
+    stepPassGenerator(pass_generator, world, 100);
 
     // Find what pass we converged to
-    auto converged_pass = pass_generator.getBestPass(*world).pass;
+    auto converged_pass = pass_generator.getBestPass(world).pass;
 
     // We expect to have converged to a point closer to the robot in the pos_y
     // compared to the robot in the neg_y position since the ball is in +y
@@ -201,10 +226,10 @@ TEST_F(PassGeneratorTest, test_passer_point_changes_are_respected)
         Ball(BallState(Point(3, -1), Vector(0, 0)), Timestamp::fromSeconds(0)));
 
     // call generate evaluation 100 times on the given world
-    stepPassGenerator(pass_generator, *world, 100);
+    stepPassGenerator(pass_generator, world, 100);
 
     // Find what pass we converged to
-    converged_pass = pass_generator.getBestPass(*world).pass;
+    converged_pass = pass_generator.getBestPass(world).pass;
 
     // We expect to have converged to a point closer to the robot in the neg_y
     // compared to the robot in the pos_y position.
@@ -225,7 +250,7 @@ TEST_F(PassGeneratorTest, test_open_pass_score_being_high_2_friendlies)
     Ball ball({0, 0}, {0, 0}, Timestamp::fromSeconds(0));
     world->updateBall(ball);
 
-    PassWithRating best_pass = pass_generator.getBestPass(*world);
+    PassWithRating best_pass = pass_generator.getBestPass(world);
     EXPECT_GE(best_pass.rating, 0.8);
 }
 
@@ -244,7 +269,7 @@ TEST_F(PassGeneratorTest, test_open_pass_score_being_high_3_friendlies)
     Ball ball({0.5, 0}, {0, 0}, Timestamp::fromSeconds(0));
     world->updateBall(ball);
 
-    PassWithRating best_pass = pass_generator.getBestPass(*world);
+    PassWithRating best_pass = pass_generator.getBestPass(world);
     EXPECT_GE(best_pass.rating, 0.8);
 }
 
@@ -272,7 +297,7 @@ TEST_F(PassGeneratorTest, test_two_blocked_friendly_one_open_friendly)
                                    AngularVelocity::zero(), Timestamp::fromSeconds(0))});
     world->updateEnemyTeamState(enemy_team);
 
-    PassWithRating best_pass = pass_generator.getBestPass(*world);
+    PassWithRating best_pass = pass_generator.getBestPass(world);
     EXPECT_GE(best_pass.rating, 0.5);
     // Verify that the pass is to the open friendly
     EXPECT_TRUE((best_pass.pass.receiverPoint() -
@@ -301,10 +326,117 @@ TEST_F(PassGeneratorTest, test_robots_ignore_list)
     world->updateEnemyTeamState(enemy_team);
 
     std::vector<RobotId> ignore_list = {1};
-    PassWithRating best_pass         = pass_generator.getBestPass(*world, ignore_list);
+    PassWithRating best_pass         = pass_generator.getBestPass(world, ignore_list);
 
     // Verify that the pass is to the only friendly which is not ignored
     EXPECT_TRUE((best_pass.pass.receiverPoint() -
                  world->friendlyTeam().getRobotById(2)->position())
                     .length() < 0.3);
 }
+
+TEST_F(PassGeneratorTest, generates_same_passes_with_any_number_of_threads)
+{
+    setUpFullWorld();
+    passing_config.set_pass_gen_num_samples_per_robot(7);
+    PassGenerator single_threaded_pass_generator(passing_config);
+    passing_config.set_pass_gen_num_threads(4);
+    PassGenerator multi_threaded_pass_generator(passing_config);
+
+    for (int i = 0; i < 20; i++)
+    {
+        PassWithRating single_threaded_pass =
+            single_threaded_pass_generator.getBestPass(world);
+        PassWithRating multi_threaded_pass =
+            multi_threaded_pass_generator.getBestPass(world);
+
+        EXPECT_EQ(single_threaded_pass.pass, multi_threaded_pass.pass);
+        EXPECT_EQ(single_threaded_pass.rating, multi_threaded_pass.rating);
+    }
+}
+
+TEST_F(PassGeneratorTest, statistics_count_work_done_without_time_budget)
+{
+    setUpFullWorld();
+
+    pass_generator.getBestPass(world);
+    const SamplingStatistics& statistics = pass_generator.getStatistics();
+
+    // Every robot has its own position and some of its samples
+    EXPECT_GE(statistics.num_positions_sampled, 6u);
+    EXPECT_LE(statistics.num_positions_sampled,
+              6 * (1 + passing_config.pass_gen_num_samples_per_robot()));
+    EXPECT_EQ(statistics.num_passes_rated, statistics.num_positions_sampled);
+    EXPECT_EQ(statistics.num_gradient_descent_steps,
+              statistics.num_positions_sampled *
+                  passing_config.number_of_gradient_descent_steps_per_iter());
+    EXPECT_EQ(statistics.num_rounds, 1u);
+}
+
+TEST_F(PassGeneratorTest, time_budget_finds_pass_at_least_as_good_as_fixed_work)
+{
+    setUpFullWorld();
+    PassGenerator fixed_work_pass_generator(passing_config);
+    passing_config.set_pass_gen_time_budget_ms(20);
+    PassGenerator time_budget_pass_generator(passing_config);
+
+    // The first round refines every sampled position as far as the fixed work
+    // generator does, and later rounds only keep passes that are better
+    const PassWithRating fixed_work_pass = fixed_work_pass_generator.getBestPass(world);
+    const PassWithRating time_budget_pass =
+        time_budget_pass_generator.getBestPass(world);
+    const SamplingStatistics& statistics = time_budget_pass_generator.getStatistics();
+
+    // How many rounds fit in the budget depends on the machine, but the first round is
+    // always finished
+    EXPECT_GE(time_budget_pass.rating, fixed_work_pass.rating);
+    EXPECT_GE(statistics.num_rounds, 1u);
+    EXPECT_GE(statistics.num_passes_rated, statistics.num_positions_sampled);
+    EXPECT_GE(statistics.num_gradient_descent_steps,
+              fixed_work_pass_generator.getStatistics().num_gradient_descent_steps);
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST_F(PassGeneratorTest, DISABLED_getBestPass_thread_scaling_speed_test)
+{
+    // This test does not assert anything. Rather, it prints how long getBestPass takes
+    // with different numbers of threads in the same world
+
+    setUpFullWorld();
+    passing_config.set_pass_gen_num_samples_per_robot(50);
+    const int num_iterations = 50;
+
+    for (unsigned int num_threads : {1, 2, 4, 8})
+    {
+        passing_config.set_pass_gen_num_threads(num_threads);
+        PassGenerator threaded_pass_generator(passing_config);
+
+        auto start_time = std::chrono::system_clock::now();
+        for (int i = 0; i < num_iterations; i++)
+        {
+            threaded_pass_generator.getBestPass(world);
+        }
+        double duration_ms = ::TestUtil::millisecondsSince(start_time);
+
+        std::cout << "getBestPass took " << duration_ms / num_iterations << " ms with "
+                  << num_threads << " thread(s)" << std::endl;
+    }
+}
+
+// This test is disabled since it depends on the speed of the machine, it can be
+// enabled by removing "DISABLED_" from the test name
+TEST_F(PassGeneratorTest, DISABLED_time_budget_is_respected_speed_test)
+{
+    setUpFullWorld();
+    passing_config.set_pass_gen_time_budget_ms(2);
+    pass_generator = PassGenerator(passing_config);
+
+    for (int i = 0; i < 5; i++)
+    {
+        const PassWithRating best_pass = pass_generator.getBestPass(world);
+        EXPECT_GE(best_pass.rating, 0.0);
+
+        // Leave some room for the last round's rating and for a slow machine
+        EXPECT_LT(pass_generator.getStatistics().duration_ms, 2 + 20);
+    }
+}
@@ -1,19 +1,27 @@
 #pragma once
 
+#include <Tracy.hpp>
+#include <chrono>
 #include <random>
 
 #include "proto/message_translation/tbots_protobuf.h"
 #include "proto/parameters.pb.h"
+#include "software/ai/passing/batch_pass_rater.h"
 #include "software/ai/passing/cost_function.h"
 #include "software/ai/passing/field_pitch_division.h"
 #include "software/ai/passing/pass.h"
 #include "software/ai/passing/pass_with_rating.h"
+#include "software/ai/passing/sampling_statistics.h"
 #include "software/logger/logger.h"
 #include "software/world/world.h"
 
 /**
  * This class is responsible for generating the best positions for our pass
  * receivers to go to
+ *
+ * If time_budget_ms in the receiver position generator config is above 0, the zones
+ * are sampled in rounds after the initial samples, keeping only the better half of the
+ * zones for the next round, until the time budget runs out.
  */
 template <class ZoneEnum>
 class ReceiverPositionGenerator
@@ -36,7 +44,7 @@ class ReceiverPositionGenerator
     /**
      * Generates the best receiving positions for the friendly robots to go to
      *
-     * @param world The world to generate the best receiving positions based on
+     * @param world_ptr The world to generate the best receiving positions based on
      * @param num_positions The number of receiving positions to generate
      * @param existing_receiver_positions A set of existing receiver positions that will
      * be avoided, if possible, when generating the new receiver positions.
@@ -49,10 +57,16 @@ class ReceiverPositionGenerator
      * positions that the receivers could use.
      */
     std::vector<Point> getBestReceivingPositions(
-        const World &world, unsigned int num_positions,
+        const WorldPtr &world_ptr, unsigned int num_positions,
         const std::vector<Point> &existing_receiver_positions = {},
         const std::optional<Point> &pass_origin_override      = std::nullopt);
 
+    /**
+     * Gets the counters for the work done by the last call to getBestReceivingPositions
+     *
+     * @return The counters for the last call to getBestReceivingPositions
+     */
+    const SamplingStatistics &getStatistics() const;
 
    private:
     /**
@@ -61,15 +75,19 @@ class ReceiverPositionGenerator
      *
      * @param best_receiving_positions The map of the best receiving positions for each
      * zone found so far, and their ratings.
-     * @param world The world to sample receiving positions in
+     * @param pass_rater The rater for passes in the world to sample receiving positions
+     * in
      * @param pass_origin The origin of the pass
      * @param zones_to_sample The subset of the zones to sample receiving positions in
      * @param num_samples_per_zone The number of samples to take per zone
+     * @param deadline The time after which no more zones are sampled
      */
     void updateBestReceiverPositions(
-        std::map<ZoneEnum, PassWithRating> &best_receiving_positions, const World &world,
-        const Point &pass_origin, const std::vector<ZoneEnum> &zones_to_sample,
-        unsigned int num_samples_per_zone);
+        std::map<ZoneEnum, PassWithRating> &best_receiving_positions,
+        const BatchPassRater &pass_rater, const Point &pass_origin,
+        const std::vector<ZoneEnum> &zones_to_sample, unsigned int num_samples_per_zone,
+        std::chrono::steady_clock::time_point deadline =
+            std::chrono::steady_clock::time_point::max());
 
     /**
      * Helper function for getting the top num_positions zones from the current
@@ -112,6 +130,9 @@ class ReceiverPositionGenerator
     // A random number generator for use across the class
     std::mt19937 random_num_gen_;
 
+    // The counters for the work done by the last call to getBestReceivingPositions
+    SamplingStatistics statistics_;
+
     // The random seed to initialize the random number generator
     static constexpr int RNG_SEED = 1010;
 };
@@ -128,15 +149,22 @@ ReceiverPositionGenerator<ZoneEnum>::ReceiverPositionGenerator(
 
 template <class ZoneEnum>
 std::vector<Point> ReceiverPositionGenerator<ZoneEnum>::getBestReceivingPositions(
-    const World &world, unsigned int num_positions,
+    const WorldPtr &world_ptr, unsigned int num_positions,
     const std::vector<Point> &existing_receiver_positions,
     const std::optional<Point> &pass_origin_override)
 {
+    const World &world    = *world_ptr;
+    const auto start_time = std::chrono::steady_clock::now();
     std::map<ZoneEnum, PassWithRating> best_receiving_positions;
     debug_shapes.clear();
+    statistics_ = SamplingStatistics();
 
     Point pass_origin           = pass_origin_override.value_or(world.ball().position());
     const auto &receiver_config = passing_config_.receiver_position_generator_config();
+    const auto deadline =
+        start_time + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                         std::chrono::duration<double, std::milli>(
+                             receiver_config.time_budget_ms()));
 
     // Verify that the number of receiver positions requested is valid
     if (num_positions >
@@ -163,22 +191,56 @@ std::vector<Point> ReceiverPositionGenerator<ZoneEnum>::getBestReceivingPosition
             receiver_config.previous_best_receiver_position_score_multiplier();
         best_receiving_positions.insert_or_assign(
             zone, PassWithRating{pass, receiver_position_rating});
+        statistics_.num_positions_sampled++;
+        statistics_.num_passes_rated++;
     }
 
     // Begin by sampling a few passes per zone to get an initial estimate of the best
     // receiving zones
-    updateBestReceiverPositions(best_receiving_positions, world, pass_origin,
-                                pitch_division_->getAllZoneIds(),
+    const BatchPassRater pass_rater(world_ptr, passing_config_);
+    const std::vector<ZoneEnum> all_zones = pitch_division_->getAllZoneIds();
+    updateBestReceiverPositions(best_receiving_positions, pass_rater, pass_origin,
+                                all_zones,
                                 receiver_config.num_initial_samples_per_zone());
 
-    // Get the top zones based on the initial sampling
-    std::vector<ZoneEnum> top_zones =
-        getTopZones(best_receiving_positions, num_positions, pass_origin,
-                    existing_receiver_positions);
+    std::vector<ZoneEnum> top_zones;
+    if (receiver_config.time_budget_ms() > 0)
+    {
+        // Keep sampling the better half of the zones until the time budget runs out.
+        // Some of the best zones may be too close to each other to all be used, so
+        // twice as many zones as requested are always kept.
+        const size_t min_num_zones_to_sample =
+            std::min<size_t>(all_zones.size(), 2 * num_positions);
+        std::vector<ZoneEnum> zones_to_sample = all_zones;
+        while (std::chrono::steady_clock::now() < deadline)
+        {
+            std::stable_sort(zones_to_sample.begin(), zones_to_sample.end(),
+                             [&](const ZoneEnum &z1, const ZoneEnum &z2) {
+                                 return best_receiving_positions.find(z1)->second.rating >
+                                        best_receiving_positions.find(z2)->second.rating;
+                             });
+            zones_to_sample.resize(std::max(min_num_zones_to_sample,
+                                            (zones_to_sample.size() + 1) / 2));
+            updateBestReceiverPositions(best_receiving_positions, pass_rater,
+                                        pass_origin, zones_to_sample,
+                                        receiver_config.num_initial_samples_per_zone(),
+                                        deadline);
+        }
 
-    // Sample more passes from only the top zones and update their ranking
-    updateBestReceiverPositions(best_receiving_positions, world, pass_origin, top_zones,
-                                receiver_config.num_additional_samples_per_top_zone());
+        top_zones = getTopZones(best_receiving_positions, num_positions, pass_origin,
+                                existing_receiver_positions);
+    }
+    else
+    {
+        // Get the top zones based on the initial sampling
+        top_zones = getTopZones(best_receiving_positions, num_positions, pass_origin,
+                                existing_receiver_positions);
+
+        // Sample more passes from only the top zones and update their ranking
+        updateBestReceiverPositions(
+            best_receiving_positions, pass_rater, pass_origin, top_zones,
+            receiver_config.num_additional_samples_per_top_zone());
+    }
     std::sort(top_zones.begin(), top_zones.end(),
               [&](const ZoneEnum &z1, const ZoneEnum &z2) {
                   return best_receiving_positions.find(z1)->second.rating >
@@ -203,9 +265,25 @@ std::vector<Point> ReceiverPositionGenerator<ZoneEnum>::getBestReceivingPosition
         visualizeBestReceivingPositionsAndZones(best_receiving_positions, top_zones);
     }
 
+    statistics_.duration_ms = std::chrono::duration<double, std::milli>(
+                                  std::chrono::steady_clock::now() - start_time)
+                                  .count();
+    TracyPlot("ReceiverPositionGenerator: Positions Sampled",
+              static_cast<int64_t>(statistics_.num_positions_sampled));
+    TracyPlot("ReceiverPositionGenerator: Passes Rated",
+              static_cast<int64_t>(statistics_.num_passes_rated));
+    TracyPlot("ReceiverPositionGenerator: Rounds",
+              static_cast<int64_t>(statistics_.num_rounds));
+    TracyPlot("ReceiverPositionGenerator: Duration ms", statistics_.duration_ms);
     return best_positions;
 }
 
+template <class ZoneEnum>
+const SamplingStatistics &ReceiverPositionGenerator<ZoneEnum>::getStatistics() const
+{
+    return statistics_;
+}
+
 template <class ZoneEnum>
 void ReceiverPositionGenerator<ZoneEnum>::visualizeBestReceivingPositionsAndZones(
     const std::map<ZoneEnum, PassWithRating> &best_receiving_positions,
@@ -229,12 +307,23 @@ void ReceiverPositionGenerator<ZoneEnum>::visualizeBestReceivingPositionsAndZone
 
 template <class ZoneEnum>
 void ReceiverPositionGenerator<ZoneEnum>::updateBestReceiverPositions(
-    std::map<ZoneEnum, PassWithRating> &best_receiving_positions, const World &world,
-    const Point &pass_origin, const std::vector<ZoneEnum> &zones_to_sample,
-    unsigned int num_samples_per_zone)
+    std::map<ZoneEnum, PassWithRating> &best_receiving_positions,
+    const BatchPassRater &pass_rater, const Point &pass_origin,
+    const std::vector<ZoneEnum> &zones_to_sample, unsigned int num_samples_per_zone,
+    std::chrono::steady_clock::time_point deadline)
 {
+    std::vector<Pass> sampled_passes;
+    std::vector<double> ratings;
+    sampled_passes.reserve(num_samples_per_zone);
+    statistics_.num_rounds++;
+
     for (const auto &zone_id : zones_to_sample)
     {
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+            return;
+        }
+
         auto zone = pitch_division_->getZone(zone_id);
         std::uniform_real_distribution x_distribution(zone.xMin(), zone.xMax());
         std::uniform_real_distribution y_distribution(zone.yMin(), zone.yMax());
@@ -248,18 +337,24 @@ void ReceiverPositionGenerator<ZoneEnum>::updateBestReceiverPositions(
             best_pass_for_receiving = best_sampled_pass_iter->second;
         }
 
-        // Randomly sample receiving positions in the zone
+        // Randomly sample receiving positions in the zone, then rate them all at once
+        sampled_passes.clear();
         for (unsigned int i = 0; i < num_samples_per_zone; ++i)
         {
-            auto pass = Pass::fromDestReceiveSpeed(
-                pass_origin,
-                Point(x_distribution(random_num_gen_), y_distribution(random_num_gen_)),
-                passing_config_);
-            double rating = rateReceivingPosition(world, pass, passing_config_);
+            const double x = x_distribution(random_num_gen_);
+            const double y = y_distribution(random_num_gen_);
+            sampled_passes.push_back(
+                Pass::fromDestReceiveSpeed(pass_origin, Point(x, y), passing_config_));
+        }
+        pass_rater.rateReceivingPositions(sampled_passes, ratings);
+        statistics_.num_positions_sampled += num_samples_per_zone;
+        statistics_.num_passes_rated += num_samples_per_zone;
 
-            if (rating > best_pass_for_receiving.rating)
+        for (size_t i = 0; i < sampled_passes.size(); ++i)
+        {
+            if (ratings[i] > best_pass_for_receiving.rating)
             {
-                best_pass_for_receiving = PassWithRating{pass, rating};
+                best_pass_for_receiving = PassWithRating{sampled_passes[i], ratings[i]};
             }
         }
 
@@ -51,7 +51,7 @@ class ReceiverPositionGeneratorTest : public testing::Test
         for (int i = 0; i < 100; ++i)
         {
             best_receiving_positions =
-                receiver_position_generator.getBestReceivingPositions(*world,
+                receiver_position_generator.getBestReceivingPositions(world,
                                                                       num_positions);
         }
         return best_receiving_positions;
@@ -142,7 +142,7 @@ TEST_F(ReceiverPositionGeneratorTest, test_receiving_position_rating_not_degradi
     for (int i = 0; i < 10; ++i)
     {
         std::vector<Point> best_receiving_positions =
-            receiver_position_generator.getBestReceivingPositions(*world, 1);
+            receiver_position_generator.getBestReceivingPositions(world, 1);
         double score = rateReceivingPosition(
             *world,
             Pass::fromDestReceiveSpeed(ball_pos, best_receiving_positions[0],
@@ -152,3 +152,42 @@ TEST_F(ReceiverPositionGeneratorTest, test_receiving_position_rating_not_degradi
         prev_score = score;
     }
 }
+
+TEST_F(ReceiverPositionGeneratorTest, statistics_count_work_done_without_time_budget)
+{
+    ::TestUtil::setBallPosition(world, Point(0, 0), Timestamp::fromSeconds(0));
+    ::TestUtil::setFriendlyRobotPositions(world, {Point(2, -2), Point(2, 0), Point(2, 2)},
+                                          Timestamp::fromSeconds(0));
+
+    receiver_position_generator.getBestReceivingPositions(world, 2);
+    const SamplingStatistics &statistics = receiver_position_generator.getStatistics();
+
+    // The initial samples in all 18 zones, then the additional samples in the top 2
+    const auto &receiver_config = passing_config.receiver_position_generator_config();
+    const unsigned int expected_num_samples =
+        18 * receiver_config.num_initial_samples_per_zone() +
+        2 * receiver_config.num_additional_samples_per_top_zone();
+    EXPECT_EQ(statistics.num_positions_sampled, expected_num_samples);
+    EXPECT_EQ(statistics.num_passes_rated, expected_num_samples);
+    EXPECT_EQ(statistics.num_rounds, 2u);
+}
+
+TEST_F(ReceiverPositionGeneratorTest, time_budget_samples_top_zones_until_it_runs_out)
+{
+    ::TestUtil::setBallPosition(world, Point(0, 0), Timestamp::fromSeconds(0));
+    ::TestUtil::setFriendlyRobotPositions(world, {Point(2, -2), Point(2, 0), Point(2, 2)},
+                                          Timestamp::fromSeconds(0));
+    passing_config.mutable_receiver_position_generator_config()->set_time_budget_ms(2);
+    receiver_position_generator = ReceiverPositionGenerator<EighteenZoneId>(
+        std::make_shared<const EighteenZonePitchDivision>(
+            Field::createSSLDivisionBField()),
+        passing_config);
+
+    const std::vector<Point> best_receiving_positions =
+        receiver_position_generator.getBestReceivingPositions(world, 2);
+    const SamplingStatistics &statistics = receiver_position_generator.getStatistics();
+
+    EXPECT_EQ(best_receiving_positions.size(), 2u);
+    EXPECT_GE(statistics.num_rounds, 1u);
+    EXPECT_EQ(statistics.num_passes_rated, statistics.num_positions_sampled);
+}
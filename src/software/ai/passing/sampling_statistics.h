@@ -0,0 +1,25 @@
+#pragma once
+
+/**
+ * Counters for the work that a pass or receiving position generator did in one call.
+ * The generators plot these in Tracy after every call.
+ */
+struct SamplingStatistics
+{
+    // The number of receiving positions that were sampled, including positions that
+    // were carried over from the previous call
+    unsigned int num_positions_sampled = 0;
+
+    // The number of times a pass was rated, counting a position again every time it is
+    // rated after being refined
+    unsigned int num_passes_rated = 0;
+
+    // The number of gradient descent steps taken, summed over all receiving positions
+    unsigned int num_gradient_descent_steps = 0;
+
+    // The number of rounds of refinement that were started
+    unsigned int num_rounds = 0;
+
+    // The wall-clock time the call took, in milliseconds
+    double duration_ms = 0.0;
+};
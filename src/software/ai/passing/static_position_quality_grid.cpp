@@ -0,0 +1,140 @@
+#include "software/ai/passing/static_position_quality_grid.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "software/math/math_functions.h"
+
+namespace
+{
+    // The width of the sigmoids used by getStaticPositionQuality
+    constexpr double STATIC_POSITION_SIGMOID_WIDTH = 0.1;
+
+    /**
+     * Calculates the x or y term of rectangleSigmoid, for a rectangle that spans
+     * [min, max] along that axis
+     */
+    double rectangleSigmoidTerm(double v, double min, double max)
+    {
+        return std::min(sigmoid(v, max, -STATIC_POSITION_SIGMOID_WIDTH),
+                        sigmoid(v, min, STATIC_POSITION_SIGMOID_WIDTH));
+    }
+}  // namespace
+
+StaticPositionQualityGrid::StaticPositionQualityGrid(
+    const Field& field, const TbotsProto::PassingConfig& passing_config)
+    : field_boundary(field.fieldBoundary()),
+      friendly_goal_center(field.friendlyGoalCenter()),
+      on_field_x_quality(
+          field_boundary.xMin(), field_boundary.xMax(),
+          passing_config.static_position_quality_grid_resolution_meters(),
+          [&](double x) {
+              const double half_field_length = field.xLength() / 2;
+              const double x_offset =
+                  passing_config.static_field_position_quality_x_offset();
+              return rectangleSigmoidTerm(x, -half_field_length + x_offset,
+                                          half_field_length - x_offset);
+          }),
+      on_field_y_quality(
+          field_boundary.yMin(), field_boundary.yMax(),
+          passing_config.static_position_quality_grid_resolution_meters(),
+          [&](double y) {
+              const double half_field_width = field.yLength() / 2;
+              const double y_offset =
+                  passing_config.static_field_position_quality_y_offset();
+              return rectangleSigmoidTerm(y, -half_field_width + y_offset,
+                                          half_field_width - y_offset);
+          }),
+      in_enemy_defense_area_x(
+          field_boundary.xMin(), field_boundary.xMax(),
+          passing_config.static_position_quality_grid_resolution_meters(),
+          [&](double x) {
+              return rectangleSigmoidTerm(x, field.enemyDefenseArea().xMin(),
+                                          field.enemyDefenseArea().xMax());
+          }),
+      in_enemy_defense_area_y(
+          field_boundary.yMin(), field_boundary.yMax(),
+          passing_config.static_position_quality_grid_resolution_meters(),
+          [&](double y) {
+              return rectangleSigmoidTerm(y, field.enemyDefenseArea().yMin(),
+                                          field.enemyDefenseArea().yMax());
+          }),
+      near_friendly_goal_quality(
+          0,
+          std::max({(field_boundary.negXNegYCorner() - friendly_goal_center).length(),
+                    (field_boundary.negXPosYCorner() - friendly_goal_center).length(),
+                    (field_boundary.posXNegYCorner() - friendly_goal_center).length(),
+                    (field_boundary.posXPosYCorner() - friendly_goal_center).length()}),
+          passing_config.static_position_quality_grid_resolution_meters(),
+          [&](double distance_to_friendly_goal) {
+              const double friendly_goal_weight =
+                  passing_config
+                      .static_field_position_quality_friendly_goal_distance_weight();
+              return 1 - std::exp(-friendly_goal_weight *
+                                  std::pow(5, -2 + distance_to_friendly_goal));
+          })
+{
+}
+
+bool StaticPositionQualityGrid::contains(double x, double y) const
+{
+    return x >= field_boundary.xMin() && x <= field_boundary.xMax() &&
+           y >= field_boundary.yMin() && y <= field_boundary.yMax();
+}
+
+double StaticPositionQualityGrid::interpolate(double x, double y) const
+{
+    double d_dx;
+    double d_dy;
+    return interpolate(x, y, d_dx, d_dy);
+}
+
+double StaticPositionQualityGrid::interpolate(double x, double y, double& d_dx,
+                                              double& d_dy) const
+{
+    double on_field_x_d_dx;
+    double on_field_y_d_dy;
+    double in_defense_area_x_d_dx;
+    double in_defense_area_y_d_dy;
+    double near_goal_d_dd;
+    const double on_field_x = on_field_x_quality.interpolate(x, on_field_x_d_dx);
+    const double on_field_y = on_field_y_quality.interpolate(y, on_field_y_d_dy);
+    const double in_defense_area_x =
+        in_enemy_defense_area_x.interpolate(x, in_defense_area_x_d_dx);
+    const double in_defense_area_y =
+        in_enemy_defense_area_y.interpolate(y, in_defense_area_y_d_dy);
+
+    const Vector goal_to_point = Point(x, y) - friendly_goal_center;
+    const double distance      = goal_to_point.length();
+    const double near_goal =
+        near_friendly_goal_quality.interpolate(distance, near_goal_d_dd);
+
+    // The distance to the friendly goal has no gradient at the goal center itself
+    const double distance_d_dx = distance > 0 ? goal_to_point.x() / distance : 0;
+    const double distance_d_dy = distance > 0 ? goal_to_point.y() / distance : 0;
+
+    const double on_field        = on_field_x * on_field_y;
+    const double in_defense_area = in_defense_area_x * in_defense_area_y;
+
+    d_dx = on_field_x_d_dx * on_field_y * near_goal * (1 - in_defense_area) +
+           on_field * near_goal_d_dd * distance_d_dx * (1 - in_defense_area) -
+           on_field * near_goal * in_defense_area_x_d_dx * in_defense_area_y;
+    d_dy = on_field_x * on_field_y_d_dy * near_goal * (1 - in_defense_area) +
+           on_field * near_goal_d_dd * distance_d_dy * (1 - in_defense_area) -
+           on_field * near_goal * in_defense_area_x * in_defense_area_y_d_dy;
+    return on_field * near_goal * (1 - in_defense_area);
+}
+
+double StaticPositionQualityGrid::SampledFunction::interpolate(double v,
+                                                               double& d_dv) const
+{
+    // Find the samples on either side of the value, clamping so that values on or past
+    // the last sample use the last pair of samples rather than one past it
+    const double max    = min + static_cast<double>(samples.size() - 1) * resolution;
+    const double sample = (std::clamp(v, min, max) - min) / resolution;
+    const size_t i      = std::min(static_cast<size_t>(sample), samples.size() - 2);
+    const double t      = sample - static_cast<double>(i);
+
+    d_dv = (samples[i + 1] - samples[i]) / resolution;
+    return samples[i] + (samples[i + 1] - samples[i]) * t;
+}
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <cmath>
+#include <vector>
+
+#include "proto/parameters.pb.h"
+#include "software/geom/rectangle.h"
+#include "software/optimization/dual_number.hpp"
+#include "software/world/field.h"
+
+/**
+ * A sampled copy of getStaticPositionQuality over the whole field, including the
+ * boundary around it.
+ *
+ * Static position quality only depends on the field and the passing config, but is
+ * costly to evaluate. It is the product of a term for x, a term for y, a term for the
+ * distance to the friendly goal and one minus the product of another term for x and
+ * another term for y (see getStaticPositionQuality). Each of those terms is a function
+ * of a single variable, so each is sampled on its own at the resolution set in the
+ * passing config, and a rating linearly interpolates every term between its two
+ * closest samples instead.
+ *
+ * Since only a few thousand samples are taken, building a grid is cheap enough to do
+ * for every world that passes are rated in.
+ */
+class StaticPositionQualityGrid
+{
+   public:
+    StaticPositionQualityGrid() = delete;
+
+    /**
+     * Builds a grid of the static position quality on the given field
+     *
+     * @param field The field to build the grid for
+     * @param passing_config The passing config used for tuning
+     */
+    explicit StaticPositionQualityGrid(const Field& field,
+                                       const TbotsProto::PassingConfig& passing_config);
+
+    /**
+     * Checks if the given point is covered by this grid
+     *
+     * @param x The x coordinate of the point
+     * @param y The y coordinate of the point
+     *
+     * @return true if the quality at the point can be interpolated from this grid
+     */
+    bool contains(double x, double y) const;
+
+    /**
+     * Interpolates the static position quality at the given point, which must be
+     * covered by this grid
+     *
+     * @param x The x coordinate of the point
+     * @param y The y coordinate of the point
+     *
+     * @return The interpolated static position quality
+     */
+    double interpolate(double x, double y) const;
+
+    /**
+     * Interpolates the static position quality at the given point, which must be
+     * covered by this grid, along with its gradient
+     *
+     * @param x The x coordinate of the point
+     * @param y The y coordinate of the point
+     *
+     * @return The interpolated static position quality, carrying the gradient of the
+     * interpolation
+     */
+    template <size_t NUM_PARAMS>
+    DualNumber<NUM_PARAMS> interpolate(const DualNumber<NUM_PARAMS>& x,
+                                       const DualNumber<NUM_PARAMS>& y) const;
+
+   private:
+    /**
+     * Evenly spaced samples of a function of a single variable, which approximates the
+     * function between the first and last sample by linearly interpolating between the
+     * two samples closest to a value
+     */
+    class SampledFunction
+    {
+       public:
+        /**
+         * Samples the given function from min to (at least) max
+         *
+         * @param min The value of the first sample
+         * @param max The value that the samples must cover
+         * @param resolution The distance between neighbouring samples
+         * @param function The function to sample
+         */
+        template <typename Function>
+        explicit SampledFunction(double min, double max, double resolution,
+                                 Function function);
+
+        /**
+         * Interpolates the function at the given value, which is clamped to the
+         * sampled range
+         *
+         * @param v The value to interpolate the function at
+         * @param d_dv Is set to the derivative of the interpolation at v
+         *
+         * @return The interpolated value of the function
+         */
+        double interpolate(double v, double& d_dv) const;
+
+       private:
+        double min;
+        double resolution;
+        std::vector<double> samples;
+    };
+
+    /**
+     * Interpolates the static position quality at the given point, along with its
+     * partial derivatives
+     *
+     * @param x The x coordinate of the point
+     * @param y The y coordinate of the point
+     * @param d_dx Is set to the partial derivative of the interpolation with respect
+     * to x
+     * @param d_dy Is set to the partial derivative of the interpolation with respect
+     * to y
+     *
+     * @return The interpolated static position quality
+     */
+    double interpolate(double x, double y, double& d_dx, double& d_dy) const;
+
+    Rectangle field_boundary;
+    Point friendly_goal_center;
+
+    SampledFunction on_field_x_quality;
+    SampledFunction on_field_y_quality;
+    SampledFunction in_enemy_defense_area_x;
+    SampledFunction in_enemy_defense_area_y;
+    SampledFunction near_friendly_goal_quality;
+};
+
+template <typename Function>
+StaticPositionQualityGrid::SampledFunction::SampledFunction(double min, double max,
+                                                            double resolution,
+                                                            Function function)
+    : min(min), resolution(resolution)
+{
+    const size_t num_samples =
+        static_cast<size_t>(std::ceil((max - min) / resolution)) + 1;
+    samples.reserve(num_samples);
+    for (size_t i = 0; i < num_samples; i++)
+    {
+        samples.push_back(function(min + static_cast<double>(i) * resolution));
+    }
+}
+
+template <size_t NUM_PARAMS>
+DualNumber<NUM_PARAMS> StaticPositionQualityGrid::interpolate(
+    const DualNumber<NUM_PARAMS>& x, const DualNumber<NUM_PARAMS>& y) const
+{
+    double d_dx;
+    double d_dy;
+    const double value = interpolate(x.value(), y.value(), d_dx, d_dy);
+
+    typename DualNumber<NUM_PARAMS>::GradientArray gradient;
+    for (size_t i = 0; i < NUM_PARAMS; i++)
+    {
+        gradient[i] = d_dx * x.gradient()[i] + d_dy * y.gradient()[i];
+    }
+    return DualNumber<NUM_PARAMS>(value, gradient);
+}
@@ -0,0 +1,95 @@
+#include "software/ai/passing/static_position_quality_grid.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+
+#include "software/ai/passing/cost_function.h"
+
+class StaticPositionQualityGridTest : public testing::Test
+{
+   protected:
+    StaticPositionQualityGridTest() : field(Field::createSSLDivisionBField()) {}
+
+    Field field;
+    TbotsProto::PassingConfig passing_config;
+};
+
+TEST_F(StaticPositionQualityGridTest, interpolates_static_position_quality)
+{
+    StaticPositionQualityGrid grid(field, passing_config);
+    std::mt19937 random_num_gen(13);
+    std::uniform_real_distribution x_distribution(-field.totalXLength() / 2,
+                                                  field.totalXLength() / 2);
+    std::uniform_real_distribution y_distribution(-field.totalYLength() / 2,
+                                                  field.totalYLength() / 2);
+
+    double total_error = 0.0;
+    const int num_points = 10000;
+    for (int i = 0; i < num_points; i++)
+    {
+        const Point point(x_distribution(random_num_gen), y_distribution(random_num_gen));
+        ASSERT_TRUE(grid.contains(point.x(), point.y())) << point;
+        const double error =
+            std::abs(grid.interpolate(point.x(), point.y()) -
+                     getStaticPositionQuality(field, point, passing_config));
+        EXPECT_LT(error, 0.01) << point;
+        total_error += error;
+    }
+    EXPECT_LT(total_error / num_points, 1e-3);
+}
+
+TEST_F(StaticPositionQualityGridTest, interpolates_static_position_quality_for_config)
+{
+    passing_config.set_static_field_position_quality_x_offset(0.6);
+    passing_config.set_static_field_position_quality_y_offset(0.1);
+    passing_config.set_static_field_position_quality_friendly_goal_distance_weight(0.8);
+    StaticPositionQualityGrid grid(field, passing_config);
+
+    for (const Point& point : {Point(4.2, 0), Point(0, 2.9), Point(-3.9, 0.3),
+                               Point(-4.5, 0), Point(1.0, -1.0)})
+    {
+        EXPECT_NEAR(grid.interpolate(point.x(), point.y()),
+                    getStaticPositionQuality(field, point, passing_config), 0.01)
+            << point;
+    }
+}
+
+TEST_F(StaticPositionQualityGridTest, does_not_contain_points_outside_field_boundary)
+{
+    StaticPositionQualityGrid grid(field, passing_config);
+
+    EXPECT_TRUE(grid.contains(field.totalXLength() / 2, field.totalYLength() / 2));
+    EXPECT_TRUE(grid.contains(-field.totalXLength() / 2, -field.totalYLength() / 2));
+    EXPECT_FALSE(grid.contains(field.totalXLength() / 2 + 0.1, 0));
+    EXPECT_FALSE(grid.contains(0, -field.totalYLength() / 2 - 0.1));
+}
+
+TEST_F(StaticPositionQualityGridTest, dual_interpolation_has_gradient_of_interpolation)
+{
+    using Dual = DualNumber<2>;
+    StaticPositionQualityGrid grid(field, passing_config);
+    const double step = 1e-7;
+
+    for (const Point& point :
+         {Point(4.3037, 1.9061), Point(-1.2345, 0.5678), Point(3.5042, 0.9033)})
+    {
+        const Dual quality = grid.interpolate(Dual::parameter(point.x(), 0),
+                                              Dual::parameter(point.y(), 1));
+
+        EXPECT_DOUBLE_EQ(quality.value(), grid.interpolate(point.x(), point.y()));
+        EXPECT_NEAR(quality.gradient()[0],
+                    (grid.interpolate(point.x() + step, point.y()) -
+                     grid.interpolate(point.x() - step, point.y())) /
+                        (2 * step),
+                    1e-5)
+            << point;
+        EXPECT_NEAR(quality.gradient()[1],
+                    (grid.interpolate(point.x(), point.y() + step) -
+                     grid.interpolate(point.x(), point.y() - step)) /
+                        (2 * step),
+                    1e-5)
+            << point;
+    }
+}
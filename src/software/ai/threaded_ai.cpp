@@ -10,9 +10,9 @@
 #include "software/multithreading/thread_safe_buffer.hpp"
 
 ThreadedAi::ThreadedAi(const TbotsProto::AiConfig& ai_config)
-    // Disabling warnings on log buffer full, since buffer size is 1 and we
-    // always want AI to use the latest World
-    : FirstInFirstOutThreadedObserver<World>(),
+    // The AI always uses the latest World, so Worlds received while it is running are
+    // dropped without logging that the buffer is full
+    : LatestValueThreadedObserver<WorldPtr>(),
       FirstInFirstOutThreadedObserver<TbotsProto::ThunderbotsConfig>(),
       ai(ai_config),
       ai_config(ai_config),
@@ -47,9 +47,8 @@ void ThreadedAi::overrideTactics(
     LOG(VISUALIZE) << ai.getPlayInfo();
 }
 
-void ThreadedAi::onValueReceived(World world)
+void ThreadedAi::onValueReceived(WorldPtr world_ptr)
 {
-    WorldPtr world_ptr = std::make_shared<World>(world);
     runAiAndSendPrimitives(world_ptr);
 }
 
@@ -70,6 +69,12 @@ void ThreadedAi::runAiAndSendPrimitives(const WorldPtr& world_ptr)
     if (ai_control_config.run_ai())
     {
         auto new_primitives = ai.getPrimitives(world_ptr);
+        new_primitives->set_world_age_seconds(
+            std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                          world_ptr->getCreationTime())
+                .count());
+        new_primitives->set_num_skipped_worlds(
+            static_cast<unsigned int>(getNumValuesDropped()));
 
         TbotsProto::PlayInfo play_info_msg = ai.getPlayInfo();
 
@@ -9,6 +9,7 @@
 #include "proto/tbots_software_msgs.pb.h"
 #include "software/ai/ai.h"
 #include "software/multithreading/first_in_first_out_threaded_observer.h"
+#include "software/multithreading/latest_value_threaded_observer.h"
 #include "software/multithreading/subject.hpp"
 #include "software/world/world.h"
 
@@ -16,8 +17,11 @@
  * This class wraps an `AI` object, performing all the work of receiving World
  * objects, passing them to the `AI`, getting the primitives to send to the
  * robots based on the World state, and sending them out.
+ *
+ * The AI always runs on the newest World, skipping any Worlds that arrive while it is
+ * still running on an older one, so that its latency stays bounded under load.
  */
-class ThreadedAi : public FirstInFirstOutThreadedObserver<World>,
+class ThreadedAi : public LatestValueThreadedObserver<WorldPtr>,
                    public FirstInFirstOutThreadedObserver<TbotsProto::ThunderbotsConfig>,
                    public Subject<TbotsProto::PrimitiveSet>,
                    public Subject<TbotsProto::PlayInfo>
@@ -48,7 +52,7 @@ class ThreadedAi : public FirstInFirstOutThreadedObserver<World>,
         TbotsProto::AssignedTacticPlayControlParams assigned_tactic_play_control_params);
 
    private:
-    void onValueReceived(World world) override;
+    void onValueReceived(WorldPtr world_ptr) override;
     void onValueReceived(TbotsProto::ThunderbotsConfig config) override;
 
     /**
@@ -2,7 +2,7 @@
 
 #include "proto/sensor_msg.pb.h"
 #include "proto/tbots_software_msgs.pb.h"
-#include "software/multithreading/first_in_first_out_threaded_observer.h"
+#include "software/multithreading/latest_value_threaded_observer.h"
 #include "software/multithreading/subject.hpp"
 #include "software/world/world.h"
 
@@ -12,11 +12,13 @@
  * sent to the robots.
  *
  * This produce/consume pattern is performed by extending both "Observer" and
- * "Subject". Please see the implementation of those classes for details.
+ * "Subject". Please see the implementation of those classes for details. Since a
+ * newer World or set of primitives replaces an older one, only the newest of each is
+ * consumed.
  */
 class Backend : public Subject<SensorProto>,
-                public FirstInFirstOutThreadedObserver<World>,
-                public FirstInFirstOutThreadedObserver<TbotsProto::PrimitiveSet>
+                public LatestValueThreadedObserver<WorldPtr>,
+                public LatestValueThreadedObserver<TbotsProto::PrimitiveSet>
 {
    public:
     Backend() = default;
@@ -78,20 +78,26 @@ void UnixSimulatorBackend::onValueReceived(TbotsProto::PrimitiveSet primitives)
 
     LOG(VISUALIZE) << *createNamedValue(
         "Primitive Hz",
-        static_cast<float>(FirstInFirstOutThreadedObserver<
+        static_cast<float>(LatestValueThreadedObserver<
                            TbotsProto::PrimitiveSet>::getDataReceivedPerSecond()));
+    LOG(VISUALIZE) << *createNamedValue(
+        "AI World Age ms",
+        static_cast<float>(primitives.world_age_seconds() * MILLISECONDS_PER_SECOND));
+    LOG(VISUALIZE) << *createNamedValue(
+        "AI Skipped Worlds", static_cast<float>(primitives.num_skipped_worlds()));
 }
 
-void UnixSimulatorBackend::onValueReceived(World world)
+void UnixSimulatorBackend::onValueReceived(WorldPtr world_ptr)
 {
-    world_output->sendProto(*createWorldWithSequenceNumber(world, sequence_number++));
+    world_output->sendProto(
+        *createWorldWithSequenceNumber(*world_ptr, sequence_number++));
 
     LOG(VISUALIZE) << *createNamedValue(
         "World Hz",
         static_cast<float>(
-            FirstInFirstOutThreadedObserver<World>::getDataReceivedPerSecond()));
+            LatestValueThreadedObserver<WorldPtr>::getDataReceivedPerSecond()));
 
-    last_world_time_sec.store(world.getMostRecentTimestamp().toSeconds());
+    last_world_time_sec.store(world_ptr->getMostRecentTimestamp().toSeconds());
 }
 
 double UnixSimulatorBackend::getLastWorldTimeSec()
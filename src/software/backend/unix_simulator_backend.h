@@ -33,7 +33,7 @@ class UnixSimulatorBackend : public Backend, public Subject<TbotsProto::Thunderb
    private:
     void receiveThunderbotsConfig(TbotsProto::ThunderbotsConfig request);
     void onValueReceived(TbotsProto::PrimitiveSet primitives) override;
-    void onValueReceived(World world) override;
+    void onValueReceived(WorldPtr world_ptr) override;
 
     // ThreadedProtoUnix** to communicate with Thunderscope
     // Inputs
@@ -0,0 +1,175 @@
+#include "software/geom/angular_sweep.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "software/geom/geom_constants.h"
+
+AngularSweep::AngularSweep(size_t reserved_num_intervals)
+    : range_top(0.0), range_bottom(0.0), num_intervals_added(0)
+{
+    blocked_tops.reserve(reserved_num_intervals);
+    blocked_bottoms.reserve(reserved_num_intervals);
+    blocked_indices.reserve(reserved_num_intervals);
+}
+
+AngularSweep &AngularSweep::getThreadLocalSweep()
+{
+    thread_local AngularSweep sweep;
+    return sweep;
+}
+
+void AngularSweep::reset(double top_angle, double bottom_angle)
+{
+    range_top           = top_angle;
+    range_bottom        = bottom_angle;
+    num_intervals_added = 0;
+    blocked_tops.clear();
+    blocked_bottoms.clear();
+    blocked_indices.clear();
+}
+
+size_t AngularSweep::addBlockedInterval(double top_angle, double bottom_angle)
+{
+    const size_t index = num_intervals_added++;
+    if (bottom_angle > range_top || top_angle < range_bottom)
+    {
+        return index;
+    }
+
+    // Insertion sort by descending top angle. Intervals with equal top angles stay in
+    // the order they were added, like a stable sort.
+    size_t position = blocked_tops.size();
+    blocked_tops.push_back(top_angle);
+    blocked_bottoms.push_back(bottom_angle);
+    blocked_indices.push_back(index);
+    while (position > 0 && blocked_tops[position - 1] < top_angle)
+    {
+        blocked_tops[position]    = blocked_tops[position - 1];
+        blocked_bottoms[position] = blocked_bottoms[position - 1];
+        blocked_indices[position] = blocked_indices[position - 1];
+        position--;
+    }
+    blocked_tops[position]    = top_angle;
+    blocked_bottoms[position] = bottom_angle;
+    blocked_indices[position] = index;
+    return index;
+}
+
+OpenAngularInterval AngularSweep::getBiggestOpenInterval() const
+{
+    if (blocked_tops.empty())
+    {
+        return OpenAngularInterval{range_top, range_bottom, std::nullopt, std::nullopt};
+    }
+
+    // Since the blocked intervals are sorted by descending top angle, each one either
+    // overlaps the run of intervals before it or starts a new run below it, so the
+    // gaps between runs can be found in one pass without merging anything
+    OpenAngularInterval biggest_gap{0.0, 0.0, std::nullopt, std::nullopt};
+    double run_bottom       = blocked_bottoms.front();
+    size_t run_bottom_index = blocked_indices.front();
+    for (size_t i = 1; i < blocked_tops.size(); i++)
+    {
+        if (blocked_tops[i] >= run_bottom)
+        {
+            if (blocked_bottoms[i] < run_bottom)
+            {
+                run_bottom       = blocked_bottoms[i];
+                run_bottom_index = blocked_indices[i];
+            }
+            continue;
+        }
+
+        const OpenAngularInterval gap{run_bottom, blocked_tops[i], run_bottom_index,
+                                      blocked_indices[i]};
+        if (gap.size() > biggest_gap.size())
+        {
+            biggest_gap = gap;
+        }
+        run_bottom       = blocked_bottoms[i];
+        run_bottom_index = blocked_indices[i];
+    }
+
+    // The gaps next to the ends of the range are preferred over a gap between blocked
+    // intervals of the same size, the same way AngleMap prefers them
+    OpenAngularInterval biggest{0.0, 0.0, std::nullopt, std::nullopt};
+    if (blocked_tops.front() < range_top)
+    {
+        biggest = OpenAngularInterval{range_top, blocked_tops.front(), std::nullopt,
+                                      blocked_indices.front()};
+    }
+    if (run_bottom > range_bottom)
+    {
+        const OpenAngularInterval bottom_gap{run_bottom, range_bottom, run_bottom_index,
+                                             std::nullopt};
+        if (bottom_gap.size() > biggest.size())
+        {
+            biggest = bottom_gap;
+        }
+    }
+    if (biggest_gap.size() > biggest.size())
+    {
+        biggest = biggest_gap;
+    }
+    return biggest;
+}
+
+void AngularSweep::calculateObstacleEdges(double origin_x, double origin_y,
+                                          double obstacle_x, double obstacle_y,
+                                          double obstacle_radius, double &top_angle,
+                                          double &bottom_angle)
+{
+    // Same as (obstacle - origin).perpendicular().normalize(radius), added to and
+    // subtracted from the vector to the obstacle
+    const double to_obstacle_x = obstacle_x - origin_x;
+    const double to_obstacle_y = obstacle_y - origin_y;
+    const double length =
+        std::sqrt(to_obstacle_x * to_obstacle_x + to_obstacle_y * to_obstacle_y);
+    const double scale = length < 2 * FIXED_EPSILON ? 0.0 : obstacle_radius / length;
+    top_angle          = std::atan2(to_obstacle_y + to_obstacle_x * scale,
+                                    to_obstacle_x - to_obstacle_y * scale);
+    bottom_angle       = std::atan2(to_obstacle_y - to_obstacle_x * scale,
+                                    to_obstacle_x + to_obstacle_y * scale);
+}
+
+void AngularSweep::calculateBiggestOpenAngles(
+    const std::vector<double> &origin_x, const std::vector<double> &origin_y,
+    double target_top_x, double target_top_y, double target_bottom_x,
+    double target_bottom_y, const std::vector<double> &obstacle_x,
+    const std::vector<double> &obstacle_y, double obstacle_radius,
+    std::vector<double> &open_angles)
+{
+    const size_t num_origins   = origin_x.size();
+    const size_t num_obstacles = obstacle_x.size();
+
+    // Find the edges of each obstacle from every origin first, one obstacle at a time,
+    // so that each obstacle's position and radius are loaded once for all the origins
+    // and the edges can then be read back in order for each origin
+    edge_tops.resize(num_obstacles * num_origins);
+    edge_bottoms.resize(num_obstacles * num_origins);
+    for (size_t k = 0; k < num_obstacles; k++)
+    {
+        double *tops    = edge_tops.data() + k * num_origins;
+        double *bottoms = edge_bottoms.data() + k * num_origins;
+        for (size_t i = 0; i < num_origins; i++)
+        {
+            calculateObstacleEdges(origin_x[i], origin_y[i], obstacle_x[k],
+                                   obstacle_y[k], obstacle_radius, tops[i],
+                                   bottoms[i]);
+        }
+    }
+
+    open_angles.resize(num_origins);
+    for (size_t i = 0; i < num_origins; i++)
+    {
+        reset(std::atan2(target_top_y - origin_y[i], target_top_x - origin_x[i]),
+              std::atan2(target_bottom_y - origin_y[i], target_bottom_x - origin_x[i]));
+        for (size_t k = 0; k < num_obstacles; k++)
+        {
+            addBlockedInterval(edge_tops[k * num_origins + i],
+                               edge_bottoms[k * num_origins + i]);
+        }
+        open_angles[i] = getBiggestOpenInterval().size();
+    }
+}
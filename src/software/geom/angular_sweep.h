@@ -0,0 +1,165 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+/**
+ * An open angular interval found by an AngularSweep, with angles in radians
+ */
+struct OpenAngularInterval
+{
+    // The most positive angle of the interval
+    double top = 0.0;
+
+    // The most negative angle of the interval
+    double bottom = 0.0;
+
+    // The index of the blocked interval whose bottom forms the top edge of this
+    // interval, or std::nullopt if the top edge is the top of the range
+    std::optional<size_t> top_edge_index;
+
+    // The index of the blocked interval whose top forms the bottom edge of this
+    // interval, or std::nullopt if the bottom edge is the bottom of the range
+    std::optional<size_t> bottom_edge_index;
+
+    /**
+     * Gets the size of this interval
+     *
+     * @return the absolute difference between the top and bottom angles, in radians
+     */
+    double size() const
+    {
+        return std::abs(top - bottom);
+    }
+};
+
+/**
+ * Finds the biggest open interval within a range of angles, given a set of blocked
+ * intervals, such as the biggest open angle to a goal between obstacles.
+ *
+ * This finds the same intervals as an AngleMap that is given the blocked intervals in
+ * descending order of their top angle, but works on raw angles in radians and keeps
+ * its buffers between uses, so that once it is warmed up, sweeping does not allocate.
+ * Blocked intervals are kept sorted by insertion sort as they are added, which is
+ * faster than a comparator sort for the handful of obstacles on a field.
+ *
+ * Angles go from pi -> 0 -> -pi and intervals must not wrap around pi, so callers
+ * should sweep in a frame where the range faces towards +x.
+ *
+ * A sweep can also find the open angle to a segment from many origins at once,
+ * sharing the work of finding the edges of the obstacles between all of the origins.
+ */
+class AngularSweep
+{
+   public:
+    /**
+     * Creates a sweep over an empty range
+     *
+     * @param reserved_num_intervals the number of blocked intervals to reserve space for
+     */
+    explicit AngularSweep(size_t reserved_num_intervals = 0);
+
+    /**
+     * Gets a sweep that is only used by the calling thread, so that callers can reuse
+     * its buffers without synchronization
+     *
+     * @return the sweep for the calling thread
+     */
+    static AngularSweep &getThreadLocalSweep();
+
+    /**
+     * Removes all blocked intervals and sets the range to sweep over
+     *
+     * @param top_angle the most positive angle of the range, in radians
+     * @param bottom_angle the most negative angle of the range, in radians
+     */
+    void reset(double top_angle, double bottom_angle);
+
+    /**
+     * Blocks an interval of angles. Intervals that lie completely outside the range are
+     * ignored, but still count towards the index of the next interval.
+     *
+     * @param top_angle the most positive angle of the blocked interval, in radians
+     * @param bottom_angle the most negative angle of the blocked interval, in radians
+     *
+     * @return the index of the blocked interval, counting from 0 since the last reset
+     */
+    size_t addBlockedInterval(double top_angle, double bottom_angle);
+
+    /**
+     * Gets the biggest interval within the range that no blocked interval overlaps.
+     * If the range is completely blocked, the interval has a size of zero.
+     *
+     * @return the biggest open interval
+     */
+    OpenAngularInterval getBiggestOpenInterval() const;
+
+    /**
+     * Calculates the size of the biggest open angle to a target segment, from each of
+     * the given origins, with circular obstacles in the way. This is the same as
+     * resetting the range to the angles of the ends of the target, blocking the angles
+     * covered by each obstacle and getting the biggest open interval, once per origin.
+     *
+     * The edges of the obstacles are calculated for every origin at once, obstacle by
+     * obstacle, before any of the origins are swept.
+     *
+     * @param origin_x the x coordinates of the origins
+     * @param origin_y the y coordinates of the origins, one per origin
+     * @param target_top_x the x coordinate of the end of the target that is at the top
+     * of the range
+     * @param target_top_y the y coordinate of the end of the target that is at the top
+     * of the range
+     * @param target_bottom_x the x coordinate of the end of the target that is at the
+     * bottom of the range
+     * @param target_bottom_y the y coordinate of the end of the target that is at the
+     * bottom of the range
+     * @param obstacle_x the x coordinates of the centres of the obstacles
+     * @param obstacle_y the y coordinates of the centres of the obstacles
+     * @param obstacle_radius the radius of every obstacle
+     * @param open_angles is set to the size of the biggest open angle from each origin,
+     * in radians
+     */
+    void calculateBiggestOpenAngles(const std::vector<double> &origin_x,
+                                    const std::vector<double> &origin_y,
+                                    double target_top_x, double target_top_y,
+                                    double target_bottom_x, double target_bottom_y,
+                                    const std::vector<double> &obstacle_x,
+                                    const std::vector<double> &obstacle_y,
+                                    double obstacle_radius,
+                                    std::vector<double> &open_angles);
+
+    /**
+     * Calculates the angles of the edges of a circular obstacle as seen from an origin,
+     * the same way that calculateBiggestOpenAngles calculates them
+     *
+     * @param origin_x the x coordinate of the origin
+     * @param origin_y the y coordinate of the origin
+     * @param obstacle_x the x coordinate of the centre of the obstacle
+     * @param obstacle_y the y coordinate of the centre of the obstacle
+     * @param obstacle_radius the radius of the obstacle
+     * @param top_angle is set to the angle of the counterclockwise edge, in radians
+     * @param bottom_angle is set to the angle of the clockwise edge, in radians
+     */
+    static void calculateObstacleEdges(double origin_x, double origin_y,
+                                       double obstacle_x, double obstacle_y,
+                                       double obstacle_radius, double &top_angle,
+                                       double &bottom_angle);
+
+   private:
+    double range_top;
+    double range_bottom;
+    size_t num_intervals_added;
+
+    // The blocked intervals that overlap the range, sorted by descending top angle,
+    // along with the index each was added with
+    std::vector<double> blocked_tops;
+    std::vector<double> blocked_bottoms;
+    std::vector<size_t> blocked_indices;
+
+    // The edges of every obstacle as seen from every origin in
+    // calculateBiggestOpenAngles, stored obstacle by obstacle
+    std::vector<double> edge_tops;
+    std::vector<double> edge_bottoms;
+};
@@ -0,0 +1,175 @@
+#include "software/geom/angular_sweep.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include "software/geom/angle_map.h"
+
+TEST(AngularSweepTest, empty_sweep_is_open_over_whole_range)
+{
+    AngularSweep sweep;
+    sweep.reset(0.5, -0.25);
+
+    const OpenAngularInterval interval = sweep.getBiggestOpenInterval();
+    EXPECT_DOUBLE_EQ(interval.top, 0.5);
+    EXPECT_DOUBLE_EQ(interval.bottom, -0.25);
+    EXPECT_DOUBLE_EQ(interval.size(), 0.75);
+    EXPECT_FALSE(interval.top_edge_index);
+    EXPECT_FALSE(interval.bottom_edge_index);
+}
+
+TEST(AngularSweepTest, interval_covering_whole_range_blocks_it)
+{
+    AngularSweep sweep;
+    sweep.reset(0.5, -0.25);
+    sweep.addBlockedInterval(1.0, -1.0);
+
+    EXPECT_EQ(sweep.getBiggestOpenInterval().size(), 0.0);
+}
+
+TEST(AngularSweepTest, intervals_outside_range_are_ignored_but_counted)
+{
+    AngularSweep sweep;
+    sweep.reset(0.5, -0.5);
+
+    EXPECT_EQ(sweep.addBlockedInterval(1.0, 0.75), 0u);
+    EXPECT_EQ(sweep.addBlockedInterval(-0.75, -1.0), 1u);
+    EXPECT_EQ(sweep.addBlockedInterval(0.1, -0.3), 2u);
+
+    const OpenAngularInterval interval = sweep.getBiggestOpenInterval();
+    EXPECT_DOUBLE_EQ(interval.top, 0.5);
+    EXPECT_DOUBLE_EQ(interval.bottom, 0.1);
+    EXPECT_FALSE(interval.top_edge_index);
+    EXPECT_EQ(interval.bottom_edge_index, 2u);
+}
+
+TEST(AngularSweepTest, finds_gap_between_overlapping_intervals_added_out_of_order)
+{
+    AngularSweep sweep;
+    sweep.reset(1.0, -1.0);
+
+    // Intervals 0 and 2 overlap, as do 1 and 3, leaving a gap from 0.2 to -0.4
+    sweep.addBlockedInterval(0.5, 0.3);
+    sweep.addBlockedInterval(-0.5, -0.8);
+    sweep.addBlockedInterval(0.95, 0.2);
+    sweep.addBlockedInterval(-0.4, -0.6);
+
+    const OpenAngularInterval interval = sweep.getBiggestOpenInterval();
+    EXPECT_DOUBLE_EQ(interval.top, 0.2);
+    EXPECT_DOUBLE_EQ(interval.bottom, -0.4);
+    EXPECT_EQ(interval.top_edge_index, 2u);
+    EXPECT_EQ(interval.bottom_edge_index, 3u);
+}
+
+TEST(AngularSweepTest, reset_clears_blocked_intervals)
+{
+    AngularSweep sweep;
+    sweep.reset(1.0, -1.0);
+    sweep.addBlockedInterval(1.0, -1.0);
+    sweep.reset(1.0, -1.0);
+
+    EXPECT_DOUBLE_EQ(sweep.getBiggestOpenInterval().size(), 2.0);
+    EXPECT_EQ(sweep.addBlockedInterval(0.0, -0.1), 0u);
+}
+
+TEST(AngularSweepTest, matches_sorted_angle_map)
+{
+    std::mt19937 random_num_gen(7);
+    std::uniform_real_distribution angle_distribution(-1.5, 1.5);
+    std::uniform_real_distribution width_distribution(0.0, 0.4);
+    std::uniform_int_distribution num_intervals_distribution(0, 12);
+
+    AngularSweep sweep;
+    for (int trial = 0; trial < 1000; trial++)
+    {
+        const double range_top    = angle_distribution(random_num_gen);
+        const double range_bottom = range_top - 2 * width_distribution(random_num_gen);
+        sweep.reset(range_top, range_bottom);
+
+        std::vector<AngleSegment> obstacles;
+        const int num_intervals = num_intervals_distribution(random_num_gen);
+        for (int i = 0; i < num_intervals; i++)
+        {
+            const double top    = angle_distribution(random_num_gen);
+            const double bottom = top - width_distribution(random_num_gen);
+            sweep.addBlockedInterval(top, bottom);
+            if (!(bottom > range_top || top < range_bottom))
+            {
+                obstacles.emplace_back(Angle::fromRadians(top),
+                                       Angle::fromRadians(bottom));
+            }
+        }
+
+        // This is how calcBestShotOnGoal used the AngleMap
+        AngleMap angle_map(Angle::fromRadians(range_top),
+                           Angle::fromRadians(range_bottom), obstacles.size());
+        std::stable_sort(obstacles.begin(), obstacles.end(),
+                         [](const AngleSegment &a, const AngleSegment &b) {
+                             return a > b;
+                         });
+        for (AngleSegment &obstacle : obstacles)
+        {
+            angle_map.addNonViableAngleSegment(obstacle);
+        }
+
+        const AngleSegment expected = angle_map.getBiggestViableAngleSegment();
+        const OpenAngularInterval interval = sweep.getBiggestOpenInterval();
+        EXPECT_DOUBLE_EQ(interval.top, expected.getAngleTop().toRadians());
+        EXPECT_DOUBLE_EQ(interval.bottom, expected.getAngleBottom().toRadians());
+    }
+}
+
+TEST(AngularSweepTest, batch_matches_sweeping_each_origin)
+{
+    const std::vector<double> obstacle_x = {4.0, 3.7, 2.0, 0.0};
+    const std::vector<double> obstacle_y = {0.2, -0.3, 1.0, 0.0};
+    const double radius                  = 0.09;
+
+    std::vector<double> origin_x;
+    std::vector<double> origin_y;
+    for (double x = -4.0; x <= 4.0; x += 0.37)
+    {
+        for (double y = -2.5; y <= 2.5; y += 0.41)
+        {
+            origin_x.push_back(x);
+            origin_y.push_back(y);
+        }
+    }
+
+    AngularSweep sweep;
+    std::vector<double> open_angles;
+    sweep.calculateBiggestOpenAngles(origin_x, origin_y, 4.5, 0.5, 4.5, -0.5,
+                                     obstacle_x, obstacle_y, radius, open_angles);
+    ASSERT_EQ(open_angles.size(), origin_x.size());
+
+    for (size_t i = 0; i < origin_x.size(); i++)
+    {
+        sweep.reset(std::atan2(0.5 - origin_y[i], 4.5 - origin_x[i]),
+                    std::atan2(-0.5 - origin_y[i], 4.5 - origin_x[i]));
+        for (size_t k = 0; k < obstacle_x.size(); k++)
+        {
+            double top_angle    = 0.0;
+            double bottom_angle = 0.0;
+            AngularSweep::calculateObstacleEdges(origin_x[i], origin_y[i],
+                                                 obstacle_x[k], obstacle_y[k], radius,
+                                                 top_angle, bottom_angle);
+            sweep.addBlockedInterval(top_angle, bottom_angle);
+        }
+        EXPECT_EQ(open_angles[i], sweep.getBiggestOpenInterval().size())
+            << "(" << origin_x[i] << ", " << origin_y[i] << ")";
+    }
+}
+
+TEST(AngularSweepTest, obstacle_edges_are_tangent_directions)
+{
+    double top_angle    = 0.0;
+    double bottom_angle = 0.0;
+    AngularSweep::calculateObstacleEdges(0.0, 0.0, 1.0, 0.0, 0.5, top_angle,
+                                         bottom_angle);
+
+    // The edges are the ends of the diameter perpendicular to the obstacle
+    EXPECT_DOUBLE_EQ(top_angle, std::atan2(0.5, 1.0));
+    EXPECT_DOUBLE_EQ(bottom_angle, std::atan2(-0.5, 1.0));
+}
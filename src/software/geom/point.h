@@ -31,7 +31,7 @@ class Point final
      *
      * @param the Point to duplicate
      */
-    Point(const Point &p);
+    Point(const Point &p) = default;
 
     /**
      * Creates a new Point from a Vector
@@ -107,7 +107,7 @@ class Point final
      *
      * @return this Point
      */
-    Point &operator=(const Point &other);
+    Point &operator=(const Point &other) = default;
 
    private:
     /**
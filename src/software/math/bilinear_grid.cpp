@@ -0,0 +1,83 @@
+#include "software/math/bilinear_grid.h"
+
+#include <algorithm>
+#include <cmath>
+
+BilinearGrid::BilinearGrid(const Rectangle& area, double resolution)
+    : resolution_(resolution),
+      min_x(area.xMin()),
+      min_y(area.yMin()),
+      num_x_samples(static_cast<size_t>(std::ceil(area.xLength() / resolution)) + 1),
+      num_y_samples(static_cast<size_t>(std::ceil(area.yLength() / resolution)) + 1),
+      samples(num_x_samples * num_y_samples, 0.0f)
+{
+}
+
+size_t BilinearGrid::numXSamples() const
+{
+    return num_x_samples;
+}
+
+size_t BilinearGrid::numYSamples() const
+{
+    return num_y_samples;
+}
+
+double BilinearGrid::resolution() const
+{
+    return resolution_;
+}
+
+double BilinearGrid::sampleX(size_t i) const
+{
+    return min_x + static_cast<double>(i) * resolution_;
+}
+
+double BilinearGrid::sampleY(size_t j) const
+{
+    return min_y + static_cast<double>(j) * resolution_;
+}
+
+void BilinearGrid::setSample(size_t i, size_t j, double value)
+{
+    samples[j * num_x_samples + i] = static_cast<float>(value);
+}
+
+bool BilinearGrid::contains(double x, double y) const
+{
+    return x >= min_x && x <= sampleX(num_x_samples - 1) && y >= min_y &&
+           y <= sampleY(num_y_samples - 1);
+}
+
+double BilinearGrid::interpolate(double x, double y) const
+{
+    double d_dx;
+    double d_dy;
+    return interpolate(x, y, d_dx, d_dy);
+}
+
+double BilinearGrid::interpolate(double x, double y, double& d_dx, double& d_dy) const
+{
+    // Find the cell the point is in, clamping so that points on the max edges use the
+    // last cell rather than one past it
+    const double grid_x = (x - min_x) / resolution_;
+    const double grid_y = (y - min_y) / resolution_;
+    const size_t i =
+        std::min(static_cast<size_t>(std::max(grid_x, 0.0)), num_x_samples - 2);
+    const size_t j =
+        std::min(static_cast<size_t>(std::max(grid_y, 0.0)), num_y_samples - 2);
+    const double t_x = grid_x - static_cast<double>(i);
+    const double t_y = grid_y - static_cast<double>(j);
+
+    const double q00 = samples[j * num_x_samples + i];
+    const double q10 = samples[j * num_x_samples + i + 1];
+    const double q01 = samples[(j + 1) * num_x_samples + i];
+    const double q11 = samples[(j + 1) * num_x_samples + i + 1];
+
+    const double bottom = q00 + (q10 - q00) * t_x;
+    const double top    = q01 + (q11 - q01) * t_x;
+
+    d_dx = ((q10 - q00) * (1 - t_y) + (q11 - q01) * t_y) / resolution_;
+    d_dy = (top - bottom) / resolution_;
+    return bottom + (top - bottom) * t_y;
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "software/geom/rectangle.h"
+#include "software/optimization/dual_number.hpp"
+
+/**
+ * A grid of samples of a function over a rectangle, which approximates the function
+ * anywhere in the rectangle by bilinearly interpolating between the four samples
+ * closest to a point.
+ *
+ * Samples are spaced evenly in x and y, with the first sample at the negative x,
+ * negative y corner of the rectangle. The last row and column of samples are on or
+ * just past the positive edges of the rectangle, so the whole rectangle is covered.
+ */
+class BilinearGrid
+{
+   public:
+    BilinearGrid() = delete;
+
+    /**
+     * Creates a grid covering the given rectangle, with every sample set to 0
+     *
+     * @param area The rectangle to cover
+     * @param resolution The distance between neighbouring samples
+     */
+    explicit BilinearGrid(const Rectangle& area, double resolution);
+
+    size_t numXSamples() const;
+    size_t numYSamples() const;
+    double resolution() const;
+
+    /**
+     * Gets the coordinate of the samples in the given column or row
+     *
+     * @param i The index of the column
+     * @param j The index of the row
+     *
+     * @return The x coordinate of the samples in column i, or the y coordinate of the
+     * samples in row j
+     */
+    double sampleX(size_t i) const;
+    double sampleY(size_t j) const;
+
+    /**
+     * Sets the sample in the given column and row
+     *
+     * @param i The index of the column
+     * @param j The index of the row
+     * @param value The value of the sample
+     */
+    void setSample(size_t i, size_t j, double value);
+
+    /**
+     * Checks if the given point is covered by this grid
+     *
+     * @param x The x coordinate of the point
+     * @param y The y coordinate of the point
+     *
+     * @return true if the value at the point can be interpolated from this grid
+     */
+    bool contains(double x, double y) const;
+
+    /**
+     * Interpolates the value at the given point, which must be covered by this grid
+     *
+     * @param x The x coordinate of the point
+     * @param y The y coordinate of the point
+     *
+     * @return The interpolated value
+     */
+    double interpolate(double x, double y) const;
+
+    /**
+     * Interpolates the value at the given point, which must be covered by this grid,
+     * along with its gradient
+     *
+     * @param x The x coordinate of the point
+     * @param y The y coordinate of the point
+     *
+     * @return The interpolated value, carrying the gradient of the interpolation
+     */
+    template <size_t NUM_PARAMS>
+    DualNumber<NUM_PARAMS> interpolate(const DualNumber<NUM_PARAMS>& x,
+                                       const DualNumber<NUM_PARAMS>& y) const;
+
+   private:
+    /**
+     * Bilinearly interpolates the samples around the given point
+     *
+     * @param x The x coordinate of the point
+     * @param y The y coordinate of the point
+     * @param d_dx Is set to the partial derivative of the interpolation with respect
+     * to x
+     * @param d_dy Is set to the partial derivative of the interpolation with respect
+     * to y
+     *
+     * @return The interpolated value
+     */
+    double interpolate(double x, double y, double& d_dx, double& d_dy) const;
+
+    // The distance between neighbouring samples
+    double resolution_;
+
+    // The position of the first sample, and the number of samples in each dimension
+    double min_x;
+    double min_y;
+    size_t num_x_samples;
+    size_t num_y_samples;
+
+    // The samples, stored row by row, so the sample in column i and row j is
+    // samples[j * num_x_samples + i]. These are stored as floats to halve the size of
+    // the grid, since interpolation is far less precise than a float anyway.
+    std::vector<float> samples;
+};
+
+template <size_t NUM_PARAMS>
+DualNumber<NUM_PARAMS> BilinearGrid::interpolate(const DualNumber<NUM_PARAMS>& x,
+                                                 const DualNumber<NUM_PARAMS>& y) const
+{
+    double d_dx;
+    double d_dy;
+    const double value = interpolate(x.value(), y.value(), d_dx, d_dy);
+
+    typename DualNumber<NUM_PARAMS>::GradientArray gradient;
+    for (size_t i = 0; i < NUM_PARAMS; i++)
+    {
+        gradient[i] = d_dx * x.gradient()[i] + d_dy * y.gradient()[i];
+    }
+    return DualNumber<NUM_PARAMS>(value, gradient);
+}
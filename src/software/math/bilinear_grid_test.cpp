@@ -0,0 +1,72 @@
+#include "software/math/bilinear_grid.h"
+
+#include <gtest/gtest.h>
+
+class BilinearGridTest : public testing::Test
+{
+   protected:
+    BilinearGridTest() : grid(Rectangle(Point(-1.0, -0.5), Point(2.0, 1.0)), 0.25)
+    {
+        for (size_t i = 0; i < grid.numXSamples(); i++)
+        {
+            for (size_t j = 0; j < grid.numYSamples(); j++)
+            {
+                grid.setSample(i, j, f(grid.sampleX(i), grid.sampleY(j)));
+            }
+        }
+    }
+
+    /**
+     * A bilinear function, which the grid should reproduce exactly
+     */
+    static double f(double x, double y)
+    {
+        return 0.5 + 0.25 * x - 0.75 * y + 0.125 * x * y;
+    }
+
+    BilinearGrid grid;
+};
+
+TEST_F(BilinearGridTest, samples_cover_rectangle)
+{
+    EXPECT_EQ(grid.numXSamples(), 13u);
+    EXPECT_EQ(grid.numYSamples(), 7u);
+    EXPECT_DOUBLE_EQ(grid.sampleX(0), -1.0);
+    EXPECT_DOUBLE_EQ(grid.sampleX(12), 2.0);
+    EXPECT_DOUBLE_EQ(grid.sampleY(0), -0.5);
+    EXPECT_DOUBLE_EQ(grid.sampleY(6), 1.0);
+}
+
+TEST_F(BilinearGridTest, contains_points_in_rectangle)
+{
+    EXPECT_TRUE(grid.contains(-1.0, -0.5));
+    EXPECT_TRUE(grid.contains(2.0, 1.0));
+    EXPECT_TRUE(grid.contains(0.3, 0.1));
+    EXPECT_FALSE(grid.contains(-1.01, 0.0));
+    EXPECT_FALSE(grid.contains(0.0, 1.01));
+}
+
+TEST_F(BilinearGridTest, interpolates_bilinear_function_exactly)
+{
+    for (double x = -1.0; x <= 2.0; x += 0.17)
+    {
+        for (double y = -0.5; y <= 1.0; y += 0.13)
+        {
+            EXPECT_NEAR(grid.interpolate(x, y), f(x, y), 1e-6)
+                << "(" << x << ", " << y << ")";
+        }
+    }
+    EXPECT_NEAR(grid.interpolate(2.0, 1.0), f(2.0, 1.0), 1e-6);
+}
+
+TEST_F(BilinearGridTest, dual_interpolation_has_gradient_of_interpolation)
+{
+    using Dual = DualNumber<2>;
+
+    const Dual value =
+        grid.interpolate(Dual::parameter(0.3, 0), Dual::parameter(-0.2, 1));
+
+    EXPECT_NEAR(value.value(), f(0.3, -0.2), 1e-6);
+    EXPECT_NEAR(value.gradient()[0], 0.25 + 0.125 * -0.2, 1e-6);
+    EXPECT_NEAR(value.gradient()[1], -0.75 + 0.125 * 0.3, 1e-6);
+}
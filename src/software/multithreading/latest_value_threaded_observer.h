@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+#include "software/multithreading/threaded_observer.hpp"
+
+/**
+ * The general usage of this class should be to extend it, then override
+ * `onValueReceived` with whatever custom functionality should occur when a new value
+ * is received. This class will call `onValueReceived` with only the newest value in
+ * the internal buffer, dropping every value received before it, so a consumer that is
+ * slower than its producer never falls behind by more than one value.
+ *
+ * From within `onValueReceived`, subclasses can find out how many values were dropped
+ * in favour of the value being handled.
+ *
+ * @tparam T The type of object this class is observing
+ */
+template <typename T>
+class LatestValueThreadedObserver : public ThreadedObserver<T>
+{
+   public:
+    /**
+     * Creates a new LatestValueThreadedObserver. Since only the newest value is ever
+     * used, filling up the buffer is expected and is not logged.
+     *
+     * @param buffer_size size of the buffer
+     */
+    explicit LatestValueThreadedObserver<T>(
+        size_t buffer_size = Observer<T>::DEFAULT_BUFFER_SIZE)
+        : ThreadedObserver<T>(buffer_size, false),
+          num_values_dropped(0){};
+
+    std::optional<T> getNextValue(const Duration& max_wait_time) final override;
+
+   protected:
+    /**
+     * Gets the number of values that were dropped in favour of the value being handled
+     * by `onValueReceived`, since the value handled before it. This must only be
+     * called from `onValueReceived`.
+     *
+     * @return the number of values dropped
+     */
+    size_t getNumValuesDropped() const;
+
+   private:
+    // This is only accessed from the thread that pulls values from the buffer
+    size_t num_values_dropped;
+};
+
+template <typename T>
+std::optional<T> LatestValueThreadedObserver<T>::getNextValue(
+    const Duration& max_wait_time)
+{
+    std::optional<LatestBufferedValue<T>> latest_value =
+        this->popLatestReceivedValueAndDiscardOthers(max_wait_time);
+    if (!latest_value)
+    {
+        return std::nullopt;
+    }
+
+    num_values_dropped = latest_value->num_dropped_values;
+    return std::move(latest_value->value);
+}
+
+template <typename T>
+size_t LatestValueThreadedObserver<T>::getNumValuesDropped() const
+{
+    return num_values_dropped;
+}
@@ -0,0 +1,69 @@
+#include "software/multithreading/latest_value_threaded_observer.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace std::chrono_literals;
+
+class TestLatestValueThreadedObserver : public LatestValueThreadedObserver<int>
+{
+   public:
+    std::vector<int> received_values;
+    std::vector<size_t> num_values_dropped;
+
+   private:
+    void onValueReceived(int i) override
+    {
+        received_values.emplace_back(i);
+        num_values_dropped.emplace_back(getNumValuesDropped());
+
+        // sleep for a while so that values are received while this one is handled
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    }
+};
+
+TEST(LatestValueThreadedObserver, receiveValue)
+{
+    TestLatestValueThreadedObserver test_threaded_observer;
+
+    test_threaded_observer.receiveValue(83);
+
+    std::this_thread::sleep_for(1s);
+
+    EXPECT_EQ(test_threaded_observer.received_values, std::vector<int>({83}));
+    EXPECT_EQ(test_threaded_observer.num_values_dropped, std::vector<size_t>({0}));
+}
+
+TEST(LatestValueThreadedObserver, drops_values_received_while_handling_a_value)
+{
+    TestLatestValueThreadedObserver test_threaded_observer;
+
+    test_threaded_observer.receiveValue(1);
+    std::this_thread::sleep_for(50ms);
+
+    // These are received while the first value is still being handled, so only the
+    // newest of them is handled after it
+    for (int value : {2, 3, 4, 5})
+    {
+        test_threaded_observer.receiveValue(value);
+    }
+
+    std::this_thread::sleep_for(1s);
+
+    EXPECT_EQ(test_threaded_observer.received_values, std::vector<int>({1, 5}));
+    EXPECT_EQ(test_threaded_observer.num_values_dropped, std::vector<size_t>({0, 3}));
+}
+
+TEST(LatestValueThreadedObserver, destructor)
+{
+    // Because the destructor has to manage the internal thread to make sure it
+    // finishes, this test ensures that it actually can succeed
+
+    auto test_threaded_observer = std::make_shared<TestLatestValueThreadedObserver>();
+
+    test_threaded_observer->receiveValue(10);
+    test_threaded_observer->receiveValue(20);
+
+    test_threaded_observer.reset();
+}
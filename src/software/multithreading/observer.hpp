@@ -73,6 +73,24 @@ class Observer
      */
     virtual std::optional<T> popLeastRecentlyReceivedValue(Duration max_wait_time) final;
 
+    /**
+     * Pops the most recently received value and returns it, discarding every value
+     * received before it
+     *
+     * If no value is available, this will block until:
+     * - a value becomes available
+     * - the given amount of time is exceeded
+     * - the destructor of this class is called
+     *
+     * @param max_wait_time The maximum duration to wait for a new value before
+     *                      returning
+     *
+     * @return The value most recently added to the buffer, along with how many values
+     *         were dropped in favour of it, or std::nullopt if none is available
+     */
+    virtual std::optional<LatestBufferedValue<T>> popLatestReceivedValueAndDiscardOthers(
+        Duration max_wait_time) final;
+
     static constexpr size_t DEFAULT_BUFFER_SIZE = 1;
 
    private:
@@ -106,6 +124,13 @@ std::optional<T> Observer<T, Clock>::popLeastRecentlyReceivedValue(Duration max_
     return buffer.popLeastRecentlyAddedValue(max_wait_time);
 }
 
+template <typename T, typename Clock>
+std::optional<LatestBufferedValue<T>>
+Observer<T, Clock>::popLatestReceivedValueAndDiscardOthers(Duration max_wait_time)
+{
+    return buffer.popLatestValueAndDiscardOthers(max_wait_time);
+}
+
 template <typename T, typename Clock>
 double Observer<T, Clock>::getDataReceivedPerSecond()
 {
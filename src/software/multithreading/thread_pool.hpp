@@ -0,0 +1,156 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * A fixed-size pool of worker threads that run submitted tasks in the order that
+ * they were submitted.
+ *
+ * The pool is intended for short, independent, CPU bound tasks (ex. planning the
+ * trajectories of several robots at the same time). Tasks should not block waiting on
+ * other tasks submitted to the same pool, as that may deadlock once all workers are
+ * busy.
+ *
+ * It's public API is fully thread-safe (meaning that it can be accessed by
+ * multiple threads at the same time without issue)
+ */
+class ThreadPool
+{
+   public:
+    ThreadPool() = delete;
+
+    /**
+     * Creates a new ThreadPool and starts its worker threads
+     *
+     * @param num_threads The number of worker threads in the pool. At least one worker
+     * thread is always created.
+     */
+    explicit ThreadPool(std::size_t num_threads);
+
+    /**
+     * Finishes all tasks that have already been submitted, then stops and joins all
+     * worker threads
+     */
+    ~ThreadPool();
+
+    // Delete the copy and assignment operators because this class really shouldn't need
+    // them and we don't want to risk doing anything nasty with the internal
+    // multithreading this class uses
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool(const ThreadPool&)            = delete;
+
+    /**
+     * Queues the given task to be run on one of the worker threads
+     *
+     * @param task The task to run
+     *
+     * @return a future holding the result of the task, or the exception thrown by it
+     */
+    template <typename Task>
+    std::future<std::invoke_result_t<Task>> submit(Task&& task);
+
+    /**
+     * Gets the number of worker threads in this pool
+     *
+     * @return the number of worker threads
+     */
+    std::size_t size() const;
+
+   private:
+    /**
+     * Continuously pops tasks off of the task queue and runs them until the destructor
+     * of this class is called and the task queue is empty.
+     * This is intended to be run in a separate thread.
+     */
+    void continuouslyRunTasks();
+
+    std::mutex task_queue_mutex;
+    std::condition_variable task_available_cv;
+    std::queue<std::function<void()>> task_queue;
+
+    // This indicates if the destructor of this class has been called
+    bool in_destructor;
+
+    std::vector<std::thread> workers;
+};
+
+inline ThreadPool::ThreadPool(std::size_t num_threads) : in_destructor(false)
+{
+    num_threads = std::max<std::size_t>(num_threads, 1);
+    workers.reserve(num_threads);
+    for (std::size_t i = 0; i < num_threads; i++)
+    {
+        workers.emplace_back(&ThreadPool::continuouslyRunTasks, this);
+    }
+}
+
+inline ThreadPool::~ThreadPool()
+{
+    {
+        std::scoped_lock lock(task_queue_mutex);
+        in_destructor = true;
+    }
+    task_available_cv.notify_all();
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+template <typename Task>
+std::future<std::invoke_result_t<Task>> ThreadPool::submit(Task&& task)
+{
+    using ResultType = std::invoke_result_t<Task>;
+
+    // std::function requires a copyable callable, so the packaged_task is shared
+    auto packaged_task =
+        std::make_shared<std::packaged_task<ResultType()>>(std::forward<Task>(task));
+    std::future<ResultType> result = packaged_task->get_future();
+
+    {
+        std::scoped_lock lock(task_queue_mutex);
+        task_queue.emplace([packaged_task]() { (*packaged_task)(); });
+    }
+    task_available_cv.notify_one();
+
+    return result;
+}
+
+inline std::size_t ThreadPool::size() const
+{
+    return workers.size();
+}
+
+inline void ThreadPool::continuouslyRunTasks()
+{
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock lock(task_queue_mutex);
+            task_available_cv.wait(
+                lock, [this]() { return in_destructor || !task_queue.empty(); });
+
+            if (task_queue.empty())
+            {
+                // We're being destroyed and there's no work left to do
+                return;
+            }
+
+            task = std::move(task_queue.front());
+            task_queue.pop();
+        }
+        task();
+    }
+}
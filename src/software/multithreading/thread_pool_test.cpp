@@ -0,0 +1,70 @@
+#include "software/multithreading/thread_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+
+TEST(ThreadPoolTest, submit_single_task_returns_result)
+{
+    ThreadPool pool(2);
+
+    std::future<int> result = pool.submit([]() { return 42; });
+
+    EXPECT_EQ(42, result.get());
+}
+
+TEST(ThreadPoolTest, submit_many_tasks_all_tasks_are_run)
+{
+    ThreadPool pool(4);
+    std::atomic<int> num_tasks_run(0);
+
+    std::vector<std::future<int>> results;
+    for (int i = 0; i < 100; i++)
+    {
+        results.emplace_back(pool.submit([i, &num_tasks_run]() {
+            num_tasks_run++;
+            return i * i;
+        }));
+    }
+
+    // Results should be retrievable in submission order regardless of which
+    // worker ran each task
+    for (int i = 0; i < 100; i++)
+    {
+        EXPECT_EQ(i * i, results[i].get());
+    }
+    EXPECT_EQ(100, num_tasks_run);
+}
+
+TEST(ThreadPoolTest, submit_task_that_throws_exception_is_propagated_to_future)
+{
+    ThreadPool pool(1);
+
+    std::future<void> result =
+        pool.submit([]() { throw std::runtime_error("task failed"); });
+
+    EXPECT_THROW(result.get(), std::runtime_error);
+}
+
+TEST(ThreadPoolTest, pool_with_zero_threads_creates_one_worker)
+{
+    ThreadPool pool(0);
+
+    EXPECT_EQ(1, pool.size());
+    EXPECT_EQ(7, pool.submit([]() { return 7; }).get());
+}
+
+TEST(ThreadPoolTest, destructor_finishes_already_submitted_tasks)
+{
+    std::atomic<int> num_tasks_run(0);
+    {
+        ThreadPool pool(2);
+        for (int i = 0; i < 20; i++)
+        {
+            pool.submit([&num_tasks_run]() { num_tasks_run++; });
+        }
+    }
+
+    EXPECT_EQ(20, num_tasks_run);
+}
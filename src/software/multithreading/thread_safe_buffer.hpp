@@ -10,6 +10,22 @@
 #include "software/time/duration.h"
 #include "software/util/typename/typename.h"
 
+/**
+ * The newest value in a ThreadSafeBuffer, taken by discarding every older value
+ *
+ * @tparam T The type of whatever is being buffered
+ */
+template <typename T>
+struct LatestBufferedValue
+{
+    T value;
+
+    // The number of values that were added to the buffer but dropped in favour of this
+    // one, either because they were overwritten while the buffer was full or because
+    // they were discarded when this value was popped
+    std::size_t num_dropped_values;
+};
+
 /**
  * This class represents a buffer of objects
  *
@@ -74,6 +90,26 @@ class ThreadSafeBuffer
     std::optional<T> popMostRecentlyAddedValue(
         Duration max_wait_time = Duration::fromSeconds(0));
 
+    /**
+     * Removes the value most recently added to the buffer and returns it, discarding
+     * every other value in the buffer. This lets a consumer that is slower than the
+     * producer always work on the newest value, rather than on a backlog of old ones.
+     *
+     * If the buffer is empty, this function will *block* until:
+     * - a value becomes available
+     * - the given amount of time is exceeded
+     * - the destructor of this class is called
+     *
+     * @param max_wait_time The maximum duration to wait for a new value before
+     *                      returning
+     *
+     * @return The most recently added value to the buffer, along with how many values
+     *         were dropped since the last call to this function, or std::nullopt if
+     *         none is available
+     */
+    std::optional<LatestBufferedValue<T>> popLatestValueAndDiscardOthers(
+        Duration max_wait_time = Duration::fromSeconds(0));
+
     /**
      * Push the given value onto the buffer
      *
@@ -107,6 +143,10 @@ class ThreadSafeBuffer
 
     std::condition_variable received_new_value;
 
+    // The number of values overwritten while the buffer was full since the last call
+    // to popLatestValueAndDiscardOthers
+    std::size_t num_overwritten_values;
+
     std::mutex destructor_called_mutex;
     bool log_buffer_full;
     bool destructor_called;
@@ -114,7 +154,10 @@ class ThreadSafeBuffer
 
 template <typename T>
 ThreadSafeBuffer<T>::ThreadSafeBuffer(std::size_t buffer_size, bool log_buffer_full)
-    : buffer(buffer_size), log_buffer_full(log_buffer_full), destructor_called(false)
+    : buffer(buffer_size),
+      num_overwritten_values(0),
+      log_buffer_full(log_buffer_full),
+      destructor_called(false)
 {
 }
 
@@ -150,14 +193,40 @@ std::optional<T> ThreadSafeBuffer<T>::popMostRecentlyAddedValue(Duration max_wai
     return result;
 }
 
+template <typename T>
+std::optional<LatestBufferedValue<T>> ThreadSafeBuffer<T>::popLatestValueAndDiscardOthers(
+    Duration max_wait_time)
+{
+    // We hold the returned lock in a variable here so that we hold the lock on the
+    // buffer mutex until the lock is destructed at the end of this function
+    auto buffer_lock = waitForBufferToHaveAValue(max_wait_time);
+
+    std::optional<LatestBufferedValue<T>> result = std::nullopt;
+    if (!buffer.empty())
+    {
+        // The back of the buffer is the value that was pushed most recently, unless it
+        // was popped by popMostRecentlyAddedValue, which is never used along with this
+        result = LatestBufferedValue<T>{
+            .value              = buffer.back(),
+            .num_dropped_values = num_overwritten_values + buffer.size() - 1};
+        buffer.clear();
+        num_overwritten_values = 0;
+    }
+    return result;
+}
+
 template <typename T>
 void ThreadSafeBuffer<T>::push(const T& value)
 {
     std::scoped_lock<std::mutex> buffer_lock(buffer_mutex);
-    if (log_buffer_full && buffer.full())
+    if (buffer.full())
     {
-        std::cerr << "Pushing to a full ThreadSafeBuffer of type: " << TYPENAME(T)
-                  << std::endl;
+        if (log_buffer_full)
+        {
+            std::cerr << "Pushing to a full ThreadSafeBuffer of type: " << TYPENAME(T)
+                      << std::endl;
+        }
+        num_overwritten_values++;
     }
     buffer.push_back(value);
     received_new_value.notify_all();
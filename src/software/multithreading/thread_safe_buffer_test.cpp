@@ -165,3 +165,48 @@ TEST(ThreadSafeBufferTest, push_more_values_then_buffer_can_hold)
     EXPECT_EQ(39, buffer.popLeastRecentlyAddedValue());
     EXPECT_EQ(40, buffer.popLeastRecentlyAddedValue());
 }
+
+TEST(ThreadSafeBufferTest, popLatestValueAndDiscardOthers_counts_discarded_values)
+{
+    ThreadSafeBuffer<int> buffer(3);
+
+    buffer.push(7);
+    buffer.push(8);
+    buffer.push(9);
+
+    std::optional<LatestBufferedValue<int>> result =
+        buffer.popLatestValueAndDiscardOthers();
+    ASSERT_TRUE(result);
+    EXPECT_EQ(9, result->value);
+    EXPECT_EQ(2, result->num_dropped_values);
+    EXPECT_TRUE(buffer.empty());
+}
+
+TEST(ThreadSafeBufferTest, popLatestValueAndDiscardOthers_counts_overwritten_values)
+{
+    ThreadSafeBuffer<int> buffer(1, false);
+
+    buffer.push(7);
+    buffer.push(8);
+    buffer.push(9);
+
+    std::optional<LatestBufferedValue<int>> result =
+        buffer.popLatestValueAndDiscardOthers();
+    ASSERT_TRUE(result);
+    EXPECT_EQ(9, result->value);
+    EXPECT_EQ(2, result->num_dropped_values);
+
+    // Only the values dropped since the last pop are counted
+    buffer.push(10);
+    result = buffer.popLatestValueAndDiscardOthers();
+    ASSERT_TRUE(result);
+    EXPECT_EQ(10, result->value);
+    EXPECT_EQ(0, result->num_dropped_values);
+}
+
+TEST(ThreadSafeBufferTest, popLatestValueAndDiscardOthers_when_buffer_is_empty)
+{
+    ThreadSafeBuffer<int> buffer(3);
+
+    EXPECT_FALSE(buffer.popLatestValueAndDiscardOthers());
+}
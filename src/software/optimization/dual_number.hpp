@@ -0,0 +1,237 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+/**
+ * A dual number, used for forward-mode automatic differentiation
+ *
+ * A dual number carries a value together with its partial derivatives with respect to
+ * NUM_PARAMS input parameters. Arithmetic and the math functions below apply the chain
+ * rule as they compute the value, so evaluating a function on dual numbers gives its
+ * exact gradient in the same pass, with no extra function evaluations.
+ *
+ * Functions that should be differentiable should be written generically over their
+ * scalar type, and call math functions unqualified after `using std::exp;` (etc.), so
+ * that the overloads here are found for dual numbers and the std:: ones for doubles.
+ *
+ * Comparisons only compare values, so functions that branch or select between cases
+ * are differentiated through whichever case is taken.
+ *
+ * @tparam NUM_PARAMS The number of parameters to track partial derivatives for
+ */
+template <size_t NUM_PARAMS>
+class DualNumber
+{
+   public:
+    using GradientArray = std::array<double, NUM_PARAMS>;
+
+    /**
+     * Creates a dual number for a constant, which has a gradient of zero
+     *
+     * This is implicit so that constants can be mixed with dual numbers in arithmetic
+     *
+     * @param value The value of the constant
+     */
+    constexpr DualNumber(double value = 0.0) : value_(value), gradient_{} {}
+
+    /**
+     * Creates a dual number with the given value and gradient
+     *
+     * @param value The value
+     * @param gradient The partial derivatives of the value with respect to each
+     * parameter
+     */
+    constexpr DualNumber(double value, const GradientArray& gradient)
+        : value_(value), gradient_(gradient)
+    {
+    }
+
+    /**
+     * Creates a dual number for the parameter with the given index, which has a
+     * derivative of 1 with respect to itself and 0 with respect to the other parameters
+     *
+     * @param value The value of the parameter
+     * @param param_index The index of the parameter, in [0, NUM_PARAMS)
+     *
+     * @return The dual number for the parameter
+     */
+    static constexpr DualNumber parameter(double value, size_t param_index)
+    {
+        GradientArray gradient{};
+        gradient[param_index] = 1.0;
+        return DualNumber(value, gradient);
+    }
+
+    constexpr double value() const
+    {
+        return value_;
+    }
+
+    constexpr const GradientArray& gradient() const
+    {
+        return gradient_;
+    }
+
+    constexpr DualNumber operator-() const
+    {
+        return scaled(-value_, -1.0);
+    }
+
+    friend constexpr DualNumber operator+(const DualNumber& a, const DualNumber& b)
+    {
+        GradientArray gradient;
+        for (size_t i = 0; i < NUM_PARAMS; i++)
+        {
+            gradient[i] = a.gradient_[i] + b.gradient_[i];
+        }
+        return DualNumber(a.value_ + b.value_, gradient);
+    }
+
+    friend constexpr DualNumber operator-(const DualNumber& a, const DualNumber& b)
+    {
+        GradientArray gradient;
+        for (size_t i = 0; i < NUM_PARAMS; i++)
+        {
+            gradient[i] = a.gradient_[i] - b.gradient_[i];
+        }
+        return DualNumber(a.value_ - b.value_, gradient);
+    }
+
+    friend constexpr DualNumber operator*(const DualNumber& a, const DualNumber& b)
+    {
+        GradientArray gradient;
+        for (size_t i = 0; i < NUM_PARAMS; i++)
+        {
+            gradient[i] = a.gradient_[i] * b.value_ + a.value_ * b.gradient_[i];
+        }
+        return DualNumber(a.value_ * b.value_, gradient);
+    }
+
+    friend constexpr DualNumber operator/(const DualNumber& a, const DualNumber& b)
+    {
+        GradientArray gradient;
+        for (size_t i = 0; i < NUM_PARAMS; i++)
+        {
+            gradient[i] = (a.gradient_[i] * b.value_ - a.value_ * b.gradient_[i]) /
+                          (b.value_ * b.value_);
+        }
+        return DualNumber(a.value_ / b.value_, gradient);
+    }
+
+    DualNumber& operator+=(const DualNumber& other)
+    {
+        return *this = *this + other;
+    }
+
+    DualNumber& operator-=(const DualNumber& other)
+    {
+        return *this = *this - other;
+    }
+
+    DualNumber& operator*=(const DualNumber& other)
+    {
+        return *this = *this * other;
+    }
+
+    DualNumber& operator/=(const DualNumber& other)
+    {
+        return *this = *this / other;
+    }
+
+    friend constexpr bool operator==(const DualNumber& a, const DualNumber& b)
+    {
+        return a.value_ == b.value_;
+    }
+
+    friend constexpr bool operator!=(const DualNumber& a, const DualNumber& b)
+    {
+        return a.value_ != b.value_;
+    }
+
+    friend constexpr bool operator<(const DualNumber& a, const DualNumber& b)
+    {
+        return a.value_ < b.value_;
+    }
+
+    friend constexpr bool operator>(const DualNumber& a, const DualNumber& b)
+    {
+        return a.value_ > b.value_;
+    }
+
+    friend constexpr bool operator<=(const DualNumber& a, const DualNumber& b)
+    {
+        return a.value_ <= b.value_;
+    }
+
+    friend constexpr bool operator>=(const DualNumber& a, const DualNumber& b)
+    {
+        return a.value_ >= b.value_;
+    }
+
+    friend DualNumber exp(const DualNumber& a)
+    {
+        const double value = std::exp(a.value_);
+        return a.scaled(value, value);
+    }
+
+    /**
+     * The square root, whose derivative is taken to be 0 at 0 so that gradients stay
+     * finite where a distance is 0
+     */
+    friend DualNumber sqrt(const DualNumber& a)
+    {
+        const double value = std::sqrt(a.value_);
+        return a.scaled(value, value == 0.0 ? 0.0 : 0.5 / value);
+    }
+
+    friend DualNumber abs(const DualNumber& a)
+    {
+        return a.value_ < 0.0 ? -a : a;
+    }
+
+    friend DualNumber pow(double base, const DualNumber& exponent)
+    {
+        const double value = std::pow(base, exponent.value_);
+        return exponent.scaled(value, value * std::log(base));
+    }
+
+    friend DualNumber atan2(const DualNumber& y, const DualNumber& x)
+    {
+        const double length_squared = x.value_ * x.value_ + y.value_ * y.value_;
+        GradientArray gradient{};
+        if (length_squared != 0.0)
+        {
+            for (size_t i = 0; i < NUM_PARAMS; i++)
+            {
+                gradient[i] = (x.value_ * y.gradient_[i] - y.value_ * x.gradient_[i]) /
+                              length_squared;
+            }
+        }
+        return DualNumber(std::atan2(y.value_, x.value_), gradient);
+    }
+
+   private:
+    /**
+     * Applies the chain rule for a function of this dual number
+     *
+     * @param value The value of the function
+     * @param derivative The derivative of the function at this dual number's value
+     *
+     * @return The function's value, with this dual number's gradient scaled by the
+     * derivative
+     */
+    constexpr DualNumber scaled(double value, double derivative) const
+    {
+        GradientArray gradient;
+        for (size_t i = 0; i < NUM_PARAMS; i++)
+        {
+            gradient[i] = gradient_[i] * derivative;
+        }
+        return DualNumber(value, gradient);
+    }
+
+    double value_;
+    GradientArray gradient_;
+};
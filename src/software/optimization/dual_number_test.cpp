@@ -0,0 +1,133 @@
+#include "software/optimization/dual_number.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+using Dual = DualNumber<2>;
+
+/**
+ * Approximates the partial derivative of the given function of two variables with a
+ * central difference
+ */
+template <typename Function>
+double centralDifference(const Function& f, double x, double y, size_t param_index)
+{
+    const double step = 1e-6;
+    if (param_index == 0)
+    {
+        return (f(x + step, y) - f(x - step, y)) / (2 * step);
+    }
+    return (f(x, y + step) - f(x, y - step)) / (2 * step);
+}
+
+/**
+ * Checks that the gradient found by evaluating the given function on dual numbers
+ * matches its numerical gradient at the given point
+ */
+template <typename Function>
+void expectGradientMatchesNumericalGradient(const Function& f, double x, double y)
+{
+    const Dual result = f(Dual::parameter(x, 0), Dual::parameter(y, 1));
+
+    EXPECT_DOUBLE_EQ(result.value(), f(x, y));
+    EXPECT_NEAR(result.gradient()[0], centralDifference(f, x, y, 0), 1e-6);
+    EXPECT_NEAR(result.gradient()[1], centralDifference(f, x, y, 1), 1e-6);
+}
+
+TEST(DualNumberTest, constant_has_zero_gradient)
+{
+    Dual constant(3.5);
+
+    EXPECT_EQ(constant.value(), 3.5);
+    EXPECT_EQ(constant.gradient()[0], 0.0);
+    EXPECT_EQ(constant.gradient()[1], 0.0);
+}
+
+TEST(DualNumberTest, parameter_has_unit_gradient)
+{
+    Dual parameter = Dual::parameter(-1.5, 1);
+
+    EXPECT_EQ(parameter.value(), -1.5);
+    EXPECT_EQ(parameter.gradient()[0], 0.0);
+    EXPECT_EQ(parameter.gradient()[1], 1.0);
+}
+
+TEST(DualNumberTest, arithmetic)
+{
+    auto f = [](auto x, auto y) { return (x * y - 3.0 * x) / (y + 2.0) - -x + 1.0; };
+
+    expectGradientMatchesNumericalGradient(f, 0.7, -0.4);
+    expectGradientMatchesNumericalGradient(f, -2.0, 5.0);
+}
+
+TEST(DualNumberTest, compound_assignment)
+{
+    auto f = [](auto x, auto y) {
+        auto result = x;
+        result += y;
+        result *= x;
+        result -= 2.0 * y;
+        result /= y;
+        return result;
+    };
+
+    expectGradientMatchesNumericalGradient(f, 1.3, 0.6);
+}
+
+TEST(DualNumberTest, math_functions)
+{
+    auto f = [](auto x, auto y) {
+        using std::atan2;
+        using std::exp;
+        using std::pow;
+        using std::sqrt;
+        return exp(x * 0.5) * sqrt(x * x + y * y) + atan2(y, x) + pow(5.0, y - 2.0);
+    };
+
+    expectGradientMatchesNumericalGradient(f, 0.3, 0.8);
+    expectGradientMatchesNumericalGradient(f, -1.2, -0.5);
+}
+
+TEST(DualNumberTest, sigmoid)
+{
+    auto f = [](auto x, auto y) {
+        using std::exp;
+        return 1 / (1 + exp((8 / 0.4) * (y - x)));
+    };
+
+    expectGradientMatchesNumericalGradient(f, 1.0, 1.05);
+}
+
+TEST(DualNumberTest, abs)
+{
+    auto f = [](auto x, auto y) {
+        using std::abs;
+        return abs(x - y);
+    };
+
+    expectGradientMatchesNumericalGradient(f, 1.0, 2.0);
+    expectGradientMatchesNumericalGradient(f, 2.0, 1.0);
+}
+
+TEST(DualNumberTest, min_max_and_clamp_follow_selected_value)
+{
+    Dual x = Dual::parameter(1.0, 0);
+    Dual y = Dual::parameter(2.0, 1);
+
+    EXPECT_EQ(std::max(x, y).gradient()[1], 1.0);
+    EXPECT_EQ(std::min(x, y).gradient()[0], 1.0);
+    EXPECT_EQ(std::clamp(x, Dual(0.0), Dual(0.5)).gradient()[0], 0.0);
+    EXPECT_EQ(std::clamp(x, Dual(0.0), Dual(1.5)).gradient()[0], 1.0);
+}
+
+TEST(DualNumberTest, sqrt_of_zero_has_zero_gradient)
+{
+    Dual x = Dual::parameter(0.0, 0);
+
+    Dual result = sqrt(x * x);
+
+    EXPECT_EQ(result.value(), 0.0);
+    EXPECT_EQ(result.gradient()[0], 0.0);
+}
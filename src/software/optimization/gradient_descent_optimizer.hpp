@@ -3,7 +3,9 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
-#include <functional>
+#include <type_traits>
+
+#include "software/optimization/dual_number.hpp"
 
 /**
  * This class implements a version of Stochastic Gradient Descent (SGD), namely Adam
@@ -25,6 +27,14 @@
  * https://www.ruder.io/optimizing-gradient-descent/#adam
  * https://en.wikipedia.org/wiki/Moment_(mathematics)
  *
+ * Objective functions can be given in one of two forms:
+ *  - A function taking a ParamArray and returning a double. Its gradient is
+ *    approximated numerically, which costs NUM_PARAMS extra evaluations of the
+ *    function on every iteration.
+ *  - A function taking a DualParamArray and returning a DualNumber<NUM_PARAMS>.
+ *    Its exact gradient is computed by forward-mode automatic differentiation as
+ *    it is evaluated, so each iteration costs a single evaluation of the function.
+ *
  * NOTE: CLion complains about "Redefinition of GradientDescentOptimizer", but it's
  *       incorrect, this class compiles just fine.
  *
@@ -35,7 +45,33 @@ template <size_t NUM_PARAMS>
 class GradientDescentOptimizer
 {
    public:
-    using ParamArray = std::array<double, NUM_PARAMS>;
+    using ParamArray     = std::array<double, NUM_PARAMS>;
+    using DualParamArray = std::array<DualNumber<NUM_PARAMS>, NUM_PARAMS>;
+
+    // Whether the given objective function type is differentiable, ie. it can be
+    // evaluated on dual numbers to get its gradient
+    template <typename ObjectiveFunction>
+    static constexpr bool IS_DIFFERENTIABLE =
+        std::is_invocable_r_v<DualNumber<NUM_PARAMS>, const ObjectiveFunction&,
+                              const DualParamArray&>;
+
+    /**
+     * The state of one run of gradient descent. Passing the same state to several
+     * calls of maximize or minimize continues the run where the last call stopped,
+     * so running N iterations and then M more gives the same result as running N + M
+     * iterations in one call.
+     */
+    struct State
+    {
+        explicit State(ParamArray initial_value) : params(initial_value) {}
+
+        // The current parameters
+        ParamArray params;
+
+        // The past gradient and squared gradient averages for each parameter
+        ParamArray past_gradient_averages         = {0};
+        ParamArray past_squared_gradient_averages = {0};
+    };
 
     // Almost always good values for the decay rates, taken from:
     // https://www.ruder.io/optimizing-gradient-descent/#adam
@@ -80,7 +116,8 @@ class GradientDescentOptimizer
      * @return The parameters corresponding to the maximum value of the objective
      *         found
      */
-    ParamArray maximize(std::function<double(ParamArray)> objective_function,
+    template <typename ObjectiveFunction>
+    ParamArray maximize(const ObjectiveFunction& objective_function,
                         ParamArray initial_value, unsigned int num_iters);
 
     /**
@@ -96,31 +133,63 @@ class GradientDescentOptimizer
      * @return The parameters corresponding to the minimum value of the objective
      *         found
      */
-    ParamArray minimize(std::function<double(ParamArray)> objective_function,
+    template <typename ObjectiveFunction>
+    ParamArray minimize(const ObjectiveFunction& objective_function,
                         ParamArray initial_value, unsigned int num_iters);
 
+    /**
+     * Continues maximizing or minimizing the given objective function
+     *
+     * Runs gradient descent for num_iters more iterations, starting from and updating
+     * the given state
+     *
+     * @param objective_function The function to maximize or minimize
+     * @param state The state of the run to continue, which is updated to the state
+     *              after the iterations
+     * @param num_iters The number of iterations to run for
+     */
+    template <typename ObjectiveFunction>
+    void maximize(const ObjectiveFunction& objective_function, State& state,
+                  unsigned int num_iters);
+    template <typename ObjectiveFunction>
+    void minimize(const ObjectiveFunction& objective_function, State& state,
+                  unsigned int num_iters);
+
 
    private:
     /**
      * Attempts to minimize or maximize the given objective function
      *
-     * Runs gradient descent, starting from the given initial_value and running for
-     * num_iters
+     * Runs gradient descent, starting from the given state and running for num_iters
      *
      * @param objective_function The function to minimize
-     * @param initial_value The value to start from
+     * @param state The state to start from, which is updated to the state after the
+     *              iterations. Its params are the parameters corresponding to the
+     *              minimum or maximum value of the objective found, depending on what
+     *              gradient_movement_func was given
      * @param num_iters The number of iterations to run for
      * @param gradient_movement_func The function to use on each step along the
      *                               gradient, either "-" to minimize the given
      *                               function, or "+" to maximize it
+     */
+    template <typename ObjectiveFunction, typename GradientMovementFunction>
+    void followGradient(const ObjectiveFunction& objective_function, State& state,
+                        unsigned int num_iters,
+                        const GradientMovementFunction& gradient_movement_func);
+
+    /**
+     * Gets the weighted gradient of the objective function at a given point,
+     * calculating it if the objective function is differentiable and approximating it
+     * otherwise
      *
-     * @return The parameters corresponding to the minimum or maximum value of the
-     *         objective found, depending on what gradient_movement_func was given
+     * @param params The params at which we want the gradient
+     * @param objective_function The function to get the gradient of
+     * @return A ParamArray, where each "param" is the derivative with respect to the
+     *         corresponding input param, multiplied by the weight of that param
      */
-    ParamArray followGradient(
-        std::function<double(ParamArray)> objective_function, ParamArray initial_value,
-        unsigned int num_iters,
-        std::function<double(double, double)> gradient_movement_func);
+    template <typename ObjectiveFunction>
+    ParamArray getGradient(const ParamArray& params,
+                           const ObjectiveFunction& objective_function);
 
     /**
      * Approximate the gradient of the objective function around a given point
@@ -130,8 +199,22 @@ class GradientDescentOptimizer
      * @return A ParamArray, where each "param" is the derivative with respect to the
      *         corresponding input param.
      */
-    ParamArray approximateGradient(ParamArray params,
-                                   std::function<double(ParamArray)> objective_function);
+    template <typename ObjectiveFunction>
+    ParamArray approximateGradient(const ParamArray& params,
+                                   const ObjectiveFunction& objective_function);
+
+    /**
+     * Calculate the gradient of a differentiable objective function at a given point,
+     * by evaluating it once on dual numbers
+     *
+     * @param params The params at which we want to calculate the gradient
+     * @param objective_function The function to calculate the gradient of
+     * @return A ParamArray, where each "param" is the derivative with respect to the
+     *         corresponding input param.
+     */
+    template <typename ObjectiveFunction>
+    ParamArray calculateGradient(const ParamArray& params,
+                                 const ObjectiveFunction& objective_function);
 
     // This constant is used to prevent division by 0 in our implementation of Adam
     // (gradient descent)
@@ -172,44 +255,62 @@ GradientDescentOptimizer<NUM_PARAMS>::GradientDescentOptimizer(
 }
 
 template <size_t NUM_PARAMS>
+template <typename ObjectiveFunction>
 std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::maximize(
-    std::function<double(std::array<double, NUM_PARAMS>)> objective_function,
+    const ObjectiveFunction& objective_function,
     std::array<double, NUM_PARAMS> initial_value, unsigned int num_iters)
 {
-    return followGradient(
-        objective_function, initial_value, num_iters,
-        [](double curr_value, double step) { return curr_value + step; });
+    State state(initial_value);
+    maximize(objective_function, state, num_iters);
+    return state.params;
 }
 
 template <size_t NUM_PARAMS>
+template <typename ObjectiveFunction>
 std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::minimize(
-    std::function<double(std::array<double, NUM_PARAMS>)> objective_function,
+    const ObjectiveFunction& objective_function,
     std::array<double, NUM_PARAMS> initial_value, unsigned int num_iters)
 {
-    return followGradient(
-        objective_function, initial_value, num_iters,
-        [](double curr_value, double step) { return curr_value - step; });
+    State state(initial_value);
+    minimize(objective_function, state, num_iters);
+    return state.params;
+}
+
+template <size_t NUM_PARAMS>
+template <typename ObjectiveFunction>
+void GradientDescentOptimizer<NUM_PARAMS>::maximize(
+    const ObjectiveFunction& objective_function, State& state, unsigned int num_iters)
+{
+    followGradient(objective_function, state, num_iters,
+                   [](double curr_value, double step) { return curr_value + step; });
+}
+
+template <size_t NUM_PARAMS>
+template <typename ObjectiveFunction>
+void GradientDescentOptimizer<NUM_PARAMS>::minimize(
+    const ObjectiveFunction& objective_function, State& state, unsigned int num_iters)
+{
+    followGradient(objective_function, state, num_iters,
+                   [](double curr_value, double step) { return curr_value - step; });
 }
 
 template <size_t NUM_PARAMS>
-std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::followGradient(
-    std::function<double(std::array<double, NUM_PARAMS>)> objective_function,
-    std::array<double, NUM_PARAMS> initial_value, unsigned int num_iters,
-    std::function<double(double, double)> gradient_movement_func)
+template <typename ObjectiveFunction, typename GradientMovementFunction>
+void GradientDescentOptimizer<NUM_PARAMS>::followGradient(
+    const ObjectiveFunction& objective_function, State& state, unsigned int num_iters,
+    const GradientMovementFunction& gradient_movement_func)
 {
     // Implementation of the "Adam" algorithm. See Javadoc class comment for this
     // class (in the header) for details
 
-    // This is basically just to change the name so the below code reads more nicely
-    ParamArray params = initial_value;
-
-    // The past gradient and squared gradient averages for each parameter
-    ParamArray past_gradient_averages         = {0};
-    ParamArray past_squared_gradient_averages = {0};
+    // This is basically just to change the names so the below code reads more nicely
+    ParamArray& params                         = state.params;
+    ParamArray& past_gradient_averages         = state.past_gradient_averages;
+    ParamArray& past_squared_gradient_averages = state.past_squared_gradient_averages;
 
     for (unsigned iter = 0; iter < num_iters; iter++)
     {
-        ParamArray gradient = approximateGradient(params, objective_function);
+        ParamArray gradient = getGradient(params, objective_function);
 
         // Get the squared gradient
         ParamArray squared_gradient = {0};
@@ -253,14 +354,29 @@ std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::followGradi
                      eps));
         }
     }
+}
 
-    return params;
+template <size_t NUM_PARAMS>
+template <typename ObjectiveFunction>
+std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::getGradient(
+    const std::array<double, NUM_PARAMS>& params,
+    const ObjectiveFunction& objective_function)
+{
+    if constexpr (IS_DIFFERENTIABLE<ObjectiveFunction>)
+    {
+        return calculateGradient(params, objective_function);
+    }
+    else
+    {
+        return approximateGradient(params, objective_function);
+    }
 }
 
 template <size_t NUM_PARAMS>
+template <typename ObjectiveFunction>
 std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::approximateGradient(
-    std::array<double, NUM_PARAMS> params,
-    std::function<double(std::array<double, NUM_PARAMS>)> objective_function)
+    const std::array<double, NUM_PARAMS>& params,
+    const ObjectiveFunction& objective_function)
 {
     ParamArray gradient        = {0};
     double curr_function_value = objective_function(params);
@@ -276,3 +392,28 @@ std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::approximate
 
     return gradient;
 }
+
+template <size_t NUM_PARAMS>
+template <typename ObjectiveFunction>
+std::array<double, NUM_PARAMS> GradientDescentOptimizer<NUM_PARAMS>::calculateGradient(
+    const std::array<double, NUM_PARAMS>& params,
+    const ObjectiveFunction& objective_function)
+{
+    DualParamArray dual_params;
+    for (unsigned i = 0; i < NUM_PARAMS; i++)
+    {
+        dual_params.at(i) = DualNumber<NUM_PARAMS>::parameter(params.at(i), i);
+    }
+
+    const DualNumber<NUM_PARAMS> function_value = objective_function(dual_params);
+
+    // Weight the gradient the same way as approximateGradient, which steps each param
+    // by its weight
+    ParamArray gradient = {0};
+    for (unsigned i = 0; i < NUM_PARAMS; i++)
+    {
+        gradient.at(i) = function_value.gradient().at(i) * param_weights.at(i);
+    }
+
+    return gradient;
+}
@@ -64,6 +64,25 @@ TEST(GradientDescentOptimizerTest, minimize_multi_valued_function_with_offsets)
     EXPECT_NEAR(min.at(1), 4, 0.1);
 }
 
+TEST(GradientDescentOptimizerTest, resuming_from_state_matches_single_run)
+{
+    GradientDescentOptimizer<2> gradientDescentOptimizer({0.1, 0.05});
+
+    // f = (x+5)^2 + 2*(y-4)^2 + 20
+    auto f = [](std::array<double, 2> x) {
+        return std::pow(x.at(0) + 5, 2) + 2 * std::pow(x.at(1) - 4, 2) + 20;
+    };
+
+    auto min = gradientDescentOptimizer.minimize(f, {0, 0}, 30);
+
+    GradientDescentOptimizer<2>::State state({0, 0});
+    gradientDescentOptimizer.minimize(f, state, 10);
+    gradientDescentOptimizer.minimize(f, state, 15);
+    gradientDescentOptimizer.minimize(f, state, 5);
+
+    EXPECT_EQ(state.params, min);
+}
+
 TEST(GradientDescentOptimizerTest, maximize_sigmoid)
 {
     GradientDescentOptimizer<1> gradientDescentOptimizer({0.1});
@@ -98,3 +117,69 @@ TEST(GradientDescentOptimizer, maximize_sigmoid_performance_test)
     // the "S" in the sigmoid within the given number of iterations
     EXPECT_GE(min.at(0), 3);
 }
+
+TEST(GradientDescentOptimizerTest, minimize_differentiable_multi_valued_function)
+{
+    GradientDescentOptimizer<2> gradientDescentOptimizer({0.1, 0.05});
+
+    // f = (x+5)^2 + 2*(y-4)^2 + 20
+    auto f = [](const std::array<DualNumber<2>, 2>& x) {
+        return (x[0] + 5) * (x[0] + 5) + 2 * (x[1] - 4) * (x[1] - 4) + 20;
+    };
+
+    auto min = gradientDescentOptimizer.minimize(f, {0, 0}, 150);
+
+    EXPECT_NEAR(min.at(0), -5, 0.1);
+    EXPECT_NEAR(min.at(1), 4, 0.1);
+}
+
+TEST(GradientDescentOptimizerTest,
+     differentiable_objective_converges_like_approximated_objective)
+{
+    GradientDescentOptimizer<2> gradientDescentOptimizer({0.1, 0.1});
+
+    unsigned int num_approximated_evaluations   = 0;
+    unsigned int num_differentiable_evaluations = 0;
+
+    // f = 1 / (1 + exp(2-2x)) * 1 / (1 + exp(1+y))
+    auto approximated_f = [&](const std::array<double, 2>& x) {
+        num_approximated_evaluations++;
+        return 1 / (1 + std::exp(2 - 2 * x[0])) / (1 + std::exp(1 + x[1]));
+    };
+    auto differentiable_f = [&](const std::array<DualNumber<2>, 2>& x) {
+        num_differentiable_evaluations++;
+        return 1 / (1 + exp(2 - 2 * x[0])) / (1 + exp(1 + x[1]));
+    };
+
+    auto approximated_max = gradientDescentOptimizer.maximize(approximated_f, {0, 0}, 50);
+    auto differentiable_max =
+        gradientDescentOptimizer.maximize(differentiable_f, {0, 0}, 50);
+
+    EXPECT_NEAR(approximated_max.at(0), differentiable_max.at(0), 1e-3);
+    EXPECT_NEAR(approximated_max.at(1), differentiable_max.at(1), 1e-3);
+
+    // The gradient of the differentiable objective comes with its value, so it is
+    // evaluated once per iteration instead of once per param plus once
+    EXPECT_EQ(num_differentiable_evaluations, 50);
+    EXPECT_EQ(num_approximated_evaluations, 3 * 50);
+}
+
+TEST(GradientDescentOptimizer, maximize_differentiable_sigmoid_performance_test)
+{
+    // The same as maximize_sigmoid_performance_test, but with the gradient calculated
+    // instead of approximated
+
+    GradientDescentOptimizer<1> gradientDescentOptimizer({0.1});
+
+    // f = 1 / (1 + exp(2-2x))
+    auto f = [](const std::array<DualNumber<1>, 1>& x) {
+        return 1 / (1 + exp(2 - 2 * x[0]));
+    };
+
+    const unsigned int EXACT_NUMBER_OF_ITERATIONS_TO_PASS_S_CURVE = 23;
+
+    auto min = gradientDescentOptimizer.maximize(
+        f, {0}, EXACT_NUMBER_OF_ITERATIONS_TO_PASS_S_CURVE);
+
+    EXPECT_GE(min.at(0), 3);
+}
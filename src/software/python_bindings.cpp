@@ -112,7 +112,14 @@ void declareReceiverPositionGenerator(py::module& m, std::string name)
         .def(py::init<std::shared_ptr<EighteenZonePitchDivision>,
                       TbotsProto::PassingConfig>())
         .def("getBestReceivingPositions",
-             &ReceiverPositionGenerator<T>::getBestReceivingPositions);
+             [](Class& receiver_position_generator, const World& world,
+                unsigned int num_positions,
+                const std::vector<Point>& existing_receiver_positions,
+                const std::optional<Point>& pass_origin_override) {
+                 return receiver_position_generator.getBestReceivingPositions(
+                     std::make_shared<const World>(world), num_positions,
+                     existing_receiver_positions, pass_origin_override);
+             });
 }
 
 
@@ -419,7 +426,12 @@ PYBIND11_MODULE(python_bindings, m)
 
     py::class_<PassGenerator>(m, "PassGenerator")
         .def(py::init<const TbotsProto::PassingConfig&>())
-        .def("getBestPass", &PassGenerator::getBestPass);
+        .def("getBestPass",
+             [](PassGenerator& pass_generator, const World& world,
+                const std::vector<RobotId>& robots_to_ignore) {
+                 return pass_generator.getBestPass(std::make_shared<const World>(world),
+                                                   robots_to_ignore);
+             });
 
     py::class_<PassWithRating, std::unique_ptr<PassWithRating>>(m, "PassWithRating")
         .def_readwrite("pass_value", &PassWithRating::pass)
@@ -1,104 +1,206 @@
 #include "software/sensor_fusion/filter/robot_filter.h"
 
 RobotFilter::RobotFilter(Robot current_robot_state, Duration expiry_buffer_duration)
-    : current_robot_state(current_robot_state),
-      expiry_buffer_duration(expiry_buffer_duration)
+    : robot_id(current_robot_state.id()),
+      expiry_buffer_duration(expiry_buffer_duration),
+      x_estimate(createAxisEstimate(
+          current_robot_state.position().x(), current_robot_state.velocity().x(),
+          DEFAULT_MEASUREMENT_NOISE.position_stddev_meters, INITIAL_VELOCITY_STDDEV,
+          INITIAL_ACCELERATION_STDDEV)),
+      y_estimate(createAxisEstimate(
+          current_robot_state.position().y(), current_robot_state.velocity().y(),
+          DEFAULT_MEASUREMENT_NOISE.position_stddev_meters, INITIAL_VELOCITY_STDDEV,
+          INITIAL_ACCELERATION_STDDEV)),
+      orientation_estimate(createAxisEstimate(
+          current_robot_state.orientation().toRadians(),
+          current_robot_state.angularVelocity().toRadians(),
+          DEFAULT_MEASUREMENT_NOISE.orientation_stddev_radians,
+          INITIAL_ANGULAR_VELOCITY_STDDEV, INITIAL_ANGULAR_ACCELERATION_STDDEV)),
+      estimate_timestamp(current_robot_state.timestamp())
 {
+    camera_measurement_noise.fill(DEFAULT_MEASUREMENT_NOISE);
 }
 
 RobotFilter::RobotFilter(RobotDetection current_robot_state,
                          Duration expiry_buffer_duration)
-    : current_robot_state(current_robot_state.id, current_robot_state.position,
-                          Vector(0, 0), current_robot_state.orientation,
-                          AngularVelocity::zero(), current_robot_state.timestamp),
-      expiry_buffer_duration(expiry_buffer_duration)
+    : RobotFilter(Robot(current_robot_state.id, current_robot_state.position,
+                        Vector(0, 0), current_robot_state.orientation,
+                        AngularVelocity::zero(), current_robot_state.timestamp),
+                  expiry_buffer_duration)
 {
 }
 
 std::optional<Robot> RobotFilter::getFilteredData(
     const std::vector<RobotDetection> &new_robot_data)
 {
-    int data_num               = 0;
-    Timestamp latest_timestamp = Timestamp().fromSeconds(0);
-    FilteredRobotData filtered_data{.id               = this->getRobotId(),
-                                    .position         = Point(0, 0),
-                                    .velocity         = Vector(0, 0),
-                                    .orientation      = Angle::fromRadians(0),
-                                    .angular_velocity = AngularVelocity::fromRadians(0),
-                                    .timestamp        = Timestamp().fromSeconds(0)};
-
-    for (const RobotDetection &robot_data : new_robot_data)
+    // Apply the detections of this robot in the order they were captured. Detections
+    // captured at the same time are applied one after another at that time, which
+    // fuses them, so the earliest capture time is found first and then every
+    // detection from that time is applied.
+    bool updated = false;
+    while (true)
     {
-        // add up all data points for this robot and then average it
-        if (robot_data.id == this->getRobotId() &&
-            robot_data.timestamp > this->current_robot_state.timestamp())
+        std::optional<Timestamp> next_timestamp;
+        for (const RobotDetection &robot_data : new_robot_data)
         {
-            filtered_data.position =
-                filtered_data.position + robot_data.position.toVector();
-            filtered_data.orientation =
-                filtered_data.orientation + robot_data.orientation;
-
-            filtered_data.timestamp = filtered_data.timestamp.fromMilliseconds(
-                filtered_data.timestamp.toMilliseconds() +
-                robot_data.timestamp.toMilliseconds());
-            data_num++;
+            if (robot_data.id == robot_id && robot_data.timestamp > estimate_timestamp &&
+                (!next_timestamp || robot_data.timestamp < *next_timestamp))
+            {
+                next_timestamp = robot_data.timestamp;
+            }
+        }
+        if (!next_timestamp)
+        {
+            break;
         }
 
-        // to get the latest timestamp of all data points in case there is no data for
-        // this robot id
-        if (latest_timestamp.toMilliseconds() < robot_data.timestamp.toMilliseconds())
+        const Timestamp detection_timestamp = *next_timestamp;
+        for (const RobotDetection &robot_data : new_robot_data)
         {
-            latest_timestamp = robot_data.timestamp;
+            if (robot_data.id == robot_id && robot_data.timestamp == detection_timestamp)
+            {
+                applyDetection(robot_data);
+            }
         }
+        updated = true;
     }
 
-    if (data_num == 0)
+    if (!updated)
     {
+        // to get the latest timestamp of all data points since there is no data for
+        // this robot id
+        Timestamp latest_timestamp = Timestamp::fromSeconds(0);
+        for (const RobotDetection &robot_data : new_robot_data)
+        {
+            if (latest_timestamp < robot_data.timestamp)
+            {
+                latest_timestamp = robot_data.timestamp;
+            }
+        }
+
         // if there is no data the duration of expiry_buffer_duration after previously
         // recorded robot state, return null. Otherwise remain the same state
         if (latest_timestamp.toMilliseconds() >
-            this->expiry_buffer_duration.toMilliseconds() +
-                current_robot_state.timestamp().toMilliseconds())
+            expiry_buffer_duration.toMilliseconds() + estimate_timestamp.toMilliseconds())
         {
             return std::nullopt;
         }
-        else
-        {
-            return std::make_optional(current_robot_state);
-        }
     }
-    else
+
+    return createRobot(x_estimate, y_estimate, orientation_estimate, estimate_timestamp);
+}
+
+Robot RobotFilter::predict(const Timestamp &timestamp) const
+{
+    AxisEstimate x           = x_estimate;
+    AxisEstimate y           = y_estimate;
+    AxisEstimate orientation = orientation_estimate;
+
+    const double dt = (timestamp - estimate_timestamp).toSeconds();
+    predictAxis(x, dt, POSITION_JERK_SPECTRAL_DENSITY);
+    predictAxis(y, dt, POSITION_JERK_SPECTRAL_DENSITY);
+    predictAxis(orientation, dt, ORIENTATION_JERK_SPECTRAL_DENSITY);
+    return createRobot(x, y, orientation, timestamp);
+}
+
+void RobotFilter::setMeasurementNoise(unsigned int camera_id,
+                                      const RobotMeasurementNoise &noise)
+{
+    if (camera_id < MAX_NUM_CAMERAS)
     {
-        // update data by returning filtered robot data
-        filtered_data.position    = Point(filtered_data.position.toVector() / data_num);
-        filtered_data.orientation = filtered_data.orientation / data_num;
-
-        filtered_data.timestamp = filtered_data.timestamp.fromMilliseconds(
-            filtered_data.timestamp.toMilliseconds() / data_num);
-
-        // velocity = position difference / time difference
-        filtered_data.velocity =
-            (filtered_data.position - current_robot_state.position()) /
-            (filtered_data.timestamp.toSeconds() -
-             current_robot_state.timestamp().toSeconds());
-
-        // angular_velocity = orientation difference / time difference
-        filtered_data.angular_velocity =
-            (filtered_data.orientation - current_robot_state.orientation()).clamp() /
-            (filtered_data.timestamp.toSeconds() -
-             current_robot_state.timestamp().toSeconds());
-
-        // update current_robot_state
-        this->current_robot_state =
-            Robot(this->getRobotId(), filtered_data.position, filtered_data.velocity,
-                  filtered_data.orientation, filtered_data.angular_velocity,
-                  filtered_data.timestamp);
-
-        return std::make_optional(this->current_robot_state);
+        camera_measurement_noise[camera_id] = noise;
     }
 }
 
 unsigned int RobotFilter::getRobotId() const
 {
-    return this->current_robot_state.id();
+    return robot_id;
+}
+
+RobotFilter::AxisEstimate RobotFilter::createAxisEstimate(double value, double rate,
+                                                          double value_stddev,
+                                                          double rate_stddev,
+                                                          double acceleration_stddev)
+{
+    AxisEstimate estimate;
+    estimate.mean << value, rate, 0.0;
+    estimate.covariance = Eigen::Vector3d(value_stddev * value_stddev,
+                                          rate_stddev * rate_stddev,
+                                          acceleration_stddev * acceleration_stddev)
+                              .asDiagonal();
+    return estimate;
+}
+
+void RobotFilter::predictAxis(AxisEstimate &estimate, double dt,
+                              double jerk_spectral_density)
+{
+    if (dt <= 0)
+    {
+        return;
+    }
+
+    Eigen::Matrix3d transition;
+    transition << 1.0, dt, dt * dt / 2, 0.0, 1.0, dt, 0.0, 0.0, 1.0;
+
+    // The process noise of white noise jerk, integrated over dt
+    const double dt2 = dt * dt;
+    const double dt3 = dt2 * dt;
+    Eigen::Matrix3d process_noise;
+    process_noise << dt3 * dt2 / 20, dt2 * dt2 / 8, dt3 / 6, dt2 * dt2 / 8, dt3 / 3,
+        dt2 / 2, dt3 / 6, dt2 / 2, dt;
+
+    estimate.mean = transition * estimate.mean;
+    estimate.covariance =
+        transition * estimate.covariance * transition.transpose() +
+        jerk_spectral_density * process_noise;
+}
+
+void RobotFilter::updateAxis(AxisEstimate &estimate, double innovation, double stddev)
+{
+    // Since only the value is measured, the innovation covariance is a scalar and the
+    // gain is the first column of the covariance scaled by it
+    const double innovation_variance = estimate.covariance(0, 0) + stddev * stddev;
+    const Eigen::Vector3d gain = estimate.covariance.col(0) / innovation_variance;
+    const Eigen::RowVector3d covariance_row = estimate.covariance.row(0);
+
+    estimate.mean += gain * innovation;
+    estimate.covariance -= gain * covariance_row;
+}
+
+void RobotFilter::applyDetection(const RobotDetection &detection)
+{
+    const double dt = (detection.timestamp - estimate_timestamp).toSeconds();
+    predictAxis(x_estimate, dt, POSITION_JERK_SPECTRAL_DENSITY);
+    predictAxis(y_estimate, dt, POSITION_JERK_SPECTRAL_DENSITY);
+    predictAxis(orientation_estimate, dt, ORIENTATION_JERK_SPECTRAL_DENSITY);
+    estimate_timestamp = detection.timestamp;
+
+    const RobotMeasurementNoise &noise =
+        detection.camera_id < MAX_NUM_CAMERAS
+            ? camera_measurement_noise[detection.camera_id]
+            : DEFAULT_MEASUREMENT_NOISE;
+    updateAxis(x_estimate, detection.position.x() - x_estimate.mean(0),
+               noise.position_stddev_meters);
+    updateAxis(y_estimate, detection.position.y() - y_estimate.mean(0),
+               noise.position_stddev_meters);
+
+    // The orientation is measured as a wrapped angle, so the innovation is wrapped
+    // around to the closest direction, and the estimate is kept wrapped as well so
+    // that it does not grow without bound as the robot spins
+    const Angle orientation_innovation =
+        (detection.orientation - Angle::fromRadians(orientation_estimate.mean(0)))
+            .clamp();
+    updateAxis(orientation_estimate, orientation_innovation.toRadians(),
+               noise.orientation_stddev_radians);
+    orientation_estimate.mean(0) =
+        Angle::fromRadians(orientation_estimate.mean(0)).clamp().toRadians();
+}
+
+Robot RobotFilter::createRobot(const AxisEstimate &x, const AxisEstimate &y,
+                               const AxisEstimate &orientation,
+                               const Timestamp &timestamp) const
+{
+    return Robot(robot_id, Point(x.mean(0), y.mean(0)), Vector(x.mean(1), y.mean(1)),
+                 Angle::fromRadians(orientation.mean(0)).clamp(),
+                 AngularVelocity::fromRadians(orientation.mean(1)), timestamp);
 }
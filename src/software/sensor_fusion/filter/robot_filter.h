@@ -1,5 +1,7 @@
 #pragma once
 
+#include <Eigen/Core>
+#include <array>
 #include <optional>
 #include <vector>
 
@@ -10,21 +12,49 @@
 #include "software/world/robot.h"
 
 /**
- * A lightweight datatype used to pass filtered robot data
+ * The standard deviation of the noise in the robot detections from a camera
  */
-typedef struct FilteredRobotData_t
+struct RobotMeasurementNoise
 {
-    unsigned int id;
-    Point position;
-    Vector velocity;
-    Angle orientation;
-    AngularVelocity angular_velocity;
-    Timestamp timestamp;
-} FilteredRobotData;
+    double position_stddev_meters;
+    double orientation_stddev_radians;
+};
 
+/**
+ * Given robot data from SSL Vision, filters and returns the state of a single robot.
+ *
+ * The x position, y position and orientation of the robot are each tracked by a
+ * Kalman filter with a constant acceleration model, driven by white noise jerk. The
+ * orientation is filtered as an unwrapped angle, and the difference between a detected
+ * orientation and the predicted orientation is wrapped to [-pi, pi) before it is used,
+ * which is all that linearizing the wrapped measurement does. Since the three axes are
+ * independent and every measurement is of a single value, each update only needs fixed
+ * size 3x3 matrices and no matrix inversions, so filtering does not allocate.
+ *
+ * Detections are applied in the order they were captured. Detections of the robot that
+ * were captured at the same time, such as from cameras with overlapping views, are
+ * fused by applying each of them at that time, weighted by the noise of the camera that
+ * captured them.
+ */
 class RobotFilter
 {
    public:
+    // The number of cameras that a measurement noise can be set for. Detections from
+    // cameras with higher ids use the default noise.
+    static constexpr unsigned int MAX_NUM_CAMERAS = 8;
+    // The default noise of the detections from a camera
+    static constexpr RobotMeasurementNoise DEFAULT_MEASUREMENT_NOISE = {
+        .position_stddev_meters = 0.003, .orientation_stddev_radians = 0.03};
+    // The power spectral density of the jerk of the robot, which is how quickly the
+    // filter lets its estimate of the acceleration change, in m^2/s^5 and rad^2/s^5
+    static constexpr double POSITION_JERK_SPECTRAL_DENSITY    = 20.0;
+    static constexpr double ORIENTATION_JERK_SPECTRAL_DENSITY = 200.0;
+    // The standard deviation of the initial estimate of the velocity and acceleration
+    static constexpr double INITIAL_VELOCITY_STDDEV             = 2.0;
+    static constexpr double INITIAL_ACCELERATION_STDDEV         = 5.0;
+    static constexpr double INITIAL_ANGULAR_VELOCITY_STDDEV     = 10.0;
+    static constexpr double INITIAL_ANGULAR_ACCELERATION_STDDEV = 50.0;
+
     /**
      * Creates a new robot filter
      *
@@ -44,11 +74,31 @@ class RobotFilter
      * The data does not all have to be for a particular Robot, the filter will only use
      * the new Robot data that matches the robot id the filter was constructed with.
      *
-     * @return The filtered data for the robot
+     * @return The filtered data for the robot, at the time of the latest detection of
+     * the robot
      */
     std::optional<Robot> getFilteredData(
         const std::vector<RobotDetection>& new_robot_data);
 
+    /**
+     * Predicts the state of the robot at the given time from the filtered data, without
+     * changing the filter. This can be used to compensate for the latency between when
+     * the robot was last detected and when its state is used.
+     *
+     * @param timestamp The time to predict the state of the robot at
+     *
+     * @return The predicted state of the robot
+     */
+    Robot predict(const Timestamp& timestamp) const;
+
+    /**
+     * Sets the noise of the detections from the given camera
+     *
+     * @param camera_id The id of the camera, which must be less than MAX_NUM_CAMERAS
+     * @param noise The noise of the detections from the camera
+     */
+    void setMeasurementNoise(unsigned int camera_id, const RobotMeasurementNoise& noise);
+
     /**
      * Returns the id of the Robot that this filter is filtering for
      *
@@ -57,6 +107,74 @@ class RobotFilter
     unsigned int getRobotId() const;
 
    private:
-    Robot current_robot_state;
+    /**
+     * The estimate of the value, rate and acceleration of one axis of the robot state,
+     * along with its covariance
+     */
+    struct AxisEstimate
+    {
+        Eigen::Vector3d mean;
+        Eigen::Matrix3d covariance;
+    };
+
+    /**
+     * Creates an estimate of an axis that is known to within the given standard
+     * deviations
+     */
+    static AxisEstimate createAxisEstimate(double value, double rate,
+                                           double value_stddev, double rate_stddev,
+                                           double acceleration_stddev);
+
+    /**
+     * Predicts an axis forwards in time with the constant acceleration model
+     *
+     * @param estimate The estimate to predict forwards
+     * @param dt The time to predict forwards by, in seconds
+     * @param jerk_spectral_density The power spectral density of the jerk of the axis
+     */
+    static void predictAxis(AxisEstimate& estimate, double dt,
+                            double jerk_spectral_density);
+
+    /**
+     * Updates an axis with a measurement of its value
+     *
+     * @param estimate The estimate to update
+     * @param innovation The difference between the measured and estimated value
+     * @param stddev The standard deviation of the measurement
+     */
+    static void updateAxis(AxisEstimate& estimate, double innovation, double stddev);
+
+    /**
+     * Predicts the estimates forwards to the time the given detection was captured, and
+     * then updates them with the detection
+     *
+     * @param detection The detection to update the estimates with, which must not have
+     * been captured before the time of the estimates
+     */
+    void applyDetection(const RobotDetection& detection);
+
+    /**
+     * Creates the Robot described by the given estimates
+     *
+     * @param x The estimate of the x position of the robot
+     * @param y The estimate of the y position of the robot
+     * @param orientation The estimate of the orientation of the robot
+     * @param timestamp The time of the estimates
+     *
+     * @return the robot with the estimated state
+     */
+    Robot createRobot(const AxisEstimate& x, const AxisEstimate& y,
+                      const AxisEstimate& orientation,
+                      const Timestamp& timestamp) const;
+
+    unsigned int robot_id;
     Duration expiry_buffer_duration;
+
+    AxisEstimate x_estimate;
+    AxisEstimate y_estimate;
+    AxisEstimate orientation_estimate;
+    // The time that the estimates are for
+    Timestamp estimate_timestamp;
+
+    std::array<RobotMeasurementNoise, MAX_NUM_CAMERAS> camera_measurement_noise;
 };
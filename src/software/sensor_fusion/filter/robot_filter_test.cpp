@@ -3,7 +3,41 @@
 #include <gtest/gtest.h>
 #include <string.h>
 
+#include <cmath>
+#include <random>
+
 #include "software/test_util/equal_within_tolerance.h"
+#include "software/test_util/test_util.h"
+
+namespace
+{
+    // The time between frames from the cameras
+    constexpr double FRAME_PERIOD_SECONDS = 1.0 / 60;
+
+    /**
+     * Creates a detection of robot 1 at the given time
+     */
+    RobotDetection createDetection(const Point &position, const Angle &orientation,
+                                   double time_seconds, unsigned int camera_id = 0)
+    {
+        return RobotDetection{.id          = 1,
+                              .position    = position,
+                              .orientation = orientation,
+                              .confidence  = 1.0,
+                              .timestamp   = Timestamp::fromSeconds(time_seconds),
+                              .camera_id   = camera_id};
+    }
+
+    /**
+     * Creates a filter for robot 1, which is stationary at the origin at time 0
+     */
+    RobotFilter createFilter()
+    {
+        return RobotFilter(Robot(1, Point(0, 0), Vector(0, 0), Angle::zero(),
+                                 AngularVelocity::zero(), Timestamp::fromSeconds(0)),
+                           Duration::fromSeconds(10));
+    }
+}  // namespace
 
 TEST(RobotFilterTest, no_match_robot_data_robot_state_expired_test)
 {
@@ -29,31 +63,126 @@ TEST(RobotFilterTest, no_match_robot_data_robot_state_not_expired_test)
 
 TEST(RobotFilterTest, one_match_robot_data_robot_state_not_expired_test)
 {
-    Robot robot(1, Point(0, 0), Vector(0, 0), Angle::fromRadians(0),
-                AngularVelocity::fromRadians(0), Timestamp::fromSeconds(0));
-    RobotFilter robot_filter(robot, Duration::fromSeconds(10));
+    RobotFilter robot_filter = createFilter();
     std::vector<RobotDetection> new_robot_data = {
-        {1, Point(2, 0), Angle::fromRadians(1), 0.5, Timestamp::fromSeconds(9)}};
-    std::optional<Robot> op_robot;
-    op_robot.emplace(Robot(1, Point(2, 0), Vector(2.0 / 9, 0), Angle::fromRadians(1),
-                           AngularVelocity::fromRadians(1.0 / 9),
-                           Timestamp::fromSeconds(9)));
-    EXPECT_EQ(op_robot.value(), robot_filter.getFilteredData(new_robot_data).value());
+        createDetection(Point(2, 0), Angle::fromRadians(1), 9)};
+
+    // After a long time without detections, the filter is uncertain enough that it
+    // follows the new detection closely
+    Robot filtered_robot = robot_filter.getFilteredData(new_robot_data).value();
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(Point(2, 0), filtered_robot.position(),
+                                               1e-3));
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(Angle::fromRadians(1),
+                                               filtered_robot.orientation(),
+                                               Angle::fromDegrees(0.1)));
+    EXPECT_EQ(Timestamp::fromSeconds(9), filtered_robot.timestamp());
 }
 
-TEST(RobotFilterTest, two_match_robot_data_robot_state_not_expired_test)
+TEST(RobotFilterTest, detections_with_same_timestamp_are_fused_test)
 {
-    Robot robot(1, Point(0, 0), Vector(0, 0), Angle::fromRadians(0),
-                AngularVelocity::fromRadians(0), Timestamp::fromSeconds(0));
-    RobotFilter robot_filter(robot, Duration::fromSeconds(10));
+    RobotFilter robot_filter = createFilter();
     std::vector<RobotDetection> new_robot_data = {
-        {1, Point(1.5, 0), Angle::fromRadians(0.75), 0.5, Timestamp::fromSeconds(8.5)},
-        {1, Point(2.5, 0), Angle::fromRadians(1.25), 0.5, Timestamp::fromSeconds(9.5)}};
-    std::optional<Robot> op_robot;
-    op_robot.emplace(Robot(1, Point(2, 0), Vector(2.0 / 9, 0), Angle::fromRadians(1),
-                           AngularVelocity::fromRadians(1.0 / 9),
-                           Timestamp::fromSeconds(9)));
-    EXPECT_EQ(op_robot.value(), robot_filter.getFilteredData(new_robot_data).value());
+        createDetection(Point(1.5, 0), Angle::fromRadians(0.75), 9, 0),
+        createDetection(Point(2.5, 0), Angle::fromRadians(1.25), 9, 1)};
+
+    Robot filtered_robot = robot_filter.getFilteredData(new_robot_data).value();
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(Point(2, 0), filtered_robot.position(),
+                                               1e-3));
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(Angle::fromRadians(1),
+                                               filtered_robot.orientation(),
+                                               Angle::fromDegrees(0.1)));
+    EXPECT_EQ(Timestamp::fromSeconds(9), filtered_robot.timestamp());
+}
+
+TEST(RobotFilterTest, detections_are_applied_in_order_of_capture_test)
+{
+    RobotFilter robot_filter = createFilter();
+    std::vector<RobotDetection> new_robot_data = {
+        createDetection(Point(2.5, 0), Angle::fromRadians(1.25), 9.5),
+        createDetection(Point(1.5, 0), Angle::fromRadians(0.75), 8.5)};
+
+    Robot filtered_robot = robot_filter.getFilteredData(new_robot_data).value();
+    EXPECT_EQ(Timestamp::fromSeconds(9.5), filtered_robot.timestamp());
+    EXPECT_GT(filtered_robot.velocity().x(), 0);
+
+    // Detections older than the filtered data are ignored
+    EXPECT_EQ(filtered_robot,
+              robot_filter
+                  .getFilteredData({createDetection(Point(-1, 0), Angle::zero(), 9.0)})
+                  .value());
+}
+
+TEST(RobotFilterTest, detections_are_weighted_by_camera_noise_test)
+{
+    RobotFilter robot_filter = createFilter();
+    robot_filter.setMeasurementNoise(
+        0, {.position_stddev_meters = 0.001, .orientation_stddev_radians = 0.01});
+    robot_filter.setMeasurementNoise(
+        1, {.position_stddev_meters = 0.1, .orientation_stddev_radians = 1.0});
+
+    Robot filtered_robot = robot_filter
+                               .getFilteredData({
+                                   createDetection(Point(1, 0), Angle::zero(), 1, 0),
+                                   createDetection(Point(1, 1), Angle::half(), 1, 1),
+                               })
+                               .value();
+    EXPECT_NEAR(filtered_robot.position().x(), 1, 1e-3);
+    EXPECT_NEAR(filtered_robot.position().y(), 0, 1e-3);
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(Angle::zero(),
+                                               filtered_robot.orientation(),
+                                               Angle::fromDegrees(0.1)));
+}
+
+TEST(RobotFilterTest, tracks_constant_velocity_test)
+{
+    RobotFilter robot_filter = createFilter();
+    const Vector velocity(1.0, -0.5);
+    const AngularVelocity angular_velocity = AngularVelocity::fromRadians(2.0);
+
+    std::optional<Robot> filtered_robot;
+    for (int frame = 1; frame <= 60; frame++)
+    {
+        const double t = frame * FRAME_PERIOD_SECONDS;
+        filtered_robot = robot_filter.getFilteredData(
+            {createDetection(Point(velocity * t), angular_velocity * t, t)});
+    }
+
+    ASSERT_TRUE(filtered_robot);
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(velocity, filtered_robot->velocity(),
+                                               0.01));
+    EXPECT_NEAR(filtered_robot->angularVelocity().toRadians(), 2.0, 0.01);
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(Point(velocity),
+                                               filtered_robot->position(), 1e-3));
+
+    // Predicting ahead continues along the same path, without changing the filter
+    const Robot predicted_robot = robot_filter.predict(Timestamp::fromSeconds(1.1));
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(Point(velocity * 1.1),
+                                               predicted_robot.position(), 1e-3));
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(angular_velocity * 1.1,
+                                               predicted_robot.orientation(),
+                                               Angle::fromDegrees(0.5)));
+    EXPECT_EQ(Timestamp::fromSeconds(1.1), predicted_robot.timestamp());
+    EXPECT_EQ(filtered_robot, robot_filter.getFilteredData({}));
+}
+
+TEST(RobotFilterTest, tracks_orientation_across_wraparound_test)
+{
+    RobotFilter robot_filter = createFilter();
+
+    // Spin a few full turns at 4 rad/s
+    std::optional<Robot> filtered_robot;
+    for (int frame = 1; frame <= 240; frame++)
+    {
+        const double t = frame * FRAME_PERIOD_SECONDS;
+        filtered_robot = robot_filter.getFilteredData(
+            {createDetection(Point(0, 0), Angle::fromRadians(4.0 * t).clamp(), t)});
+    }
+
+    ASSERT_TRUE(filtered_robot);
+    EXPECT_NEAR(filtered_robot->angularVelocity().toRadians(), 4.0, 0.01);
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(Angle::fromRadians(16.0),
+                                               filtered_robot->orientation(),
+                                               Angle::fromDegrees(0.5)));
 }
 
 TEST(RobotFilterTest, large_positive_orientation_test)
@@ -64,12 +193,84 @@ TEST(RobotFilterTest, large_positive_orientation_test)
     std::vector<RobotDetection> new_robot_data = {
         {1, Point(0, 0), Angle::fromDegrees(359), 0.5, Timestamp::fromSeconds(1)}};
 
-    Robot expected_robot(1, Point(0, 0), Vector(0, 0), Angle::fromDegrees(359.0),
-                         AngularVelocity::fromDegrees(-2.0), Timestamp::fromSeconds(1));
     Robot filtered_robot = robot_filter.getFilteredData(new_robot_data).value();
 
-    EXPECT_TRUE(TestUtil::equalWithinTolerance(
-        expected_robot.angularVelocity().toDegrees(),
-        filtered_robot.angularVelocity().toDegrees(), 1e-6));
-    EXPECT_EQ(expected_robot, filtered_robot);
+    // The robot turned 2 degrees clockwise, rather than 358 degrees counterclockwise
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(Angle::fromDegrees(359.0),
+                                               filtered_robot.orientation(),
+                                               Angle::fromDegrees(0.1)));
+    EXPECT_LT(filtered_robot.angularVelocity().toDegrees(), 0.0);
+    EXPECT_GT(filtered_robot.angularVelocity().toDegrees(), -4.0);
+}
+
+TEST(RobotFilterTest, smooths_noisy_detections_test)
+{
+    RobotFilter robot_filter = createFilter();
+    std::mt19937 random_num_gen(3);
+    std::normal_distribution position_noise(
+        0.0, RobotFilter::DEFAULT_MEASUREMENT_NOISE.position_stddev_meters);
+    const Vector velocity(1.0, 0.0);
+
+    double sum_squared_velocity_error = 0.0;
+    int num_velocity_errors           = 0;
+    for (int frame = 1; frame <= 300; frame++)
+    {
+        const double t        = frame * FRAME_PERIOD_SECONDS;
+        const Point detection = Point(velocity * t) +
+                                Vector(position_noise(random_num_gen),
+                                       position_noise(random_num_gen));
+        Robot filtered_robot =
+            robot_filter.getFilteredData({createDetection(detection, Angle::zero(), t)})
+                .value();
+        if (frame > 60)
+        {
+            sum_squared_velocity_error +=
+                (filtered_robot.velocity() - velocity).lengthSquared();
+            num_velocity_errors++;
+        }
+    }
+
+    // Differencing consecutive detections would have an RMS velocity error of
+    // 2 * 0.003 m * 60 Hz = 0.36 m/s
+    EXPECT_LT(std::sqrt(sum_squared_velocity_error / num_velocity_errors), 0.1);
+}
+
+TEST(RobotFilterTest, DISABLED_filter_speed_test)
+{
+    // Two full teams of robots
+    const unsigned int num_robots = 22;
+    const int num_frames          = 1000;
+
+    std::vector<RobotFilter> robot_filters;
+    for (unsigned int id = 0; id < num_robots; id++)
+    {
+        robot_filters.emplace_back(
+            Robot(id, Point(0, 0), Vector(0, 0), Angle::zero(), AngularVelocity::zero(),
+                  Timestamp::fromSeconds(0)),
+            Duration::fromSeconds(1));
+    }
+
+    std::vector<RobotDetection> detections(num_robots);
+    const auto start_time = std::chrono::system_clock::now();
+    for (int frame = 1; frame <= num_frames; frame++)
+    {
+        const double t = frame * FRAME_PERIOD_SECONDS;
+        for (unsigned int id = 0; id < num_robots; id++)
+        {
+            detections[id] = RobotDetection{
+                .id          = id,
+                .position    = Point(std::sin(t + id), std::cos(t)),
+                .orientation = Angle::fromRadians(t),
+                .confidence  = 1.0,
+                .timestamp   = Timestamp::fromSeconds(t)};
+        }
+        for (RobotFilter &robot_filter : robot_filters)
+        {
+            robot_filter.getFilteredData(detections);
+        }
+    }
+
+    const double duration_ms = ::TestUtil::millisecondsSince(start_time);
+    std::cout << "Took " << duration_ms * 1000.0 / num_frames << "us to filter "
+              << num_robots << " robots in a frame" << std::endl;
 }
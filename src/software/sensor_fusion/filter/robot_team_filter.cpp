@@ -15,10 +15,14 @@ Team RobotTeamFilter::getFilteredData(
     {
         if (robot_filters.find(detection.id) == robot_filters.end())
         {
-            robot_filters.insert(
-                {detection.id,
-                 RobotFilter(detection, Duration::fromMilliseconds(
-                                            ROBOT_DEBOUNCE_DURATION_MILLISECONDS))});
+            RobotFilter robot_filter(
+                detection,
+                Duration::fromMilliseconds(ROBOT_DEBOUNCE_DURATION_MILLISECONDS));
+            for (const auto &[camera_id, noise] : camera_measurement_noise)
+            {
+                robot_filter.setMeasurementNoise(camera_id, noise);
+            }
+            robot_filters.insert({detection.id, robot_filter});
         }
     }
 
@@ -50,3 +54,13 @@ Team RobotTeamFilter::getFilteredData(
 
     return new_team_state;
 }
+
+void RobotTeamFilter::setMeasurementNoise(unsigned int camera_id,
+                                          const RobotMeasurementNoise &noise)
+{
+    camera_measurement_noise[camera_id] = noise;
+    for (auto &[robot_id, robot_filter] : robot_filters)
+    {
+        robot_filter.setMeasurementNoise(camera_id, noise);
+    }
+}
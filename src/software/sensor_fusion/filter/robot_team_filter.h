@@ -26,8 +26,22 @@ class RobotTeamFilter
     Team getFilteredData(const Team& current_team_state,
                          const std::vector<RobotDetection>& new_robot_detections);
 
+    /**
+     * Sets the noise of the robot detections from the given camera, for every robot on
+     * this team
+     *
+     * @param camera_id The id of the camera, which must be less than
+     * RobotFilter::MAX_NUM_CAMERAS
+     * @param noise The noise of the detections from the camera
+     */
+    void setMeasurementNoise(unsigned int camera_id, const RobotMeasurementNoise& noise);
+
 
     // A map used to store a separate robot filter for each robot on this team, so
     // each robot can be filtered and handled separately
     std::map<int, RobotFilter> robot_filters;
+
+   private:
+    // The noise set for each camera, which new robot filters are created with
+    std::map<unsigned int, RobotMeasurementNoise> camera_measurement_noise;
 };
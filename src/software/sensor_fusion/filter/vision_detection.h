@@ -17,6 +17,8 @@ struct RobotDetection
     Angle orientation;
     double confidence;
     Timestamp timestamp;
+    // The id of the camera that captured the detection
+    unsigned int camera_id = 0;
 
     bool operator<(const RobotDetection &r) const
     {
@@ -1,5 +1,8 @@
 #include "software/sensor_fusion/sensor_fusion.h"
 
+#include <array>
+#include <chrono>
+
 #include "software/geom/algorithms/distance.h"
 #include "software/logger/logger.h"
 
@@ -12,8 +15,13 @@ SensorFusion::SensorFusion(TbotsProto::SensorFusionConfig sensor_fusion_config)
       game_state(),
       referee_stage(std::nullopt),
       ball_filter(),
-      friendly_team_filter(),
-      enemy_team_filter(),
+      friendly_team_filter(createRobotTeamFilter()),
+      enemy_team_filter(createRobotTeamFilter()),
+      vision_frame_coalescer(
+          Duration::fromMilliseconds(
+              sensor_fusion_config.vision_frame_coalescing_window_ms()),
+          sensor_fusion_config.vision_frame_wait_for_all_cameras()),
+      vision_period_updated(false),
       possession(TeamPossession::FRIENDLY_TEAM),
       possession_tracker(std::make_shared<PossessionTracker>(
           sensor_fusion_config.possession_tracker_config())),
@@ -46,8 +54,19 @@ std::optional<World> SensorFusion::getWorld() const
     }
 }
 
-void SensorFusion::processSensorProto(const SensorProto &sensor_msg)
+bool SensorFusion::processSensorProto(const SensorProto &sensor_msg)
 {
+    vision_period_updated = false;
+
+    // Every sensor message is a chance to publish a vision period whose deadline has
+    // passed, so that it is not held back until the next period starts
+    vision_frame_coalescer.completeExpiredPeriod(
+        std::chrono::steady_clock::now(),
+        [this](const std::vector<SSLProto::SSL_DetectionFrame> &period_frames) {
+            updateWorld(period_frames);
+            vision_period_updated = true;
+        });
+
     if (sensor_msg.has_ssl_vision_msg())
     {
         updateWorld(sensor_msg.ssl_vision_msg());
@@ -74,6 +93,8 @@ void SensorFusion::processSensorProto(const SensorProto &sensor_msg)
         RobotId enemy_goalie_id_override = sensor_fusion_config.enemy_goalie_id();
         enemy_team.assignGoalie(enemy_goalie_id_override);
     }
+
+    return vision_period_updated;
 }
 
 void SensorFusion::updateWorld(const SSLProto::SSL_WrapperPacket &packet)
@@ -93,7 +114,12 @@ void SensorFusion::updateWorld(const SSLProto::SSL_WrapperPacket &packet)
             // Process the geometry again
             updateWorld(packet.geometry());
         }
-        updateWorld(packet.detection());
+        vision_frame_coalescer.addFrame(
+            packet.detection(), std::chrono::steady_clock::now(),
+            [this](const std::vector<SSLProto::SSL_DetectionFrame> &period_frames) {
+                updateWorld(period_frames);
+                vision_period_updated = true;
+            });
     }
 }
 
@@ -156,7 +182,7 @@ void SensorFusion::updateWorld(
     for (auto &robot_status_msg : robot_status_msgs)
     {
         RobotId robot_id = robot_status_msg.robot_id();
-        std::set<RobotCapability> unavailableCapabilities;
+        RobotCapabilityFlags unavailableCapabilities;
 
         for (const auto &error_code_msg : robot_status_msg.error_code())
         {
@@ -213,7 +239,8 @@ bool SensorFusion::shouldTrustRobotStatus()
 
 
 
-void SensorFusion::updateWorld(const SSLProto::SSL_DetectionFrame &ssl_detection_frame)
+void SensorFusion::updateWorld(
+    const std::vector<SSLProto::SSL_DetectionFrame> &ssl_detection_frames)
 {
     double min_valid_x              = sensor_fusion_config.min_valid_x();
     double max_valid_x              = sensor_fusion_config.max_valid_x();
@@ -221,16 +248,22 @@ void SensorFusion::updateWorld(const SSLProto::SSL_DetectionFrame &ssl_detection
     bool friendly_team_is_yellow    = sensor_fusion_config.friendly_color_yellow();
 
     std::optional<Ball> new_ball;
-    auto ball_detections = createBallDetections({ssl_detection_frame}, min_valid_x,
+    auto ball_detections = createBallDetections(ssl_detection_frames, min_valid_x,
                                                 max_valid_x, ignore_invalid_camera_data);
 
     auto yellow_team =
-        createTeamDetection({ssl_detection_frame}, TeamColour::YELLOW, min_valid_x,
+        createTeamDetection(ssl_detection_frames, TeamColour::YELLOW, min_valid_x,
                             max_valid_x, ignore_invalid_camera_data);
     auto blue_team =
-        createTeamDetection({ssl_detection_frame}, TeamColour::BLUE, min_valid_x,
+        createTeamDetection(ssl_detection_frames, TeamColour::BLUE, min_valid_x,
                             max_valid_x, ignore_invalid_camera_data);
 
+    double latest_t_capture = 0;
+    for (const auto &ssl_detection_frame : ssl_detection_frames)
+    {
+        latest_t_capture = std::max(latest_t_capture, ssl_detection_frame.t_capture());
+    }
+
     if (defending_positive_side)
     {
         for (auto &detection : ball_detections)
@@ -279,7 +312,7 @@ void SensorFusion::updateWorld(const SSLProto::SSL_DetectionFrame &ssl_detection
                     .normalize(DIST_TO_FRONT_OF_ROBOT_METERS +
                                BALL_TO_FRONT_OF_ROBOT_DISTANCE_WHEN_DRIBBLING),
             .distance_from_ground = 0,
-            .timestamp  = Timestamp::fromSeconds(ssl_detection_frame.t_capture()),
+            .timestamp  = Timestamp::fromSeconds(latest_t_capture),
             .confidence = 1}};
 
         std::optional<Ball> new_ball = createBall(dribbler_in_ball_detection);
@@ -433,7 +466,29 @@ void SensorFusion::resetWorldComponents()
     game_state           = GameState();
     referee_stage        = std::nullopt;
     ball_filter          = BallFilter();
-    friendly_team_filter = RobotTeamFilter();
-    enemy_team_filter    = RobotTeamFilter();
+    friendly_team_filter = createRobotTeamFilter();
+    enemy_team_filter    = createRobotTeamFilter();
     possession           = TeamPossession::FRIENDLY_TEAM;
+    vision_frame_coalescer.reset();
+}
+
+RobotTeamFilter SensorFusion::createRobotTeamFilter() const
+{
+    const TbotsProto::CameraMeasurementNoiseConfig &noise_config =
+        sensor_fusion_config.camera_measurement_noise_config();
+    const std::array<TbotsProto::RobotMeasurementNoiseConfig,
+                     RobotFilter::MAX_NUM_CAMERAS>
+        camera_noise_configs = {noise_config.camera_0(), noise_config.camera_1(),
+                                noise_config.camera_2(), noise_config.camera_3(),
+                                noise_config.camera_4(), noise_config.camera_5(),
+                                noise_config.camera_6(), noise_config.camera_7()};
+
+    RobotTeamFilter robot_team_filter;
+    for (unsigned int camera_id = 0; camera_id < camera_noise_configs.size(); camera_id++)
+    {
+        robot_team_filter.setMeasurementNoise(
+            camera_id, {camera_noise_configs[camera_id].position_stddev_meters(),
+                        camera_noise_configs[camera_id].orientation_stddev_radians()});
+    }
+    return robot_team_filter;
 }
@@ -11,6 +11,7 @@
 #include "software/sensor_fusion/filter/robot_team_filter.h"
 #include "software/sensor_fusion/filter/vision_detection.h"
 #include "software/sensor_fusion/possession/possession_tracker.h"
+#include "software/sensor_fusion/vision_frame_coalescer.h"
 #include "software/world/ball.h"
 #include "software/world/team.h"
 #include "software/world/world.h"
@@ -36,8 +37,11 @@ class SensorFusion
      * World
      *
      * @param new data
+     *
+     * @return whether the detection frames of a vision period were filtered into the
+     * World, in which case there is a new World to publish
      */
-    void processSensorProto(const SensorProto &sensor_msg);
+    bool processSensorProto(const SensorProto &sensor_msg);
 
     /**
      * Returns the most up-to-date world if enough data has been received
@@ -72,7 +76,15 @@ class SensorFusion
     void updateWorld(const google::protobuf::RepeatedPtrField<TbotsProto::RobotStatus>
                          &robot_status_msgs);
     void updateWorld(const SSLProto::SSL_GeometryData &geometry_packet);
-    void updateWorld(const SSLProto::SSL_DetectionFrame &ssl_detection_frame);
+
+    /**
+     * Updates the ball and teams with the detection frames of every camera for a
+     * vision period, filtering them together
+     *
+     * @param ssl_detection_frames The detection frames of the vision period
+     */
+    void updateWorld(
+        const std::vector<SSLProto::SSL_DetectionFrame> &ssl_detection_frames);
 
     /**
      * Updates relevant components with a new ball
@@ -134,6 +146,14 @@ class SensorFusion
      */
     void resetWorldComponents();
 
+    /**
+     * Creates a robot team filter that uses the measurement noise of each camera from
+     * the sensor fusion config
+     *
+     * @return the robot team filter
+     */
+    RobotTeamFilter createRobotTeamFilter() const;
+
     /**
      * Determines if the team has control over the given ball
      *
@@ -165,6 +185,10 @@ class SensorFusion
     RobotTeamFilter friendly_team_filter;
     RobotTeamFilter enemy_team_filter;
 
+    VisionFrameCoalescer vision_frame_coalescer;
+    // Whether a vision period was filtered into the world by the current sensor message
+    bool vision_period_updated;
+
     TeamPossession possession;
     std::shared_ptr<PossessionTracker> possession_tracker;
 
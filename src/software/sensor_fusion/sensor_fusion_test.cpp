@@ -1010,3 +1010,103 @@ TEST_F(SensorFusionTest, breakbeam_fail_test_ssl)
     // did it not use robot position
     EXPECT_TRUE(ball_position != robot_state.position());
 }
+
+TEST_F(SensorFusionTest, detection_frames_of_all_cameras_are_fused_into_one_world)
+{
+    // Each camera sees one of the teams, and only the first camera sees the ball
+    auto create_sensor_msg = [&](unsigned int camera_id, Timestamp time) {
+        std::unique_ptr<SSLProto::SSL_DetectionFrame> frame =
+            camera_id == 0 ? createSSLDetectionFrame(camera_id, time, 0, {ball_state},
+                                                     yellow_robot_states, {})
+                           : createSSLDetectionFrame(camera_id, time, 0, {}, {},
+                                                     blue_robot_states);
+        SensorProto sensor_msg;
+        *(sensor_msg.mutable_ssl_vision_msg()) =
+            *createSSLWrapperPacket(initSSLDivBGeomData(), std::move(frame));
+        return sensor_msg;
+    };
+
+    // Until the second camera is first seen, the first camera is the only one that
+    // a vision period waits for
+    EXPECT_TRUE(sensor_fusion.processSensorProto(create_sensor_msg(0, current_time)));
+    EXPECT_FALSE(sensor_fusion.processSensorProto(
+        create_sensor_msg(1, current_time + Duration::fromMilliseconds(2))));
+    EXPECT_TRUE(sensor_fusion.processSensorProto(
+        create_sensor_msg(0, current_time + Duration::fromMilliseconds(16))));
+
+    // Each vision period is only filtered once both cameras have sent their frames
+    for (int period = 1; period <= 3; period++)
+    {
+        Timestamp period_time = current_time + Duration::fromMilliseconds(16 * period);
+        if (period > 1)
+        {
+            EXPECT_FALSE(sensor_fusion.processSensorProto(
+                create_sensor_msg(0, period_time)));
+        }
+        EXPECT_TRUE(sensor_fusion.processSensorProto(
+            create_sensor_msg(1, period_time + Duration::fromMilliseconds(2))));
+
+        std::optional<World> world = sensor_fusion.getWorld();
+        ASSERT_TRUE(world);
+        EXPECT_EQ(2, world->friendlyTeam().numRobots());
+        EXPECT_EQ(3, world->enemyTeam().numRobots());
+    }
+}
+
+TEST_F(SensorFusionTest, robot_detections_are_weighted_by_camera_noise_from_config)
+{
+    config.set_friendly_color_yellow(true);
+    TbotsProto::RobotMeasurementNoiseConfig *camera_0_noise =
+        config.mutable_camera_measurement_noise_config()->mutable_camera_0();
+    camera_0_noise->set_position_stddev_meters(0.001);
+    camera_0_noise->set_orientation_stddev_radians(0.01);
+    TbotsProto::RobotMeasurementNoiseConfig *camera_1_noise =
+        config.mutable_camera_measurement_noise_config()->mutable_camera_1();
+    camera_1_noise->set_position_stddev_meters(0.1);
+    camera_1_noise->set_orientation_stddev_radians(1.0);
+    SensorFusion noisy_camera_sensor_fusion(config);
+
+    // The second camera sees the friendly robots 1 meter away from where the first
+    // camera sees them
+    std::vector<RobotStateWithId> shifted_yellow_robot_states;
+    for (const RobotStateWithId &robot_state_with_id : yellow_robot_states)
+    {
+        const RobotState &robot_state = robot_state_with_id.robot_state;
+        shifted_yellow_robot_states.push_back(RobotStateWithId{
+            .id          = robot_state_with_id.id,
+            .robot_state = RobotState(robot_state.position() + Vector(0, 1),
+                                      robot_state.velocity(), robot_state.orientation(),
+                                      robot_state.angularVelocity())});
+    }
+
+    auto create_sensor_msg = [&](unsigned int camera_id, Timestamp time) {
+        std::unique_ptr<SSLProto::SSL_DetectionFrame> frame =
+            camera_id == 0 ? createSSLDetectionFrame(camera_id, time, 0, {ball_state},
+                                                     yellow_robot_states, {})
+                           : createSSLDetectionFrame(camera_id, time, 0, {},
+                                                     shifted_yellow_robot_states, {});
+        SensorProto sensor_msg;
+        *(sensor_msg.mutable_ssl_vision_msg()) =
+            *createSSLWrapperPacket(initSSLDivBGeomData(), std::move(frame));
+        return sensor_msg;
+    };
+
+    for (int period = 0; period <= 3; period++)
+    {
+        Timestamp period_time = current_time + Duration::fromMilliseconds(16 * period);
+        noisy_camera_sensor_fusion.processSensorProto(create_sensor_msg(0, period_time));
+        noisy_camera_sensor_fusion.processSensorProto(
+            create_sensor_msg(1, period_time + Duration::fromMilliseconds(2)));
+    }
+
+    std::optional<World> world = noisy_camera_sensor_fusion.getWorld();
+    ASSERT_TRUE(world);
+    for (const RobotStateWithId &robot_state_with_id : yellow_robot_states)
+    {
+        std::optional<Robot> robot =
+            world->friendlyTeam().getRobotById(robot_state_with_id.id);
+        ASSERT_TRUE(robot);
+        EXPECT_NEAR(robot_state_with_id.robot_state.position().y(), robot->position().y(),
+                    0.01);
+    }
+}
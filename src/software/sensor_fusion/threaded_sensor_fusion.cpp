@@ -25,17 +25,16 @@ void ThreadedSensorFusion::onValueReceived(TbotsProto::ThunderbotsConfig config)
 void ThreadedSensorFusion::onValueReceived(SensorProto sensor_msg)
 {
     std::scoped_lock lock(sensor_fusion_mutex);
-    sensor_fusion.processSensorProto(sensor_msg);
-
-    // Limit sensor fusion to only send out worlds on ssl wrapper packets
-    // to prevent spamming worlds every time a referee msg or robot status
-    // msg comes through.
-    if (sensor_msg.has_ssl_vision_msg())
+    // Limit sensor fusion to only send out one world per vision period, once the
+    // detection frames of every camera for it have been filtered, to prevent spamming
+    // worlds every time a camera, referee msg or robot status msg comes through.
+    if (sensor_fusion.processSensorProto(sensor_msg))
     {
         std::optional<World> world = sensor_fusion.getWorld();
         if (world)
         {
-            Subject<World>::sendValueToObservers(world.value());
+            Subject<WorldPtr>::sendValueToObservers(
+                std::make_shared<const World>(std::move(world.value())));
         }
     }
 }
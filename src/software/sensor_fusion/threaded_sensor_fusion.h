@@ -7,8 +7,12 @@
 #include "software/sensor_fusion/sensor_fusion.h"
 #include "software/world/world.h"
 
+/**
+ * Runs SensorFusion on its own thread, publishing each new World as an immutable
+ * snapshot that is shared by every observer, rather than copied to each of them
+ */
 class ThreadedSensorFusion
-    : public Subject<World>,
+    : public Subject<WorldPtr>,
       public FirstInFirstOutThreadedObserver<SensorProto>,
       public FirstInFirstOutThreadedObserver<TbotsProto::ThunderbotsConfig>
 {
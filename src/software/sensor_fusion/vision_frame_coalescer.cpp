@@ -0,0 +1,93 @@
+#include "software/sensor_fusion/vision_frame_coalescer.h"
+
+#include <cmath>
+
+VisionFrameCoalescer::VisionFrameCoalescer(Duration coalescing_window,
+                                           bool wait_for_all_cameras)
+    : coalescing_window_seconds(coalescing_window.toSeconds()),
+      wait_for_all_cameras(wait_for_all_cameras),
+      period_frames(),
+      period_t_capture(0),
+      period_receive_time(),
+      camera_last_t_capture()
+{
+}
+
+void VisionFrameCoalescer::addFrame(
+    const SSLProto::SSL_DetectionFrame &frame,
+    std::chrono::steady_clock::time_point receive_time,
+    const std::function<void(const std::vector<SSLProto::SSL_DetectionFrame> &)>
+        &on_period_complete)
+{
+    const double t_capture = frame.t_capture();
+
+    completeExpiredPeriod(receive_time, on_period_complete);
+    if (!period_frames.empty() &&
+        (std::abs(t_capture - period_t_capture) > coalescing_window_seconds ||
+         hasFrameFromCamera(frame.camera_id())))
+    {
+        on_period_complete(period_frames);
+        period_frames.clear();
+    }
+
+    if (period_frames.empty())
+    {
+        period_t_capture    = t_capture;
+        period_receive_time = receive_time;
+    }
+    period_frames.push_back(frame);
+    camera_last_t_capture[frame.camera_id()] = t_capture;
+
+    if (wait_for_all_cameras && hasFrameFromAllActiveCameras(t_capture))
+    {
+        on_period_complete(period_frames);
+        period_frames.clear();
+    }
+}
+
+void VisionFrameCoalescer::completeExpiredPeriod(
+    std::chrono::steady_clock::time_point current_time,
+    const std::function<void(const std::vector<SSLProto::SSL_DetectionFrame> &)>
+        &on_period_complete)
+{
+    if (!period_frames.empty() &&
+        std::chrono::duration<double>(current_time - period_receive_time).count() >
+            coalescing_window_seconds)
+    {
+        on_period_complete(period_frames);
+        period_frames.clear();
+    }
+}
+
+void VisionFrameCoalescer::reset()
+{
+    period_frames.clear();
+    period_t_capture    = 0;
+    period_receive_time = std::chrono::steady_clock::time_point();
+    camera_last_t_capture.clear();
+}
+
+bool VisionFrameCoalescer::hasFrameFromCamera(unsigned int camera_id) const
+{
+    for (const SSLProto::SSL_DetectionFrame &period_frame : period_frames)
+    {
+        if (period_frame.camera_id() == camera_id)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool VisionFrameCoalescer::hasFrameFromAllActiveCameras(double t_capture) const
+{
+    for (const auto &[camera_id, last_t_capture] : camera_last_t_capture)
+    {
+        if (t_capture - last_t_capture <= CAMERA_TIMEOUT_SECONDS &&
+            !hasFrameFromCamera(camera_id))
+        {
+            return false;
+        }
+    }
+    return true;
+}
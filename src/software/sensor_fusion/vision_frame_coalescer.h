@@ -0,0 +1,112 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <vector>
+
+#include "proto/ssl_vision_detection.pb.h"
+#include "software/time/duration.h"
+
+/**
+ * Groups the detection frames that each camera sends for the same vision period, so
+ * that the frames of every camera can be filtered together and one World published per
+ * vision period, rather than one per camera.
+ *
+ * A vision period starts with the first frame that does not belong to the previous one,
+ * and takes every frame captured within the coalescing window of it. A period is
+ * complete once a frame arrives that was captured outside of the window, or that comes
+ * from a camera that already sent a frame for the period. If waiting for all cameras,
+ * a period is also complete as soon as every active camera has sent a frame for it, so
+ * that it does not have to wait for the next period to start. A camera is active if it
+ * has sent a frame within CAMERA_TIMEOUT_SECONDS.
+ *
+ * In either case, a period is also complete once the coalescing window has passed since
+ * its first frame was received, which bounds how long it is held back when the next
+ * period is late or a camera stops sending. The coalescer has no timer of its own, so
+ * this deadline is only checked when a frame is added or completeExpiredPeriod is
+ * called.
+ */
+class VisionFrameCoalescer
+{
+   public:
+    // How long a camera can go without sending a frame before periods are no longer
+    // held back waiting for it
+    static constexpr double CAMERA_TIMEOUT_SECONDS = 0.5;
+
+    /**
+     * Creates a new VisionFrameCoalescer
+     *
+     * @param coalescing_window The longest time between when the frames of a vision
+     * period were captured
+     * @param wait_for_all_cameras Whether a period is complete as soon as every active
+     * camera has sent a frame for it, rather than only once a frame from the next
+     * period arrives or the coalescing window has passed since its first frame was
+     * received
+     */
+    explicit VisionFrameCoalescer(Duration coalescing_window, bool wait_for_all_cameras);
+
+    /**
+     * Adds a detection frame to the vision period it was captured in
+     *
+     * @param frame The detection frame to add
+     * @param receive_time The time the frame was received
+     * @param on_period_complete Called with the frames of each period that this frame
+     * completes, oldest period first. The frames are only valid during the call.
+     */
+    void addFrame(
+        const SSLProto::SSL_DetectionFrame& frame,
+        std::chrono::steady_clock::time_point receive_time,
+        const std::function<void(const std::vector<SSLProto::SSL_DetectionFrame>&)>&
+            on_period_complete);
+
+    /**
+     * Completes the current period if the coalescing window has passed since its first
+     * frame was received
+     *
+     * @param current_time The current time
+     * @param on_period_complete Called with the frames of the period if it is complete.
+     * The frames are only valid during the call.
+     */
+    void completeExpiredPeriod(
+        std::chrono::steady_clock::time_point current_time,
+        const std::function<void(const std::vector<SSLProto::SSL_DetectionFrame>&)>&
+            on_period_complete);
+
+    /**
+     * Discards the frames of the current period and forgets every camera, such as after
+     * the vision client has reset
+     */
+    void reset();
+
+   private:
+    /**
+     * Checks if the current period has a frame from the given camera
+     *
+     * @param camera_id The id of the camera
+     *
+     * @return whether the current period has a frame from the camera
+     */
+    bool hasFrameFromCamera(unsigned int camera_id) const;
+
+    /**
+     * Checks if every active camera has sent a frame for the current period
+     *
+     * @param t_capture The capture time of the newest frame, in seconds
+     *
+     * @return whether every active camera has sent a frame for the current period
+     */
+    bool hasFrameFromAllActiveCameras(double t_capture) const;
+
+    double coalescing_window_seconds;
+    bool wait_for_all_cameras;
+
+    // The frames of the current period, and the capture and receive times of its first
+    // frame
+    std::vector<SSLProto::SSL_DetectionFrame> period_frames;
+    double period_t_capture;
+    std::chrono::steady_clock::time_point period_receive_time;
+
+    // The capture time of the latest frame from each camera, by camera id
+    std::map<unsigned int, double> camera_last_t_capture;
+};
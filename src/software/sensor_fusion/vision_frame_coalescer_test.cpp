@@ -0,0 +1,202 @@
+#include "software/sensor_fusion/vision_frame_coalescer.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+class VisionFrameCoalescerTest : public ::testing::Test
+{
+   protected:
+    /**
+     * Adds a frame from the given camera to the coalescer, recording the cameras of
+     * each period that it completes. The frame is received as soon as it is captured.
+     *
+     * @param coalescer The coalescer to add the frame to
+     * @param camera_id The id of the camera that sent the frame
+     * @param t_capture The time the frame was captured, in seconds
+     */
+    void addFrame(VisionFrameCoalescer &coalescer, unsigned int camera_id,
+                  double t_capture)
+    {
+        SSLProto::SSL_DetectionFrame frame;
+        frame.set_camera_id(camera_id);
+        frame.set_t_capture(t_capture);
+        frame.set_t_sent(t_capture);
+        frame.set_frame_number(0);
+
+        coalescer.addFrame(
+            frame, toTimePoint(t_capture),
+            [this](const std::vector<SSLProto::SSL_DetectionFrame> &frames) {
+                recordPeriod(frames);
+            });
+    }
+
+    /**
+     * Completes the current period of the coalescer if its deadline has passed at the
+     * given time, recording the cameras of the period if so
+     *
+     * @param coalescer The coalescer to check
+     * @param current_time The current time, in seconds
+     */
+    void completeExpiredPeriod(VisionFrameCoalescer &coalescer, double current_time)
+    {
+        coalescer.completeExpiredPeriod(
+            toTimePoint(current_time),
+            [this](const std::vector<SSLProto::SSL_DetectionFrame> &frames) {
+                recordPeriod(frames);
+            });
+    }
+
+    // The cameras of each completed period, in the order they were completed
+    std::vector<std::vector<unsigned int>> completed_periods;
+
+   private:
+    static std::chrono::steady_clock::time_point toTimePoint(double seconds)
+    {
+        return std::chrono::steady_clock::time_point(
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(seconds)));
+    }
+
+    void recordPeriod(const std::vector<SSLProto::SSL_DetectionFrame> &frames)
+    {
+        std::vector<unsigned int> camera_ids;
+        for (const auto &period_frame : frames)
+        {
+            camera_ids.push_back(period_frame.camera_id());
+        }
+        completed_periods.push_back(camera_ids);
+    }
+};
+
+TEST_F(VisionFrameCoalescerTest, single_camera_completes_every_period_immediately)
+{
+    VisionFrameCoalescer coalescer(Duration::fromMilliseconds(10), true);
+
+    addFrame(coalescer, 0, 1.0);
+    addFrame(coalescer, 0, 1.016);
+
+    EXPECT_EQ(completed_periods, (std::vector<std::vector<unsigned int>>{{0}, {0}}));
+}
+
+TEST_F(VisionFrameCoalescerTest, waits_for_all_active_cameras)
+{
+    VisionFrameCoalescer coalescer(Duration::fromMilliseconds(10), true);
+
+    // The first period completes once the second camera is first seen, since only the
+    // first camera was active until then
+    addFrame(coalescer, 0, 1.0);
+    addFrame(coalescer, 1, 1.002);
+    completed_periods.clear();
+
+    addFrame(coalescer, 0, 1.016);
+    addFrame(coalescer, 1, 1.018);
+    EXPECT_EQ(completed_periods, (std::vector<std::vector<unsigned int>>{{1}, {0, 1}}));
+    completed_periods.clear();
+
+    addFrame(coalescer, 1, 1.032);
+    EXPECT_TRUE(completed_periods.empty());
+    addFrame(coalescer, 0, 1.033);
+    EXPECT_EQ(completed_periods, (std::vector<std::vector<unsigned int>>{{1, 0}}));
+}
+
+TEST_F(VisionFrameCoalescerTest, deadline_policy_completes_period_when_next_one_starts)
+{
+    VisionFrameCoalescer coalescer(Duration::fromMilliseconds(10), false);
+
+    addFrame(coalescer, 0, 1.0);
+    addFrame(coalescer, 1, 1.002);
+    EXPECT_TRUE(completed_periods.empty());
+
+    addFrame(coalescer, 0, 1.016);
+    EXPECT_EQ(completed_periods, (std::vector<std::vector<unsigned int>>{{0, 1}}));
+}
+
+TEST_F(VisionFrameCoalescerTest, deadline_policy_completes_period_once_window_has_passed)
+{
+    VisionFrameCoalescer coalescer(Duration::fromMilliseconds(10), false);
+
+    addFrame(coalescer, 0, 1.0);
+    addFrame(coalescer, 1, 1.002);
+    completeExpiredPeriod(coalescer, 1.009);
+    EXPECT_TRUE(completed_periods.empty());
+
+    // The next period is late, so the period is completed without it
+    completeExpiredPeriod(coalescer, 1.011);
+    EXPECT_EQ(completed_periods, (std::vector<std::vector<unsigned int>>{{0, 1}}));
+    completed_periods.clear();
+
+    // The next period has its own deadline
+    addFrame(coalescer, 0, 1.016);
+    completeExpiredPeriod(coalescer, 1.025);
+    EXPECT_TRUE(completed_periods.empty());
+    completeExpiredPeriod(coalescer, 1.027);
+    EXPECT_EQ(completed_periods, (std::vector<std::vector<unsigned int>>{{0}}));
+}
+
+TEST_F(VisionFrameCoalescerTest, waiting_for_all_cameras_stops_waiting_after_window)
+{
+    VisionFrameCoalescer coalescer(Duration::fromMilliseconds(10), true);
+
+    addFrame(coalescer, 0, 1.0);
+    addFrame(coalescer, 1, 1.002);
+    addFrame(coalescer, 0, 1.016);
+    addFrame(coalescer, 1, 1.018);
+    completed_periods.clear();
+
+    // The second camera goes silent, so the period waits for it until the deadline
+    addFrame(coalescer, 0, 1.032);
+    completeExpiredPeriod(coalescer, 1.041);
+    EXPECT_TRUE(completed_periods.empty());
+    completeExpiredPeriod(coalescer, 1.043);
+    EXPECT_EQ(completed_periods, (std::vector<std::vector<unsigned int>>{{0}}));
+}
+
+TEST_F(VisionFrameCoalescerTest, second_frame_from_camera_starts_new_period)
+{
+    VisionFrameCoalescer coalescer(Duration::fromMilliseconds(50), false);
+
+    addFrame(coalescer, 0, 1.0);
+    addFrame(coalescer, 1, 1.002);
+    addFrame(coalescer, 1, 1.018);
+
+    EXPECT_EQ(completed_periods, (std::vector<std::vector<unsigned int>>{{0, 1}}));
+}
+
+TEST_F(VisionFrameCoalescerTest, stops_waiting_for_camera_that_timed_out)
+{
+    VisionFrameCoalescer coalescer(Duration::fromMilliseconds(10), true);
+
+    addFrame(coalescer, 0, 1.0);
+    addFrame(coalescer, 1, 1.002);
+    addFrame(coalescer, 0, 1.016);
+    addFrame(coalescer, 1, 1.018);
+    completed_periods.clear();
+
+    // The second camera stops sending, so each period is held back until its deadline,
+    // until the camera times out
+    addFrame(coalescer, 0, 1.032);
+    EXPECT_TRUE(completed_periods.empty());
+    addFrame(coalescer, 0, 1.048);
+    EXPECT_EQ(completed_periods, (std::vector<std::vector<unsigned int>>{{0}}));
+    completed_periods.clear();
+
+    addFrame(coalescer, 0, 1.018 + VisionFrameCoalescer::CAMERA_TIMEOUT_SECONDS + 0.001);
+    EXPECT_EQ(completed_periods, (std::vector<std::vector<unsigned int>>{{0}, {0}}));
+}
+
+TEST_F(VisionFrameCoalescerTest, reset_discards_current_period_and_cameras)
+{
+    VisionFrameCoalescer coalescer(Duration::fromMilliseconds(10), true);
+
+    addFrame(coalescer, 0, 1.0);
+    addFrame(coalescer, 1, 1.002);
+    addFrame(coalescer, 0, 1.016);
+    completed_periods.clear();
+
+    // Without the reset, this frame would complete the held back period and then wait
+    // for the first camera
+    coalescer.reset();
+    addFrame(coalescer, 1, 0.1);
+    EXPECT_EQ(completed_periods, (std::vector<std::vector<unsigned int>>{{1}}));
+}
@@ -0,0 +1,57 @@
+#include "software/test_util/allocation_counter.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    thread_local size_t num_allocations = 0;
+
+    void* countedAllocate(std::size_t size)
+    {
+        num_allocations++;
+        // malloc(0) may return nullptr, but operator new must return a unique pointer
+        if (void* ptr = std::malloc(size == 0 ? 1 : size))
+        {
+            return ptr;
+        }
+        throw std::bad_alloc();
+    }
+}  // namespace
+
+AllocationCounter::AllocationCounter() : initial_num_allocations(num_allocations) {}
+
+size_t AllocationCounter::getNumAllocations() const
+{
+    return num_allocations - initial_num_allocations;
+}
+
+void* operator new(std::size_t size)
+{
+    return countedAllocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return countedAllocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
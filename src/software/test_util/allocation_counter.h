@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * Counts the heap allocations that the current thread makes through operator new
+ * while the counter exists.
+ *
+ * Linking in this library replaces the global allocation and deallocation functions
+ * with ones that count the allocations before forwarding to malloc and free. They are
+ * defined in their own translation unit, so that the compiler never sees them paired
+ * with the standard library's inlined allocators.
+ */
+class AllocationCounter
+{
+   public:
+    AllocationCounter();
+
+    AllocationCounter(const AllocationCounter&)            = delete;
+    AllocationCounter& operator=(const AllocationCounter&) = delete;
+
+    /**
+     * Gets the number of allocations the current thread has made since this counter
+     * was created
+     *
+     * @return the number of allocations
+     */
+    size_t getNumAllocations() const;
+
+   private:
+    size_t initial_num_allocations;
+};
@@ -18,5 +18,3 @@ double Time::toMilliseconds() const
 {
     return time_in_seconds * MILLISECONDS_PER_SECOND;
 }
-
-Time::~Time() {}
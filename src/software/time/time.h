@@ -20,11 +20,6 @@ class Time
     // http://www.cplusplus.com/forum/beginner/95128/
     static constexpr double EPSILON = 1e-15;
 
-    /**
-     * The default constructor for a Time. Creates a Time at time 0
-     */
-    Time();
-
     /**
      * Returns the value of the Time in seconds
      *
@@ -39,18 +34,22 @@ class Time
      */
     double toMilliseconds() const;
 
+   protected:
+    /**
+     * The default constructor for a Time. Creates a Time at time 0
+     */
+    Time();
+
     /**
      * Destructor
      *
-     * We declare this virtual because no one should use this class directly, but instead
-     * should use one of it's subclasses.
-     *
-     * Note however that we give it an implementation, so subclasses will by default not
-     * be abstract.
+     * This is protected because no one should use this class directly, but instead
+     * should use one of it's subclasses. It is not virtual so that the subclasses
+     * stay trivially copyable, which lets classes that hold them be copied as raw
+     * memory.
      */
-    virtual ~Time() = 0;
+    ~Time() = default;
 
-   protected:
     /**
      * Constructs a Time value from a value in seconds.
      *
@@ -143,8 +143,8 @@ int main(int argc, char** argv)
 
         // Connect observers
         ai->Subject<TbotsProto::PrimitiveSet>::registerObserver(backend);
-        sensor_fusion->Subject<World>::registerObserver(ai);
-        sensor_fusion->Subject<World>::registerObserver(backend);
+        sensor_fusion->Subject<WorldPtr>::registerObserver(ai);
+        sensor_fusion->Subject<WorldPtr>::registerObserver(backend);
         backend->Subject<SensorProto>::registerObserver(sensor_fusion);
         backend->Subject<TbotsProto::ThunderbotsConfig>::registerObserver(ai);
         backend->Subject<TbotsProto::ThunderbotsConfig>::registerObserver(sensor_fusion);
@@ -7,7 +7,7 @@
 Robot::Robot(RobotId id, const Point &position, const Vector &velocity,
              const Angle &orientation, const AngularVelocity &angular_velocity,
              const Timestamp &timestamp,
-             const std::set<RobotCapability> &unavailable_capabilities,
+             const RobotCapabilityFlags &unavailable_capabilities,
              const RobotConstants_t &robot_constants)
     : id_(id),
       current_state_(position, velocity, orientation, angular_velocity),
@@ -18,7 +18,7 @@ Robot::Robot(RobotId id, const Point &position, const Vector &velocity,
 }
 
 Robot::Robot(RobotId id, const RobotState &initial_state, const Timestamp &timestamp,
-             const std::set<RobotCapability> &unavailable_capabilities,
+             const RobotCapabilityFlags &unavailable_capabilities,
              const RobotConstants_t &robot_constants)
     : id_(id),
       current_state_(initial_state),
@@ -39,16 +39,16 @@ Robot::Robot(const TbotsProto::Robot &robot_proto)
         switch (unavailable_capability)
         {
             case TbotsProto::Robot_RobotCapability_Dribble:
-                unavailable_capabilities_.emplace(RobotCapability::Dribble);
+                unavailable_capabilities_.insert(RobotCapability::Dribble);
                 break;
             case TbotsProto::Robot_RobotCapability_Kick:
-                unavailable_capabilities_.emplace(RobotCapability::Kick);
+                unavailable_capabilities_.insert(RobotCapability::Kick);
                 break;
             case TbotsProto::Robot_RobotCapability_Chip:
-                unavailable_capabilities_.emplace(RobotCapability::Chip);
+                unavailable_capabilities_.insert(RobotCapability::Chip);
                 break;
             case TbotsProto::Robot_RobotCapability_Move:
-                unavailable_capabilities_.emplace(RobotCapability::Move);
+                unavailable_capabilities_.insert(RobotCapability::Move);
                 break;
         }
     }
@@ -126,26 +126,28 @@ bool Robot::operator!=(const Robot &other) const
     return !(*this == other);
 }
 
-const std::set<RobotCapability> &Robot::getUnavailableCapabilities() const
+std::set<RobotCapability> Robot::getUnavailableCapabilities() const
+{
+    return unavailable_capabilities_.toSet();
+}
+
+const RobotCapabilityFlags &Robot::getUnavailableCapabilityFlags() const
 {
     return unavailable_capabilities_;
 }
 
 std::set<RobotCapability> Robot::getAvailableCapabilities() const
 {
-    // robot capabilities = all possible capabilities - unavailable capabilities
-
-    std::set<RobotCapability> all_capabilities = allRobotCapabilities();
-    std::set<RobotCapability> robot_capabilities;
-    std::set_difference(all_capabilities.begin(), all_capabilities.end(),
-                        getUnavailableCapabilities().begin(),
-                        getUnavailableCapabilities().end(),
-                        std::inserter(robot_capabilities, robot_capabilities.begin()));
+    return getAvailableCapabilityFlags().toSet();
+}
 
-    return robot_capabilities;
+RobotCapabilityFlags Robot::getAvailableCapabilityFlags() const
+{
+    // robot capabilities = all possible capabilities - unavailable capabilities
+    return unavailable_capabilities_.complement();
 }
 
-std::set<RobotCapability> &Robot::getMutableRobotCapabilities()
+RobotCapabilityFlags &Robot::getMutableRobotCapabilities()
 {
     return unavailable_capabilities_;
 }
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <optional>
+#include <set>
+#include <type_traits>
 
 #include "proto/team.pb.h"
 #include "software/constants.h"
@@ -11,6 +13,9 @@
 
 /**
  * Defines an SSL robot
+ *
+ * A robot is trivially copyable, so that teams and worlds can copy their robots without
+ * allocating.
  */
 class Robot
 {
@@ -32,8 +37,8 @@ class Robot
     explicit Robot(RobotId id, const Point &position, const Vector &velocity,
                    const Angle &orientation, const AngularVelocity &angular_velocity,
                    const Timestamp &timestamp,
-                   const std::set<RobotCapability> &unavailable_capabilities =
-                       std::set<RobotCapability>(),
+                   const RobotCapabilityFlags &unavailable_capabilities =
+                       RobotCapabilityFlags(),
                    const RobotConstants_t &robot_constants = DEFAULT_ROBOT_CONSTANTS);
 
     /**
@@ -48,8 +53,8 @@ class Robot
      */
     explicit Robot(RobotId id, const RobotState &initial_state,
                    const Timestamp &timestamp,
-                   const std::set<RobotCapability> &unavailable_capabilities =
-                       std::set<RobotCapability>(),
+                   const RobotCapabilityFlags &unavailable_capabilities =
+                       RobotCapabilityFlags(),
                    const RobotConstants_t &robot_constants = DEFAULT_ROBOT_CONSTANTS);
 
 
@@ -126,7 +131,14 @@ class Robot
      *
      * @return the missing capabilities of the robot
      */
-    const std::set<RobotCapability> &getUnavailableCapabilities() const;
+    std::set<RobotCapability> getUnavailableCapabilities() const;
+
+    /**
+     * Returns the missing capabilities of the robot, without allocating
+     *
+     * @return the missing capabilities of the robot
+     */
+    const RobotCapabilityFlags &getUnavailableCapabilityFlags() const;
 
     /**
      * Creates and returns a rectangle representing the dribbler area
@@ -142,12 +154,19 @@ class Robot
      */
     std::set<RobotCapability> getAvailableCapabilities() const;
 
+    /**
+     * Returns all available capabilities this robot has, without allocating
+     *
+     * @return Returns all available capabilities this robot has
+     */
+    RobotCapabilityFlags getAvailableCapabilityFlags() const;
+
     /**
      * Returns the mutable hardware capabilities of the robot
      *
      * @return the mutable hardware capabilities of the robot
      */
-    std::set<RobotCapability> &getMutableRobotCapabilities();
+    RobotCapabilityFlags &getMutableRobotCapabilities();
 
     /**
      * Returns the robot constants for this robot
@@ -239,10 +258,13 @@ class Robot
     Timestamp timestamp_;
     // The hardware capabilities of the robot, generated from
     // RobotCapabilityFlags::broken_dribblers/chippers/kickers dynamic parameters
-    std::set<RobotCapability> unavailable_capabilities_;
+    RobotCapabilityFlags unavailable_capabilities_;
     RobotConstants_t robot_constants_;
 
     // Default robot constants that should be used for all robots
     inline static const RobotConstants DEFAULT_ROBOT_CONSTANTS =
         create2021RobotConstants();
 };
+
+static_assert(std::is_trivially_copyable_v<Robot>,
+              "Robot must be trivially copyable so that copying it never allocates");
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
+#include <initializer_list>
 #include <set>
 
 #include "software/util/make_enum/make_enum.hpp"
@@ -17,6 +19,165 @@ inline std::set<RobotCapability> allRobotCapabilities()
             RobotCapability::Move};
 }
 
+/**
+ * A set of robot capabilities, stored as a fixed width bitmask so that it can be
+ * copied, compared and combined without allocating
+ */
+class RobotCapabilityFlags
+{
+   public:
+    /**
+     * Creates an empty set of capabilities
+     */
+    constexpr RobotCapabilityFlags() : flags_(0) {}
+
+    /**
+     * Creates a set of the given capabilities. This is implicit so that a set of
+     * capabilities can be passed wherever flags are expected.
+     *
+     * @param capabilities the capabilities in the set
+     */
+    RobotCapabilityFlags(const std::set<RobotCapability>& capabilities) : flags_(0)
+    {
+        for (RobotCapability capability : capabilities)
+        {
+            insert(capability);
+        }
+    }
+
+    /**
+     * Creates a set of the given capabilities
+     *
+     * @param capabilities the capabilities in the set
+     */
+    RobotCapabilityFlags(std::initializer_list<RobotCapability> capabilities)
+        : flags_(0)
+    {
+        for (RobotCapability capability : capabilities)
+        {
+            insert(capability);
+        }
+    }
+
+    /**
+     * Returns a set of all capabilities
+     *
+     * @return a set of all capabilities
+     */
+    static constexpr RobotCapabilityFlags all()
+    {
+        constexpr unsigned int NUM_CAPABILITIES =
+            reflective_enum::size<RobotCapability>();
+        return RobotCapabilityFlags(
+            static_cast<std::uint8_t>((1u << NUM_CAPABILITIES) - 1));
+    }
+
+    /**
+     * Checks if the set contains the given capability
+     *
+     * @param capability the capability to check for
+     *
+     * @return whether the set contains the capability
+     */
+    constexpr bool contains(RobotCapability capability) const
+    {
+        return (flags_ & flag(capability)) != 0;
+    }
+
+    /**
+     * Adds the given capability to the set
+     *
+     * @param capability the capability to add
+     */
+    constexpr void insert(RobotCapability capability)
+    {
+        flags_ |= flag(capability);
+    }
+
+    /**
+     * Removes the given capability from the set
+     *
+     * @param capability the capability to remove
+     */
+    constexpr void erase(RobotCapability capability)
+    {
+        flags_ &= static_cast<std::uint8_t>(~flag(capability));
+    }
+
+    /**
+     * Checks if the set has no capabilities
+     *
+     * @return whether the set is empty
+     */
+    constexpr bool empty() const
+    {
+        return flags_ == 0;
+    }
+
+    /**
+     * Checks if every capability in this set is also in the other set
+     *
+     * @param other the set to check against
+     *
+     * @return whether this set is a subset of the other set
+     */
+    constexpr bool isSubsetOf(const RobotCapabilityFlags& other) const
+    {
+        return (flags_ & ~other.flags_) == 0;
+    }
+
+    /**
+     * Returns the capabilities that are not in this set
+     *
+     * @return every capability that is not in this set
+     */
+    constexpr RobotCapabilityFlags complement() const
+    {
+        return RobotCapabilityFlags(static_cast<std::uint8_t>(all().flags_ & ~flags_));
+    }
+
+    /**
+     * Returns the capabilities in this set as a std::set
+     *
+     * @return the capabilities in this set
+     */
+    std::set<RobotCapability> toSet() const
+    {
+        std::set<RobotCapability> capabilities;
+        for (RobotCapability capability : reflective_enum::values<RobotCapability>())
+        {
+            if (contains(capability))
+            {
+                capabilities.insert(capability);
+            }
+        }
+        return capabilities;
+    }
+
+    constexpr bool operator==(const RobotCapabilityFlags& other) const
+    {
+        return flags_ == other.flags_;
+    }
+
+    constexpr bool operator!=(const RobotCapabilityFlags& other) const
+    {
+        return flags_ != other.flags_;
+    }
+
+   private:
+    constexpr explicit RobotCapabilityFlags(std::uint8_t flags) : flags_(flags) {}
+
+    static constexpr std::uint8_t flag(RobotCapability capability)
+    {
+        return static_cast<std::uint8_t>(1u << static_cast<unsigned int>(capability));
+    }
+
+    std::uint8_t flags_;
+};
+
+static_assert(reflective_enum::size<RobotCapability>() <= 8,
+              "RobotCapabilityFlags must be widened to fit every RobotCapability");
+
 // utility operators below for comparing capabilities
 
 /**
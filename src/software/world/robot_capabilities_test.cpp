@@ -39,3 +39,46 @@ TEST(RobotCapabilitiesTest, test_all_capabilities)
         (all == std::set<RobotCapability>{RobotCapability::Dribble, RobotCapability::Move,
                                           RobotCapability::Chip, RobotCapability::Kick}));
 }
+
+TEST(RobotCapabilitiesTest, test_flags_from_set)
+{
+    std::set<RobotCapability> capabilities{RobotCapability::Kick, RobotCapability::Move};
+    RobotCapabilityFlags flags(capabilities);
+    EXPECT_TRUE(flags.contains(RobotCapability::Kick));
+    EXPECT_TRUE(flags.contains(RobotCapability::Move));
+    EXPECT_FALSE(flags.contains(RobotCapability::Chip));
+    EXPECT_FALSE(flags.contains(RobotCapability::Dribble));
+    EXPECT_EQ(capabilities, flags.toSet());
+}
+
+TEST(RobotCapabilitiesTest, test_flags_insert_and_erase)
+{
+    RobotCapabilityFlags flags;
+    EXPECT_TRUE(flags.empty());
+
+    flags.insert(RobotCapability::Chip);
+    EXPECT_FALSE(flags.empty());
+    EXPECT_EQ(RobotCapabilityFlags({RobotCapability::Chip}), flags);
+
+    flags.erase(RobotCapability::Chip);
+    EXPECT_TRUE(flags.empty());
+}
+
+TEST(RobotCapabilitiesTest, test_flags_all_and_complement)
+{
+    EXPECT_EQ(allRobotCapabilities(), RobotCapabilityFlags::all().toSet());
+    EXPECT_TRUE(RobotCapabilityFlags::all().complement().empty());
+    EXPECT_EQ(RobotCapabilityFlags({RobotCapability::Dribble, RobotCapability::Move}),
+              RobotCapabilityFlags({RobotCapability::Kick, RobotCapability::Chip})
+                  .complement());
+}
+
+TEST(RobotCapabilitiesTest, test_flags_subset)
+{
+    RobotCapabilityFlags kick{RobotCapability::Kick};
+    RobotCapabilityFlags kick_and_chip{RobotCapability::Kick, RobotCapability::Chip};
+    EXPECT_TRUE(RobotCapabilityFlags().isSubsetOf(kick));
+    EXPECT_TRUE(kick.isSubsetOf(kick));
+    EXPECT_TRUE(kick.isSubsetOf(kick_and_chip));
+    EXPECT_FALSE(kick_and_chip.isSubsetOf(kick));
+}
@@ -362,3 +362,15 @@ TEST_F(RobotTest,
     EXPECT_GE(Duration::fromSeconds(max_time_to_rotate),
               robot.getTimeToOrientation(target_angle));
 }
+
+TEST_F(RobotTest, get_capability_flags)
+{
+    Robot robot = Robot(0, Point(3, 1.2), Vector(-3, 1), Angle::fromDegrees(0),
+                        AngularVelocity::fromDegrees(25), current_time,
+                        {RobotCapability::Dribble, RobotCapability::Chip});
+
+    EXPECT_EQ(RobotCapabilityFlags({RobotCapability::Dribble, RobotCapability::Chip}),
+              robot.getUnavailableCapabilityFlags());
+    EXPECT_EQ(RobotCapabilityFlags({RobotCapability::Kick, RobotCapability::Move}),
+              robot.getAvailableCapabilityFlags());
+}
@@ -1,16 +1,19 @@
 #include "software/world/team.h"
 
-#include <set>
+#include <atomic>
 
 #include "shared/constants.h"
 #include "software/logger/logger.h"
 
 Team::Team(const Duration& robot_expiry_buffer_duration)
-    : team_robots_(),
+    : team_robots_(std::make_shared<std::vector<Robot>>()),
+      robot_index_by_id_(),
       goalie_id_(),
       robot_expiry_buffer_duration_(robot_expiry_buffer_duration),
       last_update_timestamp_()
 {
+    team_robots_->reserve(MAX_ROBOT_IDS);
+    robot_index_by_id_.fill(NO_ROBOT_INDEX);
     updateTimestamp(getMostRecentTimestampFromRobots());
 }
 
@@ -23,7 +26,9 @@ Team::Team(const std::vector<Robot>& team_robots,
 
 Team::Team(const TbotsProto::Team& team_proto,
            const Duration& robot_expiry_buffer_duration)
-    : robot_expiry_buffer_duration_(robot_expiry_buffer_duration),
+    : team_robots_(std::make_shared<std::vector<Robot>>()),
+      robot_index_by_id_(),
+      robot_expiry_buffer_duration_(robot_expiry_buffer_duration),
       last_update_timestamp_()
 {
     if (team_proto.has_goalie_id())
@@ -35,38 +40,48 @@ Team::Team(const TbotsProto::Team& team_proto,
         goalie_id_ = std::nullopt;
     }
 
+    team_robots_->reserve(
+        std::max<std::size_t>(team_proto.team_robots_size(), MAX_ROBOT_IDS));
     for (int i = 0; i < team_proto.team_robots_size(); i++)
     {
-        team_robots_.emplace_back(Robot(team_proto.team_robots(i)));
+        team_robots_->emplace_back(Robot(team_proto.team_robots(i)));
     }
+    updateRobotIndices();
 }
 
 void Team::updateRobots(const std::vector<Robot>& new_robots)
 {
+    std::vector<Robot>& team_robots = getMutableRobots();
+
     // Update the robots, checking that there are no duplicate IDs in the given data
-    std::set<unsigned int> robot_ids;
-    for (const auto& robot : new_robots)
+    for (auto robot_it = new_robots.begin(); robot_it != new_robots.end(); robot_it++)
     {
-        // The second value of the pair that is returned indicates whether or not the
-        // value was already present in the set. We use this to detect duplicate robots
-        auto duplicate_id = robot_ids.insert(robot.id());
-        if (!duplicate_id.second)
+        const Robot& robot = *robot_it;
+
+        // There are only ever a few robots, so checking the robots before this one for
+        // the same id is cheap and, unlike a set of the ids, does not allocate
+        if (std::any_of(new_robots.begin(), robot_it,
+                        [&robot](const Robot& r) { return r.id() == robot.id(); }))
         {
             throw std::invalid_argument(
                 "Error: Multiple robots on the same team with the same id");
         }
 
-        auto it = std::find_if(team_robots_.begin(), team_robots_.end(),
-                               [robot](const Robot& r) { return r.id() == robot.id(); });
-        if (it != team_robots_.end())
+        std::optional<std::size_t> robot_index = findRobotIndex(robot.id());
+        if (robot_index)
         {
             // The robot already exists on the team. Find and update the robot
-            it->updateState(robot.currentState(), robot.timestamp());
+            team_robots[*robot_index].updateState(robot.currentState(),
+                                                  robot.timestamp());
         }
         else
         {
             // This robot does not exist as part of the team yet. Add the new robot
-            team_robots_.emplace_back(robot);
+            if (robot.id() < MAX_ROBOT_IDS)
+            {
+                robot_index_by_id_[robot.id()] = team_robots.size();
+            }
+            team_robots.emplace_back(robot);
         }
     }
 
@@ -83,9 +98,11 @@ void Team::updateState(const Team& new_team_data)
 
 void Team::removeExpiredRobots(const Timestamp& timestamp)
 {
+    std::vector<Robot>& team_robots = getMutableRobots();
+
     // Check to see if any Robots have "expired". If it more time than the expiry_buffer
     // has passed, then remove the robot from the team
-    for (auto it = team_robots_.begin(); it != team_robots_.end();)
+    for (auto it = team_robots.begin(); it != team_robots.end();)
     {
         Duration time_diff = timestamp - it->timestamp();
         if (time_diff.toSeconds() < 0)
@@ -95,23 +112,25 @@ void Team::removeExpiredRobots(const Timestamp& timestamp)
         }
         if (time_diff > robot_expiry_buffer_duration_)
         {
-            it = team_robots_.erase(it);
+            it = team_robots.erase(it);
         }
         else
         {
             it++;
         }
     }
+
+    updateRobotIndices();
 }
 
 void Team::removeRobotWithId(unsigned int robot_id)
 {
-    auto it = std::find_if(team_robots_.begin(), team_robots_.end(),
-                           [&](const Robot& r) { return r.id() == robot_id; });
-
-    if (it != team_robots_.end())
+    std::optional<std::size_t> robot_index = findRobotIndex(robot_id);
+    if (robot_index)
     {
-        team_robots_.erase(it);
+        std::vector<Robot>& team_robots = getMutableRobots();
+        team_robots.erase(team_robots.begin() + *robot_index);
+        updateRobotIndices();
     }
 }
 
@@ -127,7 +146,7 @@ void Team::clearGoalie()
 
 std::size_t Team::numRobots() const
 {
-    return team_robots_.size();
+    return team_robots_->size();
 }
 
 const Duration& Team::getRobotExpiryBufferDuration() const
@@ -141,26 +160,22 @@ void Team::setRobotExpiryBuffer(const Duration& new_robot_expiry_buffer_duration
 }
 
 void Team::setUnavailableRobotCapabilities(
-    RobotId id, const std::set<RobotCapability>& new_unavailable_robot_capabilities)
+    RobotId id, const RobotCapabilityFlags& new_unavailable_robot_capabilities)
 {
-    for (Robot& robot : team_robots_)
+    std::optional<std::size_t> robot_index = findRobotIndex(id);
+    if (robot_index)
     {
-        if (robot.id() == id)
-        {
-            robot.getMutableRobotCapabilities() = new_unavailable_robot_capabilities;
-            return;
-        }
+        getMutableRobots()[*robot_index].getMutableRobotCapabilities() =
+            new_unavailable_robot_capabilities;
     }
 }
 
 std::optional<Robot> Team::getRobotById(const unsigned int id) const
 {
-    for (const Robot& robot : team_robots_)
+    std::optional<std::size_t> robot_index = findRobotIndex(id);
+    if (robot_index)
     {
-        if (robot.id() == id)
-        {
-            return robot;
-        }
+        return (*team_robots_)[*robot_index];
     }
 
     return std::nullopt;
@@ -183,14 +198,14 @@ std::optional<unsigned int> Team::getGoalieId() const
 
 const std::vector<Robot>& Team::getAllRobots() const
 {
-    return team_robots_;
+    return *team_robots_;
 }
 
 std::vector<Robot> Team::getAllRobotsExceptGoalie() const
 {
     auto goalie_robot = goalie();
     std::vector<Robot> all_robots;
-    for (auto it = team_robots_.begin(); it != team_robots_.end(); it++)
+    for (auto it = team_robots_->begin(); it != team_robots_->end(); it++)
     {
         if (goalie_robot && *it == *goalie_robot)
         {
@@ -230,7 +245,8 @@ std::optional<Robot> Team::getNearestRobot(const std::vector<Robot>& robots,
 
 void Team::clearAllRobots()
 {
-    team_robots_.clear();
+    getMutableRobots().clear();
+    robot_index_by_id_.fill(NO_ROBOT_INDEX);
 }
 
 Timestamp Team::getMostRecentTimestamp() const
@@ -240,11 +256,11 @@ Timestamp Team::getMostRecentTimestamp() const
 
 Timestamp Team::getMostRecentTimestampFromRobots()
 {
-    std::vector<Robot> robots = this->getAllRobots();
+    const std::vector<Robot>& robots = this->getAllRobots();
 
     Timestamp most_recent_timestamp = Timestamp::fromSeconds(0);
 
-    for (Robot robot : robots)
+    for (const Robot& robot : robots)
     {
         if (robot.timestamp() > most_recent_timestamp)
         {
@@ -269,6 +285,62 @@ void Team::updateTimestamp(Timestamp timestamp)
     }
 }
 
+std::vector<Robot>& Team::getMutableRobots()
+{
+    // Copy the robots only if another team still shares them, so that a team that
+    // owns its robots changes them in place
+    if (team_robots_.use_count() > 1)
+    {
+        auto team_robots = std::make_shared<std::vector<Robot>>();
+        team_robots->reserve(team_robots_->capacity());
+        team_robots->assign(team_robots_->begin(), team_robots_->end());
+        team_robots_ = std::move(team_robots);
+    }
+    else
+    {
+        // use_count() is a relaxed load, so seeing the last copy on another thread go
+        // away does not order that thread's reads of the robots before our writes. The
+        // fence pairs with the release in that copy's reference count decrement.
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    return *team_robots_;
+}
+
+std::optional<std::size_t> Team::findRobotIndex(RobotId id) const
+{
+    if (id < MAX_ROBOT_IDS)
+    {
+        const std::size_t robot_index = robot_index_by_id_[id];
+        if (robot_index == NO_ROBOT_INDEX)
+        {
+            return std::nullopt;
+        }
+        return robot_index;
+    }
+
+    for (std::size_t i = 0; i < team_robots_->size(); i++)
+    {
+        if ((*team_robots_)[i].id() == id)
+        {
+            return i;
+        }
+    }
+    return std::nullopt;
+}
+
+void Team::updateRobotIndices()
+{
+    robot_index_by_id_.fill(NO_ROBOT_INDEX);
+    for (std::size_t i = 0; i < team_robots_->size(); i++)
+    {
+        const RobotId id = (*team_robots_)[i].id();
+        if (id < MAX_ROBOT_IDS)
+        {
+            robot_index_by_id_[id] = i;
+        }
+    }
+}
+
 std::optional<Timestamp> Team::timestamp() const
 {
     std::optional<Timestamp> most_recent_timestamp = std::nullopt;
@@ -1,15 +1,27 @@
 #pragma once
 
+#include <array>
 #include <cstdlib>
+#include <limits>
 #include <map>
+#include <memory>
 #include <optional>
 #include <vector>
 
+#include "shared/constants.h"
 #include "software/time/timestamp.h"
 #include "software/world/robot.h"
 
 /**
  * A team of robots
+ *
+ * Copies of a team share the same robots until one of them changes its robots, which
+ * then copies them first, so a team can be copied into every World snapshot without
+ * copying its robots.
+ *
+ * Alongside the robots, a team keeps the index of each robot by its id, so that robots
+ * can be found by id without searching. Once the team has seen its robots, updating
+ * them does not allocate unless they are shared with a copy of the team.
  */
 class Team
 {
@@ -43,6 +55,16 @@ class Team
         const TbotsProto::Team& team_proto,
         const Duration& robot_expiry_buffer_duration = Duration::fromMilliseconds(50));
 
+    /**
+     * Copies a team, sharing its robots with the copy. Since the copy constructor and
+     * assignment are declared, a team is copied rather than moved, which only shares
+     * the robots and leaves the original team with its robots.
+     *
+     * @param other The team to copy
+     */
+    Team(const Team& other) = default;
+    Team& operator=(const Team& other) = default;
+
     /**
      * Updates this team with new robots.
      *
@@ -134,7 +156,7 @@ class Team
      * robot capabilities
      * */
     void setUnavailableRobotCapabilities(
-        RobotId id, const std::set<RobotCapability>& new_unavailable_robot_capabilities);
+        RobotId id, const RobotCapabilityFlags& new_unavailable_robot_capabilities);
 
     /**
      * Returns the robot with the given id. If this team does not have that robot,
@@ -255,8 +277,39 @@ class Team
      */
     Timestamp getMostRecentTimestampFromRobots();
 
-    // The robots on this team
-    std::vector<Robot> team_robots_;
+    /**
+     * Returns the robots on this team so they can be changed, copying them first if
+     * they are shared with a copy of this team
+     *
+     * @return the robots on this team, which are not shared with any other team
+     */
+    std::vector<Robot>& getMutableRobots();
+
+    /**
+     * Finds the index of the robot with the given id in the robots on this team
+     *
+     * @param id the id of the robot
+     *
+     * @return the index of the robot with the given id if it is on this team,
+     * otherwise std::nullopt
+     */
+    std::optional<std::size_t> findRobotIndex(RobotId id) const;
+
+    /**
+     * Updates the index of every robot by its id, after robots were removed
+     */
+    void updateRobotIndices();
+
+    // Marks an id that no robot on this team has in robot_index_by_id_
+    static constexpr std::size_t NO_ROBOT_INDEX = std::numeric_limits<std::size_t>::max();
+
+    // The robots on this team, which may be shared with copies of this team. They must
+    // only be changed through getMutableRobots.
+    std::shared_ptr<std::vector<Robot>> team_robots_;
+
+    // The index of each robot in team_robots_ by its id, for robots with ids less than
+    // MAX_ROBOT_IDS. Robots with larger ids are found by searching team_robots_.
+    std::array<std::size_t, MAX_ROBOT_IDS> robot_index_by_id_;
 
     // The robot id of the goalie for this team
     std::optional<unsigned int> goalie_id_;
@@ -711,3 +711,107 @@ TEST_F(TeamTest, get_all_robots_except_goalie_in_team_of_4)
     EXPECT_NE(returned_robot_ids.find(1), returned_robot_ids.end());
     EXPECT_NE(returned_robot_ids.find(3), returned_robot_ids.end());
 }
+
+TEST_F(TeamTest, copies_share_robots_until_changed)
+{
+    Robot robot_0 = Robot(0, Point(0, 1), Vector(-1, -2), Angle::half(),
+                          AngularVelocity::threeQuarter(), current_time);
+    Robot robot_1 = Robot(1, Point(3, -1), Vector(), Angle::zero(),
+                          AngularVelocity::zero(), current_time);
+    Team team = Team({robot_0, robot_1}, Duration::fromMilliseconds(1000));
+
+    Team team_copy = team;
+    EXPECT_EQ(&team.getAllRobots(), &team_copy.getAllRobots());
+
+    // Changing the goalie does not change the robots, so they stay shared
+    team_copy.assignGoalie(1);
+    EXPECT_EQ(&team.getAllRobots(), &team_copy.getAllRobots());
+
+    Robot moved_robot_0 = Robot(0, Point(1, 1), Vector(), Angle::half(),
+                                AngularVelocity::zero(), one_second_future);
+    team_copy.updateRobots({moved_robot_0});
+    EXPECT_NE(&team.getAllRobots(), &team_copy.getAllRobots());
+    EXPECT_EQ(robot_0, team.getRobotById(0));
+    EXPECT_EQ(moved_robot_0, team_copy.getRobotById(0));
+
+    team_copy = team;
+    team_copy.removeRobotWithId(1);
+    EXPECT_EQ(2, team.numRobots());
+    EXPECT_EQ(1, team_copy.numRobots());
+
+    team_copy = team;
+    team_copy.setUnavailableRobotCapabilities(0, {RobotCapability::Kick});
+    EXPECT_TRUE(team.getRobotById(0)->getUnavailableCapabilities().empty());
+    EXPECT_EQ(std::set<RobotCapability>{RobotCapability::Kick},
+              team_copy.getRobotById(0)->getUnavailableCapabilities());
+}
+
+TEST_F(TeamTest, moved_from_team_keeps_its_robots)
+{
+    Robot robot_0 = Robot(0, Point(0, 1), Vector(-1, -2), Angle::half(),
+                          AngularVelocity::threeQuarter(), current_time);
+    Team team = Team({robot_0}, Duration::fromMilliseconds(1000));
+
+    // Moving a team copies it, so the moved-from team can still be used
+    Team moved_team = std::move(team);
+    EXPECT_EQ(1, team.numRobots());
+    EXPECT_EQ(robot_0, team.getRobotById(0));
+    EXPECT_EQ(robot_0, moved_team.getRobotById(0));
+
+    Team assigned_team;
+    assigned_team = std::move(moved_team);
+    EXPECT_EQ(1, moved_team.numRobots());
+    EXPECT_EQ(robot_0, assigned_team.getRobotById(0));
+
+    // The moved-from team can still be changed without changing the other teams
+    moved_team.removeRobotWithId(0);
+    EXPECT_EQ(0, moved_team.numRobots());
+    EXPECT_EQ(1, team.numRobots());
+    EXPECT_EQ(1, assigned_team.numRobots());
+}
+
+TEST_F(TeamTest, get_robot_by_id_after_removing_robots)
+{
+    Robot robot_0 = Robot(0, Point(0, 1), Vector(), Angle::zero(),
+                          AngularVelocity::zero(), current_time);
+    Robot robot_1 = Robot(1, Point(1, 1), Vector(), Angle::zero(),
+                          AngularVelocity::zero(), current_time);
+    Robot robot_2 = Robot(2, Point(2, 1), Vector(), Angle::zero(),
+                          AngularVelocity::zero(), one_second_future);
+    Team team = Team({robot_0, robot_1, robot_2}, Duration::fromMilliseconds(500));
+
+    // Removing a robot moves the robots after it, so they must still be found by id
+    team.removeRobotWithId(0);
+    EXPECT_EQ(std::nullopt, team.getRobotById(0));
+    EXPECT_EQ(robot_1, team.getRobotById(1));
+    EXPECT_EQ(robot_2, team.getRobotById(2));
+
+    team.removeExpiredRobots(one_second_future);
+    EXPECT_EQ(std::nullopt, team.getRobotById(1));
+    EXPECT_EQ(robot_2, team.getRobotById(2));
+
+    team.updateRobots({robot_0});
+    EXPECT_EQ(robot_0, team.getRobotById(0));
+    EXPECT_EQ(robot_2, team.getRobotById(2));
+    EXPECT_EQ(2, team.numRobots());
+}
+
+TEST_F(TeamTest, robots_with_ids_past_max_robot_ids)
+{
+    Robot robot_0 = Robot(0, Point(0, 1), Vector(), Angle::zero(),
+                          AngularVelocity::zero(), current_time);
+    Robot robot_large_id = Robot(MAX_ROBOT_IDS + 3, Point(1, 1), Vector(), Angle::zero(),
+                                 AngularVelocity::zero(), current_time);
+    Team team = Team({robot_large_id, robot_0});
+
+    EXPECT_EQ(robot_large_id, team.getRobotById(MAX_ROBOT_IDS + 3));
+    EXPECT_EQ(robot_0, team.getRobotById(0));
+    EXPECT_EQ(std::nullopt, team.getRobotById(MAX_ROBOT_IDS + 4));
+
+    EXPECT_THROW(team.updateRobots({robot_large_id, robot_large_id}),
+                 std::invalid_argument);
+
+    team.removeRobotWithId(MAX_ROBOT_IDS + 3);
+    EXPECT_EQ(std::nullopt, team.getRobotById(MAX_ROBOT_IDS + 3));
+    EXPECT_EQ(robot_0, team.getRobotById(0));
+}
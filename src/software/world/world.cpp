@@ -14,7 +14,8 @@ World::World(const Field &field, const Ball &ball, const Team &friendly_team,
       // Store a small buffer of previous referee commands so we can filter out noise
       referee_command_history_(REFEREE_COMMAND_BUFFER_SIZE),
       referee_stage_history_(REFEREE_COMMAND_BUFFER_SIZE),
-      team_with_possession_(TeamPossession::FRIENDLY_TEAM)
+      team_with_possession_(TeamPossession::FRIENDLY_TEAM),
+      creation_time_(std::chrono::steady_clock::now())
 {
     updateTimestamp(getMostRecentTimestampFromMembers());
 }
@@ -112,16 +113,11 @@ void World::updateRefereeStage(const RefereeStage &stage)
 
 Timestamp World::getMostRecentTimestampFromMembers()
 {
-    // Intit to 0.0. This way we will always get a larger or equal timestamp from one of
-    // the members
-    Timestamp most_recent_timestamp = Timestamp::fromSeconds(0.0);
-
     // Add all member timestamps to a list
     std::initializer_list<Timestamp> member_timestamps = {
         friendly_team_.getMostRecentTimestamp(), enemy_team_.getMostRecentTimestamp(),
         ball_.timestamp()};
     // Return the max
-
     return std::max(member_timestamps);
 }
 
@@ -173,3 +169,8 @@ TeamPossession World::getTeamWithPossession() const
 {
     return team_with_possession_;
 }
+
+std::chrono::steady_clock::time_point World::getCreationTime() const
+{
+    return creation_time_;
+}
@@ -2,6 +2,7 @@
 
 
 #include <boost/circular_buffer.hpp>
+#include <chrono>
 
 #include "software/world/ball.h"
 #include "software/world/field.h"
@@ -161,6 +162,16 @@ class World final
      */
     void updateTimestamp(Timestamp timestamp);
 
+    /**
+     * Gets when this World was created, on the steady clock of this host. Copies of a
+     * World keep the creation time of the World they were copied from, so this can be
+     * used to measure how old the data in a World is, unlike the timestamps of its
+     * members which are in the clock of the vision system.
+     *
+     * @return The time this World was created
+     */
+    std::chrono::steady_clock::time_point getCreationTime() const;
+
     /**
      * Sets the team with possession
      *
@@ -216,6 +227,7 @@ class World final
     boost::circular_buffer<RefereeStage> referee_stage_history_;
     // which team has possession of the ball
     TeamPossession team_with_possession_;
+    std::chrono::steady_clock::time_point creation_time_;
 };
 
 using WorldPtr = std::shared_ptr<const World>;
@@ -214,3 +214,72 @@ TEST_F(WorldTest, set_team_with_possession)
     world.setTeamWithPossession(TeamPossession::ENEMY_TEAM);
     EXPECT_EQ(world.getTeamWithPossession(), TeamPossession::ENEMY_TEAM);
 }
+
+TEST_F(WorldTest, creation_time_is_kept_by_copies)
+{
+    const auto time_before_creation = std::chrono::steady_clock::now();
+    World new_world(field, ball, friendly_team, enemy_team);
+    const auto time_after_creation = std::chrono::steady_clock::now();
+
+    EXPECT_GE(new_world.getCreationTime(), time_before_creation);
+    EXPECT_LE(new_world.getCreationTime(), time_after_creation);
+
+    World world_copy = new_world;
+    world_copy.updateBall(Ball(Point(0, 0), Vector(0, 0), current_time));
+    EXPECT_EQ(world_copy.getCreationTime(), new_world.getCreationTime());
+}
+
+TEST_F(WorldTest, DISABLED_publish_world_speed_test)
+{
+    // A full field of robots, some of which have unavailable capabilities
+    std::vector<Robot> friendly_robots;
+    std::vector<Robot> enemy_robots;
+    for (RobotId id = 0; id < 11; id++)
+    {
+        std::set<RobotCapability> unavailable_capabilities;
+        if (id % 3 == 0)
+        {
+            unavailable_capabilities.insert(RobotCapability::Chip);
+        }
+        friendly_robots.emplace_back(id, Point(-4 + 0.4 * id, 1), Vector(1, 0),
+                                     Angle::zero(), AngularVelocity::zero(),
+                                     current_time, unavailable_capabilities);
+        enemy_robots.emplace_back(id, Point(4 - 0.4 * id, -1), Vector(-1, 0),
+                                  Angle::half(), AngularVelocity::zero(), current_time,
+                                  unavailable_capabilities);
+    }
+    World published_world(field, ball, Team(friendly_robots), Team(enemy_robots));
+
+    const int num_iterations = 100000;
+    size_t num_robots_seen   = 0;
+
+    // Publishing by value copies the world for each of the AI and the backend, and the
+    // AI copies it once more into a shared pointer
+    auto start_time = std::chrono::system_clock::now();
+    for (int i = 0; i < num_iterations; i++)
+    {
+        World ai_world            = published_world;
+        World backend_world       = published_world;
+        WorldPtr ai_world_ptr     = std::make_shared<const World>(ai_world);
+        num_robots_seen += ai_world_ptr->friendlyTeam().numRobots() +
+                           backend_world.enemyTeam().numRobots();
+    }
+    const double by_value_duration_ms = ::TestUtil::millisecondsSince(start_time);
+
+    // Publishing a snapshot creates the world once and shares it with both of them
+    start_time = std::chrono::system_clock::now();
+    for (int i = 0; i < num_iterations; i++)
+    {
+        WorldPtr snapshot          = std::make_shared<const World>(published_world);
+        WorldPtr ai_world_ptr      = snapshot;
+        WorldPtr backend_world_ptr = snapshot;
+        num_robots_seen += ai_world_ptr->friendlyTeam().numRobots() +
+                           backend_world_ptr->enemyTeam().numRobots();
+    }
+    const double snapshot_duration_ms = ::TestUtil::millisecondsSince(start_time);
+
+    std::cout << "Took " << by_value_duration_ms * 1000 / num_iterations
+              << "us to publish a world with " << num_robots_seen / (2 * num_iterations)
+              << " robots by value, and " << snapshot_duration_ms * 1000 / num_iterations
+              << "us to publish it as a shared snapshot" << std::endl;
+}